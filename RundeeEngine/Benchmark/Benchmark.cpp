@@ -0,0 +1,533 @@
+//Project Name: Benchmark
+//File Name: Benchmark.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Microbenchmarks for the Vec2/Vec3 math types
+
+// Usage: Benchmark [--filter text] [--elements n] [--repetitions n] [--min-time ms] [--cpu n] [--simd level] [--json path]
+//        Benchmark --accuracy
+//
+// Every case applies one operation across --elements inputs, so ns/op is
+// the cost per element with the loop included. Scalar cases use the
+// CommonType operators on arrays of Vec2/Vec3 and batch cases use the
+// Vec3Stream kernels. The Vec2OutOfLine/Vec3OutOfLine groups repeat the
+// scalar cases against the old CommonType.cpp bodies in a separate
+// translation unit (OutOfLineVec.cpp), the layout before the math became
+// inline, so each pair of lines shows what inlining gained. Each repetition runs a case until at least
+// --min-time has passed; the median of the repetitions is reported, with
+// the coefficient of variation as the stability measure. --cpu -1 leaves
+// the thread unpinned. --simd binds the batch kernels to a lower
+// instruction set ("scalar", "sse2", "avx2", ...) than the CPU's best, to
+// compare the dispatched variants. --json writes the results ("-" for stdout).
+// --accuracy runs no timings; it checks FastMath against the C runtime
+// instead (FastMathAccuracy.cpp) and exits non-zero past the documented error.
+//
+// On Linux, CMakeLists.txt at the solution root builds the engine without
+// Renderer.cpp and this benchmark; ctest runs --accuracy.
+
+#include "RundeeEngine/Common/CommonType.h"
+#include "RundeeEngine/Math/Random.h"
+#include "RundeeEngine/Math/SIMD.h"
+#include "RundeeEngine/Math/SimdKernels.h"
+#include "RundeeEngine/Math/VecStream.h"
+#include "FastMathAccuracy.h"
+#include "OutOfLineVec.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <intrin.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace RundeeEngine;
+
+struct BenchmarkCase
+{
+	std::string Group;
+	std::string Name;
+	// "scalar" or "batch"
+	std::string Form;
+	std::function<void()> Run;
+};
+
+struct BenchmarkResult
+{
+	const BenchmarkCase* Case;
+	std::vector<double> NsPerOp;
+	double Median;
+	double Min;
+	double Mean;
+	double StdDev;
+};
+
+struct Options
+{
+	std::string Filter;
+	std::string JsonPath;
+	size_t Elements = 1024;
+	int Repetitions = 15;
+	double MinTimeMs = 20.0;
+	int Cpu = 0;
+	std::string Simd;
+	bool Accuracy = false;
+};
+
+template<typename V2, typename V3>
+struct VectorInputs
+{
+	std::vector<V2> A2, B2, C2;
+	std::vector<V3> A3, B3, C3;
+};
+
+struct InputData
+{
+	VectorInputs<Vec2, Vec3> Inline;
+	// The same values, for the out-of-line baseline
+	VectorInputs<OutOfLine::Vec2, OutOfLine::Vec3> Baseline;
+	std::vector<float> Scalars;
+	Vec3Stream StreamA, StreamB, StreamOut;
+	std::vector<float> StreamScalars;
+};
+
+// Keeps the compiler from discarding stores the benchmark never reads
+static void ClobberMemory()
+{
+	#ifdef _MSC_VER
+	_ReadWriteBarrier();
+	#else
+	asm volatile("" : : : "memory");
+	#endif
+}
+
+static bool PinToCpu(int cpu)
+{
+	#ifdef _WIN32
+	return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+	#else
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+	#endif
+}
+
+static const char* BuildSimdLevel()
+{
+	#if RUNDEE_SIMD_AVX2
+	return RUNDEE_SIMD_FMA ? "AVX2+FMA" : "AVX2";
+	#elif RUNDEE_SIMD_AVX
+	return "AVX";
+	#elif RUNDEE_SIMD_SSE2
+	return "SSE2";
+	#else
+	return "Scalar";
+	#endif
+}
+
+static void FillInputs(InputData& data, size_t count)
+{
+	// Fixed seed so every run sees the same values; nothing is zero
+	Pcg32 random(20261019);
+	auto next = [&]() { return random.NextFloat(0.1f, 2.0f) * (random.NextUInt32(2) ? 1.0f : -1.0f); };
+	VectorInputs<Vec2, Vec3>& inputs = data.Inline;
+	inputs.A2.resize(count);
+	inputs.B2.resize(count);
+	inputs.C2.resize(count);
+	inputs.A3.resize(count);
+	inputs.B3.resize(count);
+	inputs.C3.resize(count);
+	data.Scalars.resize(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		inputs.A2[i] = Vec2(next(), next());
+		inputs.B2[i] = Vec2(next(), next());
+		inputs.C2[i] = Vec2(next(), next());
+		inputs.A3[i] = Vec3(next(), next(), next());
+		inputs.B3[i] = Vec3(next(), next(), next());
+		inputs.C3[i] = Vec3(next(), next(), next());
+		data.Scalars[i] = random.NextFloat();
+	}
+
+	auto toBaseline2 = [](const Vec2& v) { return OutOfLine::Vec2(v.x, v.y); };
+	auto toBaseline3 = [](const Vec3& v) { return OutOfLine::Vec3(v.x, v.y, v.z); };
+	VectorInputs<OutOfLine::Vec2, OutOfLine::Vec3>& baseline = data.Baseline;
+	std::transform(inputs.A2.begin(), inputs.A2.end(), std::back_inserter(baseline.A2), toBaseline2);
+	std::transform(inputs.B2.begin(), inputs.B2.end(), std::back_inserter(baseline.B2), toBaseline2);
+	std::transform(inputs.C2.begin(), inputs.C2.end(), std::back_inserter(baseline.C2), toBaseline2);
+	std::transform(inputs.A3.begin(), inputs.A3.end(), std::back_inserter(baseline.A3), toBaseline3);
+	std::transform(inputs.B3.begin(), inputs.B3.end(), std::back_inserter(baseline.B3), toBaseline3);
+	std::transform(inputs.C3.begin(), inputs.C3.end(), std::back_inserter(baseline.C3), toBaseline3);
+
+	data.StreamA.FromAoS(inputs.A3.data(), count);
+	data.StreamB.FromAoS(inputs.B3.data(), count);
+	data.StreamOut.Resize(count);
+	data.StreamScalars.resize(count);
+}
+
+// out[i] = op(a[i], b[i], c[i], scalar[i]); bool results are stored as bytes
+template<typename Input, typename Op>
+static BenchmarkCase MapCase(const char* group, const char* name, const std::vector<Input>& a, const std::vector<Input>& b,
+	const std::vector<Input>& c, const std::vector<float>& scalars, Op op)
+{
+	using Result = decltype(op(a[0], b[0], c[0], scalars[0]));
+	using Stored = std::conditional_t<std::is_same<Result, bool>::value, uint8_t, Result>;
+	auto out = std::make_shared<std::vector<Stored>>(a.size());
+	const Input* aData = a.data();
+	const Input* bData = b.data();
+	const Input* cData = c.data();
+	const float* scalarData = scalars.data();
+	size_t count = a.size();
+	return BenchmarkCase{ group, name, "scalar", [=]()
+	{
+		Stored* outData = out->data();
+		for (size_t i = 0; i < count; ++i)
+		{
+			outData[i] = static_cast<Stored>(op(aData[i], bData[i], cData[i], scalarData[i]));
+		}
+		ClobberMemory();
+	} };
+}
+
+#define VEC2_CASE(name, expression) cases.push_back(MapCase(vec2Group, name, inputs.A2, inputs.B2, inputs.C2, scalars, \
+	[](const V2& a, const V2& b, const V2& c, float s) { (void)a; (void)b; (void)c; (void)s; return expression; }))
+#define VEC3_CASE(name, expression) cases.push_back(MapCase(vec3Group, name, inputs.A3, inputs.B3, inputs.C3, scalars, \
+	[](const V3& a, const V3& b, const V3& c, float s) { (void)a; (void)b; (void)c; (void)s; return expression; }))
+#define STREAM_CASE(name, statement) cases.push_back(BenchmarkCase{ "Vec3Stream", name, "batch", [&data]() { statement; ClobberMemory(); } })
+
+// Registered once for the inline types and once for the out-of-line baseline
+template<typename V2, typename V3>
+static void RegisterVectorCases(std::vector<BenchmarkCase>& cases, const char* vec2Group, const char* vec3Group,
+	const VectorInputs<V2, V3>& inputs, const std::vector<float>& scalars)
+{
+
+	VEC2_CASE("operator==", a == b);
+	VEC2_CASE("operator!=", a != b);
+	VEC2_CASE("operator+", a + b);
+	VEC2_CASE("operator-", a - b);
+	VEC2_CASE("operator*(float)", a * s);
+	VEC2_CASE("operator/(float)", a / s);
+	VEC2_CASE("operator+=", V2(a) += b);
+	VEC2_CASE("operator-=", V2(a) -= b);
+	VEC2_CASE("operator*=(float)", V2(a) *= s);
+	VEC2_CASE("operator/=(float)", V2(a) /= s);
+	VEC2_CASE("Length", a.Length());
+	VEC2_CASE("LengthSquared", a.LengthSquared());
+	VEC2_CASE("Normalize", a.Normalize());
+	VEC2_CASE("Dot", a.Dot(b));
+	VEC2_CASE("Cross", a.Cross(b));
+	VEC2_CASE("Distance", a.Distance(b));
+	VEC2_CASE("DistanceSquared", a.DistanceSquared(b));
+	VEC2_CASE("Perpendicular", a.Perpendicular());
+	VEC2_CASE("Rotate", a.Rotate(s));
+	VEC2_CASE("Lerp", a.Lerp(b, s));
+	VEC2_CASE("Clamp", a.Clamp(b, c));
+	VEC2_CASE("Reflect", a.Reflect(b));
+	VEC2_CASE("Project", a.Project(b));
+	VEC2_CASE("RotateAround", a.RotateAround(b, s));
+	VEC2_CASE("operator-()", -a);
+	VEC2_CASE("operator*(Vec2)", a * b);
+	VEC2_CASE("operator/(Vec2)", a / b);
+	VEC2_CASE("operator*=(Vec2)", V2(a) *= b);
+	VEC2_CASE("operator/=(Vec2)", V2(a) /= b);
+	VEC2_CASE("IsZero", a.IsZero());
+	VEC2_CASE("IsEqual", a.IsEqual(b));
+	VEC2_CASE("Angle", a.Angle());
+	VEC2_CASE("Angle(Vec2)", a.Angle(b));
+	VEC2_CASE("AngleDeg", a.AngleDeg());
+	VEC2_CASE("AngleDeg(Vec2)", a.AngleDeg(b));
+	VEC2_CASE("AngleRad", a.AngleRad());
+	VEC2_CASE("AngleRad(Vec2)", a.AngleRad(b));
+	VEC2_CASE("DistanceToLine", a.DistanceToLine(b, c));
+	VEC2_CASE("DistanceToLineSquared", a.DistanceToLineSquared(b, c));
+	VEC2_CASE("AngleToLine", a.AngleToLine(b, c));
+	VEC2_CASE("AngleToLineDeg", a.AngleToLineDeg(b, c));
+	VEC2_CASE("AngleToLineRad", a.AngleToLineRad(b, c));
+
+	VEC3_CASE("operator==", a == b);
+	VEC3_CASE("operator!=", a != b);
+	VEC3_CASE("operator+", a + b);
+	VEC3_CASE("operator-", a - b);
+	VEC3_CASE("operator*(float)", a * s);
+	VEC3_CASE("operator/(float)", a / s);
+	VEC3_CASE("operator+=", V3(a) += b);
+	VEC3_CASE("operator-=", V3(a) -= b);
+	VEC3_CASE("operator*=(float)", V3(a) *= s);
+	VEC3_CASE("operator/=(float)", V3(a) /= s);
+	VEC3_CASE("Length", a.Length());
+	VEC3_CASE("LengthSquared", a.LengthSquared());
+	VEC3_CASE("Normalize", a.Normalize());
+	VEC3_CASE("Dot", a.Dot(b));
+	VEC3_CASE("Cross", a.Cross(b));
+	VEC3_CASE("Distance", a.Distance(b));
+	VEC3_CASE("DistanceSquared", a.DistanceSquared(b));
+	VEC3_CASE("Perpendicular", a.Perpendicular());
+	VEC3_CASE("Rotate", a.Rotate(s, c));
+	VEC3_CASE("Lerp", a.Lerp(b, s));
+	VEC3_CASE("Clamp", a.Clamp(b, c));
+	VEC3_CASE("Reflect", a.Reflect(b));
+	VEC3_CASE("Project", a.Project(b));
+	VEC3_CASE("RotateAround", a.RotateAround(b, s, c));
+	VEC3_CASE("operator-()", -a);
+	VEC3_CASE("operator*(Vec3)", a * b);
+	VEC3_CASE("operator/(Vec3)", a / b);
+	VEC3_CASE("operator*=(Vec3)", V3(a) *= b);
+	VEC3_CASE("operator/=(Vec3)", V3(a) /= b);
+	VEC3_CASE("IsZero", a.IsZero());
+	VEC3_CASE("IsEqual", a.IsEqual(b));
+	VEC3_CASE("Angle", a.Angle());
+	VEC3_CASE("Angle(Vec3)", a.Angle(b));
+	VEC3_CASE("AngleDeg", a.AngleDeg());
+	VEC3_CASE("AngleDeg(Vec3)", a.AngleDeg(b));
+	VEC3_CASE("AngleRad", a.AngleRad());
+	VEC3_CASE("AngleRad(Vec3)", a.AngleRad(b));
+	VEC3_CASE("DistanceToLine", a.DistanceToLine(b, c));
+	VEC3_CASE("DistanceToLineSquared", a.DistanceToLineSquared(b, c));
+	VEC3_CASE("AngleToLine", a.AngleToLine(b, c));
+	VEC3_CASE("AngleToLineDeg", a.AngleToLineDeg(b, c));
+	VEC3_CASE("AngleToLineRad", a.AngleToLineRad(b, c));
+	VEC3_CASE("DistanceToPlane", a.DistanceToPlane(b, c));
+	VEC3_CASE("DistanceToPlaneSquared", a.DistanceToPlaneSquared(b, c));
+	VEC3_CASE("AngleToPlane", a.AngleToPlane(c));
+	VEC3_CASE("AngleToPlaneDeg", a.AngleToPlaneDeg(c));
+	VEC3_CASE("AngleToPlaneRad", a.AngleToPlaneRad(c));
+	VEC3_CASE("ProjectOntoPlane", a.ProjectOntoPlane(b, c));
+	VEC3_CASE("ReflectAcrossPlane", a.ReflectAcrossPlane(b, c));
+}
+
+static std::vector<BenchmarkCase> RegisterCases(InputData& data)
+{
+	std::vector<BenchmarkCase> cases;
+	RegisterVectorCases(cases, "Vec2", "Vec3", data.Inline, data.Scalars);
+	RegisterVectorCases(cases, "Vec2OutOfLine", "Vec3OutOfLine", data.Baseline, data.Scalars);
+
+	STREAM_CASE("Add", Vec3Stream::Add(data.StreamA, data.StreamB, data.StreamOut));
+	STREAM_CASE("Subtract", Vec3Stream::Subtract(data.StreamA, data.StreamB, data.StreamOut));
+	STREAM_CASE("Scale", Vec3Stream::Scale(data.StreamA, 1.5f, data.StreamOut));
+	STREAM_CASE("MulAdd", Vec3Stream::MulAdd(data.StreamA, data.StreamB, 1.5f, data.StreamOut));
+	STREAM_CASE("Lerp", Vec3Stream::Lerp(data.StreamA, data.StreamB, 0.25f, data.StreamOut));
+	STREAM_CASE("Normalize", Vec3Stream::Normalize(data.StreamA, data.StreamOut));
+	STREAM_CASE("Dot", Vec3Stream::Dot(data.StreamA, data.StreamB, data.StreamScalars.data()));
+	STREAM_CASE("Length", Vec3Stream::Length(data.StreamA, data.StreamScalars.data()));
+	STREAM_CASE("LengthSquared", Vec3Stream::LengthSquared(data.StreamA, data.StreamScalars.data()));
+	STREAM_CASE("Distance", Vec3Stream::Distance(data.StreamA, data.StreamB, data.StreamScalars.data()));
+
+	return cases;
+}
+
+static double ElapsedNs(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static BenchmarkResult Measure(const BenchmarkCase& benchmarkCase, const Options& options)
+{
+	// Warm up, then double the run count until one repetition lasts MinTimeMs
+	benchmarkCase.Run();
+	size_t runs = 1;
+	for (;;)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < runs; ++i)
+		{
+			benchmarkCase.Run();
+		}
+		if (ElapsedNs(start) >= options.MinTimeMs * 1e6 || runs >= (size_t(1) << 30))
+		{
+			break;
+		}
+		runs *= 2;
+	}
+
+	BenchmarkResult result{ &benchmarkCase, {}, 0.0, 0.0, 0.0, 0.0 };
+	for (int repetition = 0; repetition < options.Repetitions; ++repetition)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < runs; ++i)
+		{
+			benchmarkCase.Run();
+		}
+		result.NsPerOp.push_back(ElapsedNs(start) / (static_cast<double>(runs) * static_cast<double>(options.Elements)));
+	}
+
+	std::vector<double> sorted = result.NsPerOp;
+	std::sort(sorted.begin(), sorted.end());
+	size_t middle = sorted.size() / 2;
+	result.Median = sorted.size() % 2 ? sorted[middle] : 0.5 * (sorted[middle - 1] + sorted[middle]);
+	result.Min = sorted.front();
+	for (double value : sorted)
+	{
+		result.Mean += value;
+	}
+	result.Mean /= static_cast<double>(sorted.size());
+	for (double value : sorted)
+	{
+		result.StdDev += (value - result.Mean) * (value - result.Mean);
+	}
+	result.StdDev = sorted.size() > 1 ? std::sqrt(result.StdDev / static_cast<double>(sorted.size() - 1)) : 0.0;
+	return result;
+}
+
+static double CoefficientOfVariation(const BenchmarkResult& result)
+{
+	return result.Mean > 0.0 ? 100.0 * result.StdDev / result.Mean : 0.0;
+}
+
+static bool WriteJson(const std::vector<BenchmarkResult>& results, const Options& options, bool pinned)
+{
+	FILE* file = options.JsonPath == "-" ? stdout : fopen(options.JsonPath.c_str(), "w");
+	if (!file)
+	{
+		fprintf(stderr, "Cannot open %s for writing\n", options.JsonPath.c_str());
+		return false;
+	}
+
+	fprintf(file, "{\n  \"context\": {\n");
+	fprintf(file, "    \"simd\": \"%s\",\n", BuildSimdLevel());
+	fprintf(file, "    \"kernels\": \"%s\",\n", SimdKernels::Get().Name);
+	fprintf(file, "    \"elements\": %zu,\n", options.Elements);
+	fprintf(file, "    \"repetitions\": %d,\n", options.Repetitions);
+	fprintf(file, "    \"min_time_ms\": %g,\n", options.MinTimeMs);
+	fprintf(file, "    \"cpu\": %d,\n", pinned ? options.Cpu : -1);
+	#ifdef NDEBUG
+	fprintf(file, "    \"build\": \"release\"\n");
+	#else
+	fprintf(file, "    \"build\": \"debug\"\n");
+	#endif
+	fprintf(file, "  },\n  \"benchmarks\": [\n");
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const BenchmarkResult& result = results[i];
+		// Names are operator spellings and identifiers, nothing that needs escaping
+		fprintf(file, "    {\"group\": \"%s\", \"name\": \"%s\", \"form\": \"%s\", ", result.Case->Group.c_str(), result.Case->Name.c_str(), result.Case->Form.c_str());
+		fprintf(file, "\"ns_per_op\": %.4f, \"ns_per_op_min\": %.4f, \"ns_per_op_mean\": %.4f, \"ns_per_op_stddev\": %.4f, ",
+			result.Median, result.Min, result.Mean, result.StdDev);
+		fprintf(file, "\"cv_percent\": %.2f, \"mops_per_second\": %.2f, \"samples\": [", CoefficientOfVariation(result), 1e3 / result.Median);
+		for (size_t sample = 0; sample < result.NsPerOp.size(); ++sample)
+		{
+			fprintf(file, "%s%.4f", sample ? ", " : "", result.NsPerOp[sample]);
+		}
+		fprintf(file, "]}%s\n", i + 1 < results.size() ? "," : "");
+	}
+	fprintf(file, "  ]\n}\n");
+
+	if (file != stdout)
+	{
+		fclose(file);
+	}
+	return true;
+}
+
+static bool ParseOptions(int argc, char** argv, Options& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument = argv[i];
+		if (argument == "--accuracy")
+		{
+			options.Accuracy = true;
+			continue;
+		}
+
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+		if (!value)
+		{
+			fprintf(stderr, "Missing value for %s\n", argument.c_str());
+			return false;
+		}
+
+		if (argument == "--filter") options.Filter = value;
+		else if (argument == "--json") options.JsonPath = value;
+		else if (argument == "--elements") options.Elements = static_cast<size_t>(std::max(1L, std::strtol(value, nullptr, 10)));
+		else if (argument == "--repetitions") options.Repetitions = std::max(1, std::atoi(value));
+		else if (argument == "--min-time") options.MinTimeMs = std::max(0.0, std::atof(value));
+		else if (argument == "--cpu") options.Cpu = std::atoi(value);
+		else if (argument == "--simd") options.Simd = value;
+		else
+		{
+			fprintf(stderr, "Unknown option %s\n", argument.c_str());
+			return false;
+		}
+		++i;
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		fprintf(stderr, "Usage: Benchmark [--filter text] [--elements n] [--repetitions n] [--min-time ms] [--cpu n] [--simd level] [--json path]\n");
+		fprintf(stderr, "       Benchmark --accuracy\n");
+		return 1;
+	}
+
+	if (options.Accuracy)
+	{
+		return RunFastMathAccuracy();
+	}
+
+	if (!options.Simd.empty())
+	{
+		static constexpr SimdLevel Levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::SSE42, SimdLevel::AVX2, SimdLevel::AVX512 };
+		const SimdLevel* level = std::find_if(std::begin(Levels), std::end(Levels), [&](SimdLevel candidate) { return options.Simd == CPUFeatures::GetLevelName(candidate); });
+		if (level == std::end(Levels))
+		{
+			fprintf(stderr, "Unknown SIMD level %s\n", options.Simd.c_str());
+			return 1;
+		}
+		SimdKernels::SetLevel(*level);
+	}
+
+	bool pinned = options.Cpu >= 0 && PinToCpu(options.Cpu);
+	if (options.Cpu >= 0 && !pinned)
+	{
+		fprintf(stderr, "Could not pin to CPU %d, running unpinned\n", options.Cpu);
+	}
+
+	InputData data;
+	FillInputs(data, options.Elements);
+	std::vector<BenchmarkCase> cases = RegisterCases(data);
+
+	// Progress goes to stderr when the JSON is going to stdout
+	FILE* report = options.JsonPath == "-" ? stderr : stdout;
+	fprintf(report, "SIMD %s (kernels %s), %zu elements, %d repetitions, %s\n", BuildSimdLevel(), SimdKernels::Get().Name, options.Elements, options.Repetitions,
+		pinned ? ("pinned to CPU " + std::to_string(options.Cpu)).c_str() : "unpinned");
+	fprintf(report, "%-34s %10s %10s %8s %12s\n", "Benchmark", "ns/op", "min", "cv%", "Mops/s");
+
+	std::vector<BenchmarkResult> results;
+	for (const BenchmarkCase& benchmarkCase : cases)
+	{
+		std::string fullName = benchmarkCase.Group + "::" + benchmarkCase.Name;
+		if (!options.Filter.empty() && fullName.find(options.Filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		results.push_back(Measure(benchmarkCase, options));
+		const BenchmarkResult& result = results.back();
+		fprintf(report, "%-34s %10.3f %10.3f %8.2f %12.1f\n", fullName.c_str(), result.Median, result.Min, CoefficientOfVariation(result), 1e3 / result.Median);
+	}
+
+	if (!options.JsonPath.empty() && !WriteJson(results, options, pinned))
+	{
+		return 1;
+	}
+	return 0;
+}
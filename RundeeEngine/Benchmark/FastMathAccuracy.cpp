@@ -0,0 +1,291 @@
+//Project Name: Benchmark
+//File Name: FastMathAccuracy.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: FastMath accuracy sweep against the C runtime source file
+
+#include "FastMathAccuracy.h"
+#include "RundeeEngine/Math/FastMath.h"
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace RundeeEngine;
+
+enum class ErrorKind
+{
+	Absolute,
+	Relative,
+	// Out-of-range trig: any value in [-1, 1] passes, and infinite or NaN inputs must give NaN
+	Bounded
+};
+
+struct Sweep
+{
+	std::vector<float> X;
+	// Second argument, only used by Atan2
+	std::vector<float> Y;
+};
+
+static float FromBits(uint32_t bits)
+{
+	float value;
+	std::memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+static void AddUniform(Sweep& sweep, float low, float high, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		double t = static_cast<double>(i) / static_cast<double>(count - 1);
+		sweep.X.push_back(static_cast<float>(low + (static_cast<double>(high) - low) * t));
+	}
+}
+
+// Every stride-th float between two bit patterns, so each binade gets the same share
+static void AddBitPatterns(Sweep& sweep, uint32_t first, uint32_t last, uint32_t stride, bool bothSigns)
+{
+	for (uint64_t bits = first; bits <= last; bits += stride)
+	{
+		float value = FromBits(static_cast<uint32_t>(bits));
+		sweep.X.push_back(value);
+		if (bothSigns)
+		{
+			sweep.X.push_back(-value);
+		}
+	}
+}
+
+static double MeasureError(ErrorKind kind, float x, float value, double reference)
+{
+	if (kind == ErrorKind::Bounded)
+	{
+		if (!std::isfinite(x))
+		{
+			return std::isnan(value) ? 0.0 : INFINITY;
+		}
+		return std::fabs(value) <= 1.0f ? 0.0 : INFINITY;
+	}
+
+	if (std::isnan(reference) || std::isnan(value))
+	{
+		return std::isnan(reference) && std::isnan(value) ? 0.0 : INFINITY;
+	}
+	if (std::isinf(reference) || std::isinf(value))
+	{
+		return static_cast<double>(value) == reference ? 0.0 : INFINITY;
+	}
+
+	double error = std::fabs(static_cast<double>(value) - reference);
+	return kind == ErrorKind::Relative && reference != 0.0 ? error / std::fabs(reference) : error;
+}
+
+class AccuracyRun
+{
+public:
+	// kernel(lane, x, y, out, i) writes out[i .. i + width); batch(x, y, out, count) runs the array API.
+	// Each path is measured on its own and printed as one row.
+	template<typename Kernel, typename Batch, typename Reference>
+	void Check(const char* name, const char* range, ErrorKind kind, double limit, const Sweep& sweep,
+		const Kernel& kernel, const Batch& batch, const Reference& reference)
+	{
+		size_t count = sweep.X.size();
+		const float* x = sweep.X.data();
+		const float* y = sweep.Y.empty() ? x : sweep.Y.data();
+
+		std::vector<double> expected(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			expected[i] = reference(static_cast<double>(x[i]), static_cast<double>(y[i]));
+		}
+
+		std::vector<float> out(count);
+		auto report = [&](const char* path)
+		{
+			double worst = 0.0;
+			size_t worstIndex = 0;
+			for (size_t i = 0; i < count; ++i)
+			{
+				double error = MeasureError(kind, x[i], out[i], expected[i]);
+				if (!(error <= worst))
+				{
+					worst = error;
+					worstIndex = i;
+				}
+			}
+
+			bool passed = worst <= limit;
+			m_Failures += passed ? 0 : 1;
+			const char* unit = kind == ErrorKind::Relative ? "rel" : kind == ErrorKind::Absolute ? "abs" : "bound";
+			printf("%-8s %-22s %-7s %5s %10.3g %10.3g  %s", name, range, path, unit, worst, limit, passed ? "ok" : "FAILED");
+			if (!passed)
+			{
+				printf(" at x = %.9g", x[worstIndex]);
+				if (!sweep.Y.empty())
+				{
+					printf(", y = %.9g", y[worstIndex]);
+				}
+			}
+			printf("\n");
+		};
+
+		RunLanes<SimdFloat1>(kernel, x, y, out.data(), count);
+		report("scalar");
+		#if RUNDEE_SIMD_SSE2
+		RunLanes<SimdFloat4>(kernel, x, y, out.data(), count);
+		report("4-wide");
+		#endif
+		#if RUNDEE_SIMD_AVX
+		RunLanes<SimdFloat8>(kernel, x, y, out.data(), count);
+		report("8-wide");
+		#endif
+		batch(x, y, out.data(), count);
+		report("batch");
+	}
+
+	int GetFailures() const { return m_Failures; }
+
+private:
+	template<typename Lane, typename Kernel>
+	static void RunLanes(const Kernel& kernel, const float* x, const float* y, float* out, size_t count)
+	{
+		size_t i = 0;
+		for (; i + Lane::Width <= count; i += Lane::Width)
+		{
+			kernel(Lane(), x, y, out, i);
+		}
+		for (; i < count; ++i)
+		{
+			kernel(SimdFloat1(), x, y, out, i);
+		}
+	}
+
+	int m_Failures = 0;
+};
+
+// The same approximation through a lane type, e.g. FastMath::Sin<L>
+#define LANE_KERNEL(expression) [](auto lane, const float* x, const float* y, float* out, size_t i) \
+	{ using L = decltype(lane); (void)y; L::Store(out + i, expression); }
+
+int RunFastMathAccuracy()
+{
+	Sweep trig;
+	AddUniform(trig, -8192.0f, 8192.0f, size_t(1) << 21);
+	AddUniform(trig, -4.0f, 4.0f, size_t(1) << 20);
+
+	Sweep trigOutOfRange;
+	AddBitPatterns(trigOutOfRange, 0x46000001u, 0x7F7FFFFFu, 1021, true);
+	trigOutOfRange.X.insert(trigOutOfRange.X.end(), { INFINITY, -INFINITY, NAN });
+
+	Sweep atan;
+	AddBitPatterns(atan, 0x00000000u, 0x7F7FFFFFu, 1021, true);
+
+	// Full circle at radii from tiny to huge, plus the axes and the origin
+	Sweep atan2;
+	for (float radius : { 1e-30f, 1e-10f, 1e-3f, 1.0f, 1e3f, 1e10f, 1e30f })
+	{
+		for (size_t i = 0; i < (size_t(1) << 18); ++i)
+		{
+			double angle = -3.14159265358979324 + 6.28318530717958648 * static_cast<double>(i) / static_cast<double>(size_t(1) << 18);
+			atan2.X.push_back(static_cast<float>(radius * std::cos(angle)));
+			atan2.Y.push_back(static_cast<float>(radius * std::sin(angle)));
+		}
+	}
+	for (float value : { 1.0f, -1.0f })
+	{
+		atan2.X.insert(atan2.X.end(), { value, 0.0f });
+		atan2.Y.insert(atan2.Y.end(), { 0.0f, value });
+	}
+	atan2.X.push_back(0.0f);
+	atan2.Y.push_back(0.0f);
+
+	Sweep normals;
+	AddBitPatterns(normals, 0x00800000u, 0x7F7FFFFFu, 509, false);
+
+	Sweep exp;
+	AddUniform(exp, -87.3f, 88.3f, size_t(1) << 22);
+
+	Sweep logUnit;
+	AddBitPatterns(logUnit, 0x3F000000u, 0x40000000u, 3, false);
+
+	// Log's relative error is measured away from its zero at 1
+	Sweep logOutside;
+	AddBitPatterns(logOutside, 0x00800000u, 0x3EFFFFFFu, 251, false);
+	AddBitPatterns(logOutside, 0x40000001u, 0x7F7FFFFFu, 251, false);
+
+	auto sinReference = [](double x, double) { return std::sin(x); };
+	auto cosReference = [](double x, double) { return std::cos(x); };
+	auto sinBatch = [](const float* x, const float*, float* out, size_t count) { FastMath::Sin(x, out, count); };
+	auto cosBatch = [](const float* x, const float*, float* out, size_t count) { FastMath::Cos(x, out, count); };
+	auto sinCosSinBatch = [](const float* x, const float*, float* out, size_t count)
+	{
+		std::vector<float> cosine(count);
+		FastMath::SinCos(x, out, cosine.data(), count);
+	};
+	auto sinCosCosBatch = [](const float* x, const float*, float* out, size_t count)
+	{
+		std::vector<float> sine(count);
+		FastMath::SinCos(x, sine.data(), out, count);
+	};
+	auto sinCosSin = [](auto lane, const float* x, const float*, float* out, size_t i)
+	{
+		using L = decltype(lane);
+		typename L::Type s, c;
+		FastMath::SinCos<L>(L::Load(x + i), s, c);
+		L::Store(out + i, s);
+	};
+	auto sinCosCos = [](auto lane, const float* x, const float*, float* out, size_t i)
+	{
+		using L = decltype(lane);
+		typename L::Type s, c;
+		FastMath::SinCos<L>(L::Load(x + i), s, c);
+		L::Store(out + i, c);
+	};
+
+	// Atan has no array form; its batch row runs the scalar entry point
+	auto atanBatch = [](const float* x, const float*, float* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			out[i] = FastMath::Atan(x[i]);
+		}
+	};
+
+	printf("%-8s %-22s %-7s %5s %10s %10s\n", "Function", "Range", "Path", "Error", "Max", "Limit");
+
+	AccuracyRun run;
+	run.Check("Sin", "|x| <= 8192", ErrorKind::Absolute, 1.7e-7, trig, LANE_KERNEL(FastMath::Sin<L>(L::Load(x + i))), sinBatch, sinReference);
+	run.Check("Cos", "|x| <= 8192", ErrorKind::Absolute, 1.7e-7, trig, LANE_KERNEL(FastMath::Cos<L>(L::Load(x + i))), cosBatch, cosReference);
+	run.Check("SinCos", "|x| <= 8192 (sin)", ErrorKind::Absolute, 9.5e-8, trig, sinCosSin, sinCosSinBatch, sinReference);
+	run.Check("SinCos", "|x| <= 8192 (cos)", ErrorKind::Absolute, 9.5e-8, trig, sinCosCos, sinCosCosBatch, cosReference);
+	run.Check("Sin", "|x| > 8192, inf, NaN", ErrorKind::Bounded, 0.0, trigOutOfRange, LANE_KERNEL(FastMath::Sin<L>(L::Load(x + i))), sinBatch, sinReference);
+	run.Check("Cos", "|x| > 8192, inf, NaN", ErrorKind::Bounded, 0.0, trigOutOfRange, LANE_KERNEL(FastMath::Cos<L>(L::Load(x + i))), cosBatch, cosReference);
+	run.Check("SinCos", "|x| > 8192 (sin)", ErrorKind::Bounded, 0.0, trigOutOfRange, sinCosSin, sinCosSinBatch, sinReference);
+	run.Check("SinCos", "|x| > 8192 (cos)", ErrorKind::Bounded, 0.0, trigOutOfRange, sinCosCos, sinCosCosBatch, cosReference);
+
+	run.Check("Atan", "finite", ErrorKind::Absolute, 1.7e-7, atan, LANE_KERNEL(FastMath::Atan<L>(L::Load(x + i))), atanBatch,
+		[](double x, double) { return std::atan(x); });
+	run.Check("Atan2", "radius 1e-30 .. 1e30", ErrorKind::Absolute, 3.0e-7, atan2, LANE_KERNEL(FastMath::Atan2<L>(L::Load(y + i), L::Load(x + i))),
+		[](const float* x, const float* y, float* out, size_t count) { FastMath::Atan2(y, x, out, count); },
+		[](double x, double y) { return std::atan2(y, x); });
+
+	run.Check("RSqrt", "normal", ErrorKind::Relative, 2.5e-7, normals, LANE_KERNEL(L::RSqrt(L::Load(x + i))),
+		[](const float* x, const float*, float* out, size_t count) { FastMath::RSqrt(x, out, count); },
+		[](double x, double) { return 1.0 / std::sqrt(x); });
+	run.Check("Exp", "[-87.3, 88.3]", ErrorKind::Relative, 1.2e-7, exp, LANE_KERNEL(FastMath::Exp<L>(L::Load(x + i))),
+		[](const float* x, const float*, float* out, size_t count) { FastMath::Exp(x, out, count); },
+		[](double x, double) { return std::exp(x); });
+	run.Check("Log", "[0.5, 2]", ErrorKind::Absolute, 4e-8, logUnit, LANE_KERNEL(FastMath::Log<L>(L::Load(x + i))),
+		[](const float* x, const float*, float* out, size_t count) { FastMath::Log(x, out, count); },
+		[](double x, double) { return std::log(x); });
+	run.Check("Log", "normal outside [0.5, 2]", ErrorKind::Relative, 8e-8, logOutside, LANE_KERNEL(FastMath::Log<L>(L::Load(x + i))),
+		[](const float* x, const float*, float* out, size_t count) { FastMath::Log(x, out, count); },
+		[](double x, double) { return std::log(x); });
+
+	printf("%s\n", run.GetFailures() ? "FastMath accuracy: FAILED" : "FastMath accuracy: all paths within the documented limits");
+	return run.GetFailures() ? 1 : 0;
+}
@@ -0,0 +1,13 @@
+//Project Name: Benchmark
+//File Name: FastMathAccuracy.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: FastMath accuracy sweep against the C runtime header file
+
+#pragma once
+
+// Sweeps every FastMath approximation against the double-precision C
+// runtime through the scalar, 4-wide, 8-wide and batch paths, prints the
+// worst error per path, and compares it with the table in FastMath.h.
+// Returns the process exit code: 0 when every path is within its limit.
+int RunFastMathAccuracy();
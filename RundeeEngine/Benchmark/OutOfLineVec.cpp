@@ -1,14 +1,14 @@
-//Project Name: RundeeEngine
-//File Name: CommonType.h
+//Project Name: Benchmark
+//File Name: OutOfLineVec.cpp
 //Author: Haneul Lee (a.k.a Rundee)
-//Date: 2025.05.28
-//Description: CommonType classes source file
+//Date: 2026.10.19
+//Description: Out-of-line Vec2/Vec3 baseline source file
 
-#include "../../include/RundeeEngine/Common/CommonType.h"
+#include "OutOfLineVec.h"
 #include <cstdint>
 #include <cmath>
 
-namespace RundeeEngine 
+namespace OutOfLine
 {
 	//----------Vec2 Implementation----------
 
@@ -218,7 +218,7 @@ namespace RundeeEngine
 		return x == 0.0f && y == 0.0f;
 	}
 
-	bool Vec2::IsEqual(const Vec2& other, float epsilon = 1e-6f) const
+	bool Vec2::IsEqual(const Vec2& other, float epsilon) const
 	{
 		return fabsf(x - other.x) < epsilon && fabsf(y - other.y) < epsilon;
 	}
@@ -764,4 +764,4 @@ namespace RundeeEngine
 		float d = planeNormal.Dot(*this - planePoint);
 		return *this - planeNormal * (2.0f * d);
 	}
-}
\ No newline at end of file
+}
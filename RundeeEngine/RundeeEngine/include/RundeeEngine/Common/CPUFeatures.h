@@ -0,0 +1,57 @@
+//Project Name: RundeeEngine
+//File Name: CPUFeatures.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Runtime CPU instruction set detection header file
+
+#pragma once
+
+namespace RundeeEngine
+{
+	// Instruction set tiers kernels are dispatched on, in increasing order.
+	// AVX2 includes FMA and F16C; AVX512 is F, BW, DQ and VL.
+	enum class SimdLevel
+	{
+		Scalar,
+		SSE2,
+		SSE42,
+		AVX2,
+		AVX512
+	};
+
+	struct CPUFeatureFlags
+	{
+		bool SSE2 = false;
+		bool SSE3 = false;
+		bool SSSE3 = false;
+		bool SSE41 = false;
+		bool SSE42 = false;
+		bool POPCNT = false;
+		bool AVX = false;
+		bool AVX2 = false;
+		bool FMA = false;
+		bool F16C = false;
+		bool BMI1 = false;
+		bool BMI2 = false;
+		bool AVX512F = false;
+		bool AVX512BW = false;
+		bool AVX512DQ = false;
+		bool AVX512VL = false;
+	};
+
+	// cpuid, read once. AVX and AVX-512 are only reported when the OS saves
+	// their registers (xgetbv). Non-x86 builds report nothing.
+	class CPUFeatures
+	{
+	public:
+		static const CPUFeatureFlags& Get();
+		// Best tier the CPU supports, lowered by the RUNDEE_SIMD environment
+		// variable ("scalar", "sse2", "sse4.2", "avx2" or "avx512") if set
+		static SimdLevel GetLevel();
+		// Best tier the CPU supports, ignoring the environment
+		static SimdLevel GetDetectedLevel();
+		static const char* GetLevelName(SimdLevel level);
+		// e.g. "AMD Ryzen 9 7950X 16-Core Processor", empty if unavailable
+		static const char* GetBrandString();
+	};
+}
@@ -5,49 +5,55 @@
 //Description: CommonType classes header file
 
 #pragma once
+#include <cmath>
 
 namespace RundeeEngine {
 	struct Vec2 
 	{
 		float x, y;
-		Vec2(float x = 0.0f, float y = 0.0f) : x(x), y(y) {}
+		constexpr Vec2(float x = 0.0f, float y = 0.0f) : x(x), y(y) {}
 
-		bool operator==(const Vec2& other) const;
-		bool operator!=(const Vec2& other) const;
+		static constexpr Vec2 Zero() { return Vec2(0.0f, 0.0f); }
+		static constexpr Vec2 One() { return Vec2(1.0f, 1.0f); }
+		static constexpr Vec2 UnitX() { return Vec2(1.0f, 0.0f); }
+		static constexpr Vec2 UnitY() { return Vec2(0.0f, 1.0f); }
 
-		Vec2 operator+(const Vec2& other) const;
-		Vec2 operator-(const Vec2& other) const;
-		Vec2 operator*(float scalar) const;
-		Vec2 operator/(float scalar) const;
-		Vec2& operator+=(const Vec2& other);
-		Vec2& operator-=(const Vec2& other);
-		Vec2& operator*=(float scalar);
-		Vec2& operator/=(float scalar);
+		constexpr bool operator==(const Vec2& other) const;
+		constexpr bool operator!=(const Vec2& other) const;
+
+		constexpr Vec2 operator+(const Vec2& other) const;
+		constexpr Vec2 operator-(const Vec2& other) const;
+		constexpr Vec2 operator*(float scalar) const;
+		constexpr Vec2 operator/(float scalar) const;
+		constexpr Vec2& operator+=(const Vec2& other);
+		constexpr Vec2& operator-=(const Vec2& other);
+		constexpr Vec2& operator*=(float scalar);
+		constexpr Vec2& operator/=(float scalar);
 
 		float Length() const;
-		float LengthSquared() const;
+		constexpr float LengthSquared() const;
 		Vec2 Normalize() const;
 
-		float Dot(const Vec2& other) const;
-		float Cross(const Vec2& other) const;
+		constexpr float Dot(const Vec2& other) const;
+		constexpr float Cross(const Vec2& other) const;
 		float Distance(const Vec2& other) const;
-		float DistanceSquared(const Vec2& other) const;
+		constexpr float DistanceSquared(const Vec2& other) const;
 
-		Vec2 Perpendicular() const;
+		constexpr Vec2 Perpendicular() const;
 		Vec2 Rotate(float angle) const;
-		Vec2 Lerp(const Vec2& other, float t) const;
+		constexpr Vec2 Lerp(const Vec2& other, float t) const;
 		Vec2 Clamp(const Vec2& min, const Vec2& max) const;
-		Vec2 Reflect(const Vec2& normal) const;
-		Vec2 Project(const Vec2& other) const;
+		constexpr Vec2 Reflect(const Vec2& normal) const;
+		constexpr Vec2 Project(const Vec2& other) const;
 		Vec2 RotateAround(const Vec2& point, float angle) const;
-		Vec2 operator-() const;
-		Vec2 operator*(const Vec2& other) const;
-		Vec2 operator/(const Vec2& other) const;
-		Vec2& operator*=(const Vec2& other);
-		Vec2& operator/=(const Vec2& other);
+		constexpr Vec2 operator-() const;
+		constexpr Vec2 operator*(const Vec2& other) const;
+		constexpr Vec2 operator/(const Vec2& other) const;
+		constexpr Vec2& operator*=(const Vec2& other);
+		constexpr Vec2& operator/=(const Vec2& other);
 
-		bool IsZero() const;
-		bool IsEqual(const Vec2& other, float epsilon) const;
+		constexpr bool IsZero() const;
+		bool IsEqual(const Vec2& other, float epsilon = 1e-6f) const;
 
 		float Angle() const;
 		float Angle(const Vec2& other) const;
@@ -57,7 +63,7 @@ namespace RundeeEngine {
 		float AngleRad(const Vec2& other) const;
 		float DistanceToLine(const Vec2& lineStart, const Vec2& lineEnd) const;
 		float DistanceToLineSquared(const Vec2& lineStart, const Vec2& lineEnd) const;
-		float AngleToLine(const Vec2& lineStart, const Vec2& lineEnd)const;
+		float AngleToLine(const Vec2& lineStart, const Vec2& lineEnd) const;
 		float AngleToLineDeg(const Vec2& lineStart, const Vec2& lineEnd) const;
 		float AngleToLineRad(const Vec2& lineStart, const Vec2& lineEnd) const;
 	};
@@ -65,38 +71,44 @@ namespace RundeeEngine {
 	struct Vec3
 	{
 		float x, y, z;
-		Vec3(float x = 0.0f, float y = 0.0f, float z = 0.0f) : x(x), y(y), z(z) {}
-
-		bool operator==(const Vec3& other) const;
-		bool operator!=(const Vec3& other) const;
-		Vec3 operator+(const Vec3& other) const;
-		Vec3 operator-(const Vec3& other) const;
-		Vec3 operator*(float scalar) const;
-		Vec3 operator/(float scalar) const;
-		Vec3& operator+=(const Vec3& other);
-		Vec3& operator-=(const Vec3& other);
-		Vec3& operator*=(float scalar);
-		Vec3& operator/=(float scalar);
+		constexpr Vec3(float x = 0.0f, float y = 0.0f, float z = 0.0f) : x(x), y(y), z(z) {}
+
+		static constexpr Vec3 Zero() { return Vec3(0.0f, 0.0f, 0.0f); }
+		static constexpr Vec3 One() { return Vec3(1.0f, 1.0f, 1.0f); }
+		static constexpr Vec3 UnitX() { return Vec3(1.0f, 0.0f, 0.0f); }
+		static constexpr Vec3 UnitY() { return Vec3(0.0f, 1.0f, 0.0f); }
+		static constexpr Vec3 UnitZ() { return Vec3(0.0f, 0.0f, 1.0f); }
+
+		constexpr bool operator==(const Vec3& other) const;
+		constexpr bool operator!=(const Vec3& other) const;
+		constexpr Vec3 operator+(const Vec3& other) const;
+		constexpr Vec3 operator-(const Vec3& other) const;
+		constexpr Vec3 operator*(float scalar) const;
+		constexpr Vec3 operator/(float scalar) const;
+		constexpr Vec3& operator+=(const Vec3& other);
+		constexpr Vec3& operator-=(const Vec3& other);
+		constexpr Vec3& operator*=(float scalar);
+		constexpr Vec3& operator/=(float scalar);
 		float Length() const;
-		float LengthSquared() const;
+		constexpr float LengthSquared() const;
 		Vec3 Normalize() const;
-		float Dot(const Vec3& other) const;
-		Vec3 Cross(const Vec3& other) const;
+		constexpr float Dot(const Vec3& other) const;
+		constexpr Vec3 Cross(const Vec3& other) const;
 		float Distance(const Vec3& other) const;
-		float DistanceSquared(const Vec3& other) const;
+		constexpr float DistanceSquared(const Vec3& other) const;
 		Vec3 Perpendicular() const;
 		Vec3 Rotate(float angle, const Vec3& axis) const;
-		Vec3 Lerp(const Vec3& other, float t) const;
+		constexpr Vec3 Lerp(const Vec3& other, float t) const;
 		Vec3 Clamp(const Vec3& min, const Vec3& max) const;
-		Vec3 Reflect(const Vec3& normal) const;
-		Vec3 Project(const Vec3& other) const;
+		constexpr Vec3 Reflect(const Vec3& normal) const;
+		constexpr Vec3 Project(const Vec3& other) const;
 		Vec3 RotateAround(const Vec3& point, float angle, const Vec3& axis) const;
-		Vec3 operator-() const;
-		Vec3 operator*(const Vec3& other) const;
-		Vec3 operator/(const Vec3& other) const;
-		Vec3& operator*=(const Vec3& other);
-		Vec3& operator/=(const Vec3& other);
-		bool IsZero() const;
+		constexpr Vec3 operator-() const;
+		constexpr Vec3 operator*(const Vec3& other) const;
+		constexpr Vec3 operator/(const Vec3& other) const;
+		constexpr Vec3& operator*=(const Vec3& other);
+		constexpr Vec3& operator/=(const Vec3& other);
+		constexpr bool IsZero() const;
 		bool IsEqual(const Vec3& other, float epsilon = 1e-6f) const;
 		float Angle() const;
 		float Angle(const Vec3& other) const;
@@ -110,11 +122,766 @@ namespace RundeeEngine {
 		float AngleToLineDeg(const Vec3& lineStart, const Vec3& lineEnd) const;
 		float AngleToLineRad(const Vec3& lineStart, const Vec3& lineEnd) const;
 		float DistanceToPlane(const Vec3& planePoint, const Vec3& planeNormal) const;
-		float DistanceToPlaneSquared(const Vec3& planePoint, const Vec3& planeNormal) const;
+		constexpr float DistanceToPlaneSquared(const Vec3& planePoint, const Vec3& planeNormal) const;
 		float AngleToPlane(const Vec3& planeNormal) const;
 		float AngleToPlaneDeg(const Vec3& planeNormal) const;
 		float AngleToPlaneRad(const Vec3& planeNormal) const;
-		Vec3 ProjectOntoPlane(const Vec3& planePoint, const Vec3& planeNormal) const;
-		Vec3 ReflectAcrossPlane(const Vec3& planePoint, const Vec3& planeNormal) const;
+		constexpr Vec3 ProjectOntoPlane(const Vec3& planePoint, const Vec3& planeNormal) const;
+		constexpr Vec3 ReflectAcrossPlane(const Vec3& planePoint, const Vec3& planeNormal) const;
 	};
-}
\ No newline at end of file
+
+	//----------Vec2 Implementation----------
+
+	constexpr bool Vec2::operator==(const Vec2& other) const
+	{
+		return x == other.x && y == other.y;
+	}
+
+	constexpr bool Vec2::operator!=(const Vec2& other) const
+	{
+		return !(*this == other);
+	}
+
+	constexpr Vec2 Vec2::operator+(const Vec2& other) const
+	{
+		return Vec2(x + other.x, y + other.y);
+	}
+
+	constexpr Vec2 Vec2::operator-(const Vec2& other) const
+	{
+		return Vec2(x - other.x, y - other.y);
+	}
+
+	constexpr Vec2 Vec2::operator*(float scalar) const
+	{
+		return Vec2(x * scalar, y * scalar);
+	}
+
+	constexpr Vec2 Vec2::operator/(float scalar) const
+	{
+		if (scalar != 0.0f)
+		{
+			return Vec2(x / scalar, y / scalar);
+		}
+		else
+		{
+			return Vec2(0.0f, 0.0f);
+
+		}
+	}
+
+	constexpr Vec2& Vec2::operator+=(const Vec2& other)
+	{
+		x += other.x;
+		y += other.y;
+		return *this;
+	}
+
+	constexpr Vec2& Vec2::operator-=(const Vec2& other)
+	{
+		x -= other.x;
+		y -= other.y;
+		return *this;
+	}
+
+	constexpr Vec2& Vec2::operator*=(float scalar)
+	{
+		x *= scalar;
+		y *= scalar;
+		return *this;
+	}
+
+	constexpr Vec2& Vec2::operator/=(float scalar)
+	{
+		if (scalar != 0.0f)
+		{
+			x /= scalar;
+			y /= scalar;
+		}
+		else
+		{
+			x = 0.0f;
+			y = 0.0f;
+		}
+		return *this;
+	}
+
+	inline float Vec2::Length() const
+	{
+		return sqrtf(x * x + y * y);
+	}
+
+	constexpr float Vec2::LengthSquared() const
+	{
+		return x * x + y * y;
+	}
+
+	inline Vec2 Vec2::Normalize() const
+	{
+		float len = Length();
+		if (len > 0.0f)
+		{
+			return Vec2(x / len, y / len);
+		}
+		return Vec2(0.0f, 0.0f);
+	}
+
+	constexpr float Vec2::Dot(const Vec2& other) const
+	{
+		return x * other.x + y * other.y;
+	}
+
+	constexpr float Vec2::Cross(const Vec2& other) const
+	{
+		return x * other.y - y * other.x;
+	}
+
+	inline float Vec2::Distance(const Vec2& other) const
+	{
+		return sqrtf((x - other.x) * (x - other.x) + (y - other.y) * (y - other.y));
+	}
+
+	constexpr float Vec2::DistanceSquared(const Vec2& other) const
+	{
+		return (x - other.x) * (x - other.x) + (y - other.y) * (y - other.y);
+	}
+
+	constexpr Vec2 Vec2::Perpendicular() const
+	{
+		return Vec2(-y, x);
+	}
+
+	inline Vec2 Vec2::Rotate(float angle) const
+	{
+		float rad = angle * (3.14159265358979323846f / 180.0f);
+		float cosA = cosf(rad);
+		float sinA = sinf(rad);
+		return Vec2(x * cosA - y * sinA, x * sinA + y * cosA);
+	}
+
+	constexpr Vec2 Vec2::Lerp(const Vec2& other, float t) const
+	{
+		return Vec2(x + t * (other.x - x), y + t * (other.y - y));
+	}
+
+	inline Vec2 Vec2::Clamp(const Vec2& min, const Vec2& max) const
+	{
+		return Vec2(fmaxf(min.x, fminf(x, max.x)), fmaxf(min.y, fminf(y, max.y)));
+	}
+
+	constexpr Vec2 Vec2::Reflect(const Vec2& normal) const
+	{
+		float dot = Dot(normal);
+		return Vec2(x - 2.0f * dot * normal.x, y - 2.0f * dot * normal.y);
+	}
+
+	constexpr Vec2 Vec2::Project(const Vec2& other) const
+	{
+		float dot = Dot(other);
+		float lenSquared = other.LengthSquared();
+		if (lenSquared > 0.0f)
+		{
+			return other * (dot / lenSquared);
+		}
+		return Vec2(0.0f, 0.0f);
+	}
+
+	inline Vec2 Vec2::RotateAround(const Vec2& point, float angle) const
+	{
+		float rad = angle * (3.14159265358979323846f / 180.0f);
+		float cosA = cosf(rad);
+		float sinA = sinf(rad);
+		float dx = x - point.x;
+		float dy = y - point.y;
+		return Vec2(point.x + dx * cosA - dy * sinA, point.y + dx * sinA + dy * cosA);
+	}
+
+	constexpr Vec2 Vec2::operator-() const
+	{
+		return Vec2(-x, -y);
+	}
+
+	constexpr Vec2 Vec2::operator*(const Vec2& other) const
+	{
+		return Vec2(x * other.x, y * other.y);
+	}
+
+	constexpr Vec2 Vec2::operator/(const Vec2& other) const
+	{
+		return Vec2((other.x != 0.0f) ? x / other.x : 0.0f, (other.y != 0.0f) ? y / other.y : 0.0f);
+	}
+
+	constexpr Vec2& Vec2::operator*=(const Vec2& other)
+	{
+		x *= other.x;
+		y *= other.y;
+		return *this;
+	}
+
+	constexpr Vec2& Vec2::operator/=(const Vec2& other)
+	{
+		if (other.x != 0.0f && other.y != 0.0f)
+		{
+			x /= other.x;
+			y /= other.y;
+		}
+		else
+		{
+			x = 0.0f;
+			y = 0.0f;
+		}
+		return *this;
+	}
+
+	constexpr bool Vec2::IsZero() const
+	{
+		return x == 0.0f && y == 0.0f;
+	}
+
+	inline bool Vec2::IsEqual(const Vec2& other, float epsilon) const
+	{
+		return fabsf(x - other.x) < epsilon && fabsf(y - other.y) < epsilon;
+	}
+
+	inline float Vec2::Angle() const
+	{
+		return atan2f(y, x) * (180.0f / 3.14159265358979323846f);
+	}
+
+	inline float Vec2::Angle(const Vec2& other) const
+	{
+		float dot = Dot(other);
+		float len1 = Length();
+		float len2 = other.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec2::AngleDeg() const
+	{
+		return atan2f(y, x) * (180.0f / 3.14159265358979323846f);
+	}
+
+	inline float Vec2::AngleDeg(const Vec2& other) const
+	{
+		float dot = Dot(other);
+		float len1 = Length();
+		float len2 = other.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec2::AngleRad() const
+	{
+		return atan2f(y, x);
+	}
+
+	inline float Vec2::AngleRad(const Vec2& other) const
+	{
+		float dot = Dot(other);
+		float len1 = Length();
+		float len2 = other.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2));
+		}
+		return 0.0f;
+	}
+
+	inline float Vec2::DistanceToLine(const Vec2& lineStart, const Vec2& lineEnd) const
+	{
+		Vec2 lineDir = lineEnd - lineStart;
+		Vec2 pointDir = *this - lineStart;
+		float lineLengthSquared = lineDir.LengthSquared();
+		if (lineLengthSquared == 0.0f)
+		{
+			return pointDir.Length();
+		}
+		float t = fmaxf(0.0f, fminf(1.0f, pointDir.Dot(lineDir) / lineLengthSquared));
+		Vec2 projection = lineStart + lineDir * t;
+		return (*this - projection).Length();
+	}
+
+	inline float Vec2::DistanceToLineSquared(const Vec2& lineStart, const Vec2& lineEnd) const
+	{
+		Vec2 lineDir = lineEnd - lineStart;
+		Vec2 pointDir = *this - lineStart;
+		float lineLengthSquared = lineDir.LengthSquared();
+		if (lineLengthSquared == 0.0f)
+		{
+			return pointDir.LengthSquared();
+		}
+		float t = fmaxf(0.0f, fminf(1.0f, pointDir.Dot(lineDir) / lineLengthSquared));
+		Vec2 projection = lineStart + lineDir * t;
+		return (*this - projection).LengthSquared();
+	}
+
+	inline float Vec2::AngleToLine(const Vec2& lineStart, const Vec2& lineEnd) const
+	{
+		Vec2 lineDir = lineEnd - lineStart;
+		float dot = Dot(lineDir);
+		float len1 = Length();
+		float len2 = lineDir.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec2::AngleToLineDeg(const Vec2& lineStart, const Vec2& lineEnd) const
+	{
+		Vec2 lineDir = lineEnd - lineStart;
+		float dot = Dot(lineDir);
+		float len1 = Length();
+		float len2 = lineDir.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec2::AngleToLineRad(const Vec2& lineStart, const Vec2& lineEnd) const
+	{
+		Vec2 lineDir = lineEnd - lineStart;
+		float dot = Dot(lineDir);
+		float len1 = Length();
+		float len2 = lineDir.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2));
+		}
+		return 0.0f;
+	}
+
+	//----------Vec3 Implementation----------
+
+	constexpr bool Vec3::operator==(const Vec3& other) const
+	{
+		return x == other.x && y == other.y && z == other.z;
+	}
+
+	constexpr bool Vec3::operator!=(const Vec3& other) const
+	{
+		return !(*this == other);
+	}
+
+	constexpr Vec3 Vec3::operator+(const Vec3& other) const
+	{
+		return Vec3(x + other.x, y + other.y, z + other.z);
+	}
+
+	constexpr Vec3 Vec3::operator-(const Vec3& other) const
+	{
+		return Vec3(x - other.x, y - other.y, z - other.z);
+	}
+
+	constexpr Vec3 Vec3::operator*(float scalar) const
+	{
+		return Vec3(x * scalar, y * scalar, z * scalar);
+	}
+
+	constexpr Vec3 Vec3::operator/(float scalar) const
+	{
+		if (scalar != 0.0f)
+		{
+			return Vec3(x / scalar, y / scalar, z / scalar);
+		}
+		else
+		{
+			return Vec3(0.0f, 0.0f, 0.0f);
+		}
+	}
+
+	constexpr Vec3& Vec3::operator+=(const Vec3& other)
+	{
+		x += other.x;
+		y += other.y;
+		z += other.z;
+		return *this;
+	}
+
+	constexpr Vec3& Vec3::operator-=(const Vec3& other)
+	{
+		x -= other.x;
+		y -= other.y;
+		z -= other.z;
+		return *this;
+	}
+
+	constexpr Vec3& Vec3::operator*=(float scalar)
+	{
+		x *= scalar;
+		y *= scalar;
+		z *= scalar;
+		return *this;
+	}
+
+	constexpr Vec3& Vec3::operator/=(float scalar)
+	{
+		if (scalar != 0.0f)
+		{
+			x /= scalar;
+			y /= scalar;
+			z /= scalar;
+		}
+		else
+		{
+			x = 0.0f;
+			y = 0.0f;
+			z = 0.0f;
+		}
+		return *this;
+	}
+
+	inline float Vec3::Length() const
+	{
+		return sqrtf(x * x + y * y + z * z);
+	}
+
+	constexpr float Vec3::LengthSquared() const
+	{
+		return x * x + y * y + z * z;
+	}
+
+	inline Vec3 Vec3::Normalize() const
+	{
+		float len = Length();
+		if (len > 0.0f)
+		{
+			return Vec3(x / len, y / len, z / len);
+		}
+		return Vec3(0.0f, 0.0f, 0.0f);
+	}
+
+	constexpr float Vec3::Dot(const Vec3& other) const
+	{
+		return x * other.x + y * other.y + z * other.z;
+	}
+
+	constexpr Vec3 Vec3::Cross(const Vec3& other) const
+	{
+		return Vec3(
+			y * other.z - z * other.y,
+			z * other.x - x * other.z,
+			x * other.y - y * other.x
+		);
+	}
+
+	inline float Vec3::Distance(const Vec3& other) const
+	{
+		return sqrtf((x - other.x) * (x - other.x) + (y - other.y) * (y - other.y) + (z - other.z) * (z - other.z));
+	}
+
+	constexpr float Vec3::DistanceSquared(const Vec3& other) const
+	{
+		return (x - other.x) * (x - other.x) + (y - other.y) * (y - other.y) + (z - other.z) * (z - other.z);
+	}
+
+	inline Vec3 Vec3::Perpendicular() const
+	{
+		if (fabsf(x) > fabsf(y) && fabsf(x) > fabsf(z))
+		{
+			return Vec3(0.0f, z, -y).Normalize();
+		}
+		else if (fabsf(y) > fabsf(z))
+		{
+			return Vec3(-z, 0.0f, x).Normalize();
+		}
+		else
+		{
+			return Vec3(y, -x, 0.0f).Normalize();
+		}
+	}
+
+	inline Vec3 Vec3::Rotate(float angle, const Vec3& axis) const
+	{
+		float rad = angle * (3.14159265358979323846f / 180.0f);
+		float cosA = cosf(rad);
+		float sinA = sinf(rad);
+		float dot = Dot(axis);
+		Vec3 cross = Cross(axis);
+		return Vec3(
+			x * cosA + cross.x * sinA + axis.x * dot * (1 - cosA),
+			y * cosA + cross.y * sinA + axis.y * dot * (1 - cosA),
+			z * cosA + cross.z * sinA + axis.z * dot * (1 - cosA)
+		);
+	}
+
+	constexpr Vec3 Vec3::Lerp(const Vec3& other, float t) const
+	{
+		return Vec3(x + t * (other.x - x), y + t * (other.y - y), z + t * (other.z - z));
+	}
+
+	inline Vec3 Vec3::Clamp(const Vec3& min, const Vec3& max) const
+	{
+		return Vec3(fmaxf(min.x, fminf(x, max.x)), fmaxf(min.y, fminf(y, max.y)), fmaxf(min.z, fminf(z, max.z)));
+	}
+
+	constexpr Vec3 Vec3::Reflect(const Vec3& normal) const
+	{
+		float dot = Dot(normal);
+		return Vec3(x - 2.0f * dot * normal.x, y - 2.0f * dot * normal.y, z - 2.0f * dot * normal.z);
+	}
+
+	constexpr Vec3 Vec3::Project(const Vec3& other) const
+	{
+		float dot = Dot(other);
+		float lenSquared = other.LengthSquared();
+		if (lenSquared > 0.0f)
+		{
+			return other * (dot / lenSquared);
+		}
+		return Vec3(0.0f, 0.0f, 0.0f);
+	}
+
+	inline Vec3 Vec3::RotateAround(const Vec3& point, float angle, const Vec3& axis) const
+	{
+		float rad = angle * (3.14159265358979323846f / 180.0f);
+		float cosA = cosf(rad);
+		float sinA = sinf(rad);
+		float dx = x - point.x;
+		float dy = y - point.y;
+		float dz = z - point.z;
+		return Vec3(
+			point.x + (dx * (cosA + axis.x * axis.x * (1 - cosA)) + dy * (axis.x * axis.y * (1 - cosA) - axis.z * sinA) + dz * (axis.x * axis.z * (1 - cosA) + axis.y * sinA)),
+			point.y + (dx * (axis.y * axis.x * (1 - cosA) + axis.z * sinA) + dy * (cosA + axis.y * axis.y * (1 - cosA)) + dz * (axis.y * axis.z * (1 - cosA) - axis.x * sinA)),
+			point.z + (dx * (axis.z * axis.x * (1 - cosA) - axis.y * sinA) + dy * (axis.z * axis.y * (1 - cosA) + axis.x * sinA) + dz * (cosA + axis.z * axis.z * (1 - cosA)))
+		);
+	}
+
+	constexpr Vec3 Vec3::operator-() const
+	{
+		return Vec3(-x, -y, -z);
+	}
+
+	constexpr Vec3 Vec3::operator*(const Vec3& other) const
+	{
+		return Vec3(x * other.x, y * other.y, z * other.z);
+	}
+
+	constexpr Vec3 Vec3::operator/(const Vec3& other) const
+	{
+		return Vec3((other.x != 0.0f) ? x / other.x : 0.0f, (other.y != 0.0f) ? y / other.y : 0.0f, (other.z != 0.0f) ? z / other.z : 0.0f);
+	}
+
+	constexpr Vec3& Vec3::operator*=(const Vec3& other)
+	{
+		x *= other.x;
+		y *= other.y;
+		z *= other.z;
+		return *this;
+	}
+
+	constexpr Vec3& Vec3::operator/=(const Vec3& other)
+	{
+		if (other.x != 0.0f && other.y != 0.0f && other.z != 0.0f)
+		{
+			x /= other.x;
+			y /= other.y;
+			z /= other.z;
+		}
+		else
+		{
+			x = 0.0f;
+			y = 0.0f;
+			z = 0.0f;
+		}
+		return *this;
+	}
+
+	constexpr bool Vec3::IsZero() const
+	{
+		return x == 0.0f && y == 0.0f && z == 0.0f;
+	}
+
+	inline bool Vec3::IsEqual(const Vec3& other, float epsilon) const
+	{
+		return fabsf(x - other.x) < epsilon && fabsf(y - other.y) < epsilon && fabsf(z - other.z) < epsilon;
+	}
+
+	inline float Vec3::Angle() const
+	{
+		return atan2f(sqrtf(x * x + y * y), z) * (180.0f / 3.14159265358979323846f);
+	}
+
+	inline float Vec3::Angle(const Vec3& other) const
+	{
+		float dot = Dot(other);
+		float len1 = Length();
+		float len2 = other.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec3::AngleDeg() const
+	{
+		return atan2f(sqrtf(x * x + y * y), z) * (180.0f / 3.14159265358979323846f);
+	}
+
+	inline float Vec3::AngleDeg(const Vec3& other) const
+	{
+		float dot = Dot(other);
+		float len1 = Length();
+		float len2 = other.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec3::AngleRad() const
+	{
+		return atan2f(sqrtf(x * x + y * y), z);
+	}
+
+	inline float Vec3::AngleRad(const Vec3& other) const
+	{
+		float dot = Dot(other);
+		float len1 = Length();
+		float len2 = other.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2));
+		}
+		return 0.0f;
+	}
+
+	inline float Vec3::DistanceToLine(const Vec3& lineStart, const Vec3& lineEnd) const
+	{
+		Vec3 lineDir = lineEnd - lineStart;
+		Vec3 pointDir = *this - lineStart;
+		float lineLengthSquared = lineDir.LengthSquared();
+		if (lineLengthSquared == 0.0f)
+		{
+			return pointDir.Length();
+		}
+		float t = fmaxf(0.0f, fminf(1.0f, pointDir.Dot(lineDir) / lineLengthSquared));
+		Vec3 projection = lineStart + lineDir * t;
+		return (*this - projection).Length();
+	}
+
+	inline float Vec3::DistanceToLineSquared(const Vec3& lineStart, const Vec3& lineEnd) const
+	{
+		Vec3 lineDir = lineEnd - lineStart;
+		Vec3 pointDir = *this - lineStart;
+		float lineLengthSquared = lineDir.LengthSquared();
+		if (lineLengthSquared == 0.0f)
+		{
+			return pointDir.LengthSquared();
+		}
+		float t = fmaxf(0.0f, fminf(1.0f, pointDir.Dot(lineDir) / lineLengthSquared));
+		Vec3 projection = lineStart + lineDir * t;
+		return (*this - projection).LengthSquared();
+	}
+
+	inline float Vec3::AngleToLine(const Vec3& lineStart, const Vec3& lineEnd) const
+	{
+		Vec3 lineDir = lineEnd - lineStart;
+		float dot = Dot(lineDir);
+		float len1 = Length();
+		float len2 = lineDir.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec3::AngleToLineDeg(const Vec3& lineStart, const Vec3& lineEnd) const
+	{
+		Vec3 lineDir = lineEnd - lineStart;
+		float dot = Dot(lineDir);
+		float len1 = Length();
+		float len2 = lineDir.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec3::AngleToLineRad(const Vec3& lineStart, const Vec3& lineEnd) const
+	{
+		Vec3 lineDir = lineEnd - lineStart;
+		float dot = Dot(lineDir);
+		float len1 = Length();
+		float len2 = lineDir.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2));
+		}
+		return 0.0f;
+	}
+
+	inline float Vec3::DistanceToPlane(const Vec3& planePoint, const Vec3& planeNormal) const
+	{
+		float d = planeNormal.Dot(*this - planePoint);
+		return fabsf(d);
+	}
+
+	constexpr float Vec3::DistanceToPlaneSquared(const Vec3& planePoint, const Vec3& planeNormal) const
+	{
+		float d = planeNormal.Dot(*this - planePoint);
+		return d * d;
+	}
+
+	inline float Vec3::AngleToPlane(const Vec3& planeNormal) const
+	{
+		float dot = Dot(planeNormal);
+		float len1 = Length();
+		float len2 = planeNormal.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec3::AngleToPlaneDeg(const Vec3& planeNormal) const
+	{
+		float dot = Dot(planeNormal);
+		float len1 = Length();
+		float len2 = planeNormal.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2)) * (180.0f / 3.14159265358979323846f);
+		}
+		return 0.0f;
+	}
+
+	inline float Vec3::AngleToPlaneRad(const Vec3& planeNormal) const
+	{
+		float dot = Dot(planeNormal);
+		float len1 = Length();
+		float len2 = planeNormal.Length();
+		if (len1 > 0.0f && len2 > 0.0f)
+		{
+			return acosf(dot / (len1 * len2));
+		}
+		return 0.0f;
+	}
+
+	constexpr Vec3 Vec3::ProjectOntoPlane(const Vec3& planePoint, const Vec3& planeNormal) const
+	{
+		float d = planeNormal.Dot(*this - planePoint);
+		return *this - planeNormal * d;
+	}
+
+	constexpr Vec3 Vec3::ReflectAcrossPlane(const Vec3& planePoint, const Vec3& planeNormal) const
+	{
+		float d = planeNormal.Dot(*this - planePoint);
+		return *this - planeNormal * (2.0f * d);
+	}
+}
@@ -0,0 +1,200 @@
+//Project Name: RundeeEngine
+//File Name: SlotMap.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Generational handle slot map header file
+
+#pragma once
+#include "../Logger.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace RundeeEngine
+{
+	// Index in the low bits, generation in the high bits. A value of 0 is
+	// never handed out, so a default-constructed handle is always invalid.
+	template<typename TValue, uint32_t IndexBits>
+	struct SlotHandle
+	{
+		static constexpr uint32_t GenerationBits = sizeof(TValue) * 8 - IndexBits;
+		static constexpr uint32_t MaxIndex = static_cast<uint32_t>((TValue(1) << IndexBits) - 1);
+		static constexpr uint32_t MaxGeneration = static_cast<uint32_t>((TValue(1) << GenerationBits) - 1);
+
+		TValue Value = 0;
+
+		constexpr SlotHandle() = default;
+		constexpr SlotHandle(uint32_t index, uint32_t generation)
+			: Value(static_cast<TValue>(index) | (static_cast<TValue>(generation) << IndexBits))
+		{
+		}
+
+		constexpr uint32_t Index() const { return static_cast<uint32_t>(Value & MaxIndex); }
+		constexpr uint32_t Generation() const { return static_cast<uint32_t>(Value >> IndexBits); }
+		constexpr bool IsValid() const { return Value != 0; }
+
+		constexpr bool operator==(const SlotHandle& other) const { return Value == other.Value; }
+		constexpr bool operator!=(const SlotHandle& other) const { return Value != other.Value; }
+	};
+
+	// 1M live slots with 4096 generations, or 4G slots with 4G generations
+	using SlotHandle32 = SlotHandle<uint32_t, 20>;
+	using SlotHandle64 = SlotHandle<uint64_t, 32>;
+
+	// Objects live densely in insertion order (modulo swap-on-erase) so
+	// iteration is a linear walk. Handles go through a sparse slot array
+	// that records each object's dense index and the slot's generation;
+	// erasing bumps the generation so stale handles stop resolving.
+	template<typename T, typename THandle = SlotHandle64>
+	class SlotMap
+	{
+	public:
+		using Handle = THandle;
+		using iterator = typename std::pmr::vector<T>::iterator;
+		using const_iterator = typename std::pmr::vector<T>::const_iterator;
+
+		explicit SlotMap(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+			: m_Values(resource)
+			, m_DenseToSlot(resource)
+			, m_Slots(resource)
+			, m_FreeHead(InvalidIndex)
+		{
+		}
+
+		template<typename... Args>
+		Handle Emplace(Args&&... args)
+		{
+			uint32_t slotIndex = m_FreeHead;
+			if (slotIndex == InvalidIndex)
+			{
+				if (m_Slots.size() >= Handle::MaxIndex)
+				{
+					Logger::Error("SlotMap: out of handle indices.");
+					return Handle();
+				}
+				slotIndex = static_cast<uint32_t>(m_Slots.size());
+				m_Slots.push_back(Slot{ 0, 1 });
+			}
+			else
+			{
+				m_FreeHead = m_Slots[slotIndex].DenseIndex;
+			}
+
+			Slot& slot = m_Slots[slotIndex];
+			slot.DenseIndex = static_cast<uint32_t>(m_Values.size());
+			m_Values.emplace_back(std::forward<Args>(args)...);
+			m_DenseToSlot.push_back(slotIndex);
+			return Handle(slotIndex, slot.Generation);
+		}
+
+		Handle Insert(const T& value) { return Emplace(value); }
+		Handle Insert(T&& value) { return Emplace(std::move(value)); }
+
+		bool Erase(Handle handle)
+		{
+			if (!Contains(handle))
+			{
+				return false;
+			}
+
+			uint32_t slotIndex = handle.Index();
+			uint32_t denseIndex = m_Slots[slotIndex].DenseIndex;
+			uint32_t lastIndex = static_cast<uint32_t>(m_Values.size() - 1);
+
+			if (denseIndex != lastIndex)
+			{
+				m_Values[denseIndex] = std::move(m_Values[lastIndex]);
+				m_DenseToSlot[denseIndex] = m_DenseToSlot[lastIndex];
+				m_Slots[m_DenseToSlot[denseIndex]].DenseIndex = denseIndex;
+			}
+			m_Values.pop_back();
+			m_DenseToSlot.pop_back();
+
+			// Generation 0 is reserved so a live handle never encodes to 0
+			Slot& slot = m_Slots[slotIndex];
+			slot.Generation = slot.Generation == Handle::MaxGeneration ? 1 : slot.Generation + 1;
+			slot.DenseIndex = m_FreeHead;
+			m_FreeHead = slotIndex;
+			return true;
+		}
+
+		// Generations wrap, so a stale handle can match a free slot again;
+		// the slot must also be the one its dense entry points back to.
+		bool Contains(Handle handle) const
+		{
+			uint32_t slotIndex = handle.Index();
+			if (!handle.IsValid() || slotIndex >= m_Slots.size())
+			{
+				return false;
+			}
+
+			const Slot& slot = m_Slots[slotIndex];
+			return slot.Generation == handle.Generation() && slot.DenseIndex < m_DenseToSlot.size() && m_DenseToSlot[slot.DenseIndex] == slotIndex;
+		}
+
+		T* Get(Handle handle)
+		{
+			return Contains(handle) ? &m_Values[m_Slots[handle.Index()].DenseIndex] : nullptr;
+		}
+
+		const T* Get(Handle handle) const
+		{
+			return Contains(handle) ? &m_Values[m_Slots[handle.Index()].DenseIndex] : nullptr;
+		}
+
+		// Handle of the object at a dense position, for iteration that needs identity
+		Handle GetHandle(size_t denseIndex) const
+		{
+			uint32_t slotIndex = m_DenseToSlot[denseIndex];
+			return Handle(slotIndex, m_Slots[slotIndex].Generation);
+		}
+
+		void Reserve(size_t count)
+		{
+			m_Values.reserve(count);
+			m_DenseToSlot.reserve(count);
+			m_Slots.reserve(count);
+		}
+
+		void Clear()
+		{
+			for (uint32_t denseIndex = 0; denseIndex < m_DenseToSlot.size(); ++denseIndex)
+			{
+				Slot& slot = m_Slots[m_DenseToSlot[denseIndex]];
+				slot.Generation = slot.Generation == Handle::MaxGeneration ? 1 : slot.Generation + 1;
+				slot.DenseIndex = m_FreeHead;
+				m_FreeHead = m_DenseToSlot[denseIndex];
+			}
+			m_Values.clear();
+			m_DenseToSlot.clear();
+		}
+
+		size_t Size() const { return m_Values.size(); }
+		bool IsEmpty() const { return m_Values.empty(); }
+
+		T* Data() { return m_Values.data(); }
+		const T* Data() const { return m_Values.data(); }
+
+		iterator begin() { return m_Values.begin(); }
+		iterator end() { return m_Values.end(); }
+		const_iterator begin() const { return m_Values.begin(); }
+		const_iterator end() const { return m_Values.end(); }
+
+	private:
+		static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+		struct Slot
+		{
+			// Dense position while live, next free slot while on the free list
+			uint32_t DenseIndex;
+			uint32_t Generation;
+		};
+
+		std::pmr::vector<T> m_Values;
+		std::pmr::vector<uint32_t> m_DenseToSlot;
+		std::pmr::vector<Slot> m_Slots;
+		uint32_t m_FreeHead;
+	};
+}
@@ -0,0 +1,178 @@
+//Project Name: RundeeEngine
+//File Name: VirtualArray.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Address-stable growable array header file
+
+#pragma once
+#include "../Logger.h"
+#include "../Memory/MemoryTracker.h"
+#include "../Memory/VirtualMemory.h"
+#include <cstddef>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace RundeeEngine
+{
+	// Reserves address space for maxCount elements up front and commits
+	// pages only as the array grows, so growth never copies and element
+	// addresses stay valid for the array's lifetime. ShrinkToFit hands the
+	// pages past Size() back to the OS.
+	template<typename T>
+	class VirtualArray
+	{
+	public:
+		explicit VirtualArray(size_t maxCount, MemoryTag tag = MemoryTag::General)
+			: m_Data(nullptr)
+			, m_Size(0)
+			, m_MaxCount(maxCount)
+			, m_ReservedBytes(AlignUp(maxCount * sizeof(T), GetCommitGranularity()))
+			, m_CommittedBytes(0)
+			, m_Tag(tag)
+		{
+			m_Data = static_cast<T*>(VirtualMemory::Reserve(m_ReservedBytes));
+			if (!m_Data)
+			{
+				m_MaxCount = 0;
+				m_ReservedBytes = 0;
+			}
+		}
+
+		~VirtualArray()
+		{
+			Clear();
+			MemoryTracker::RecordFree(m_Tag, m_CommittedBytes);
+			VirtualMemory::Release(m_Data, m_ReservedBytes);
+		}
+
+		VirtualArray(const VirtualArray&) = delete;
+		VirtualArray& operator=(const VirtualArray&) = delete;
+
+		// Returns nullptr once maxCount is reached or pages cannot be committed
+		template<typename... Args>
+		T* EmplaceBack(Args&&... args)
+		{
+			if (!EnsureCommitted(m_Size + 1))
+			{
+				return nullptr;
+			}
+			T* element = new (m_Data + m_Size) T(std::forward<Args>(args)...);
+			++m_Size;
+			return element;
+		}
+
+		T* PushBack(const T& value) { return EmplaceBack(value); }
+		T* PushBack(T&& value) { return EmplaceBack(std::move(value)); }
+
+		void PopBack()
+		{
+			if (m_Size > 0)
+			{
+				m_Data[--m_Size].~T();
+			}
+		}
+
+		bool Resize(size_t count)
+		{
+			if (count > m_Size && !EnsureCommitted(count))
+			{
+				return false;
+			}
+
+			while (m_Size > count)
+			{
+				m_Data[--m_Size].~T();
+			}
+			while (m_Size < count)
+			{
+				new (m_Data + m_Size) T();
+				++m_Size;
+			}
+			return true;
+		}
+
+		bool Reserve(size_t count)
+		{
+			return EnsureCommitted(count);
+		}
+
+		void Clear()
+		{
+			while (m_Size > 0)
+			{
+				m_Data[--m_Size].~T();
+			}
+		}
+
+		void ShrinkToFit()
+		{
+			size_t neededBytes = AlignUp(m_Size * sizeof(T), GetCommitGranularity());
+			if (neededBytes >= m_CommittedBytes)
+			{
+				return;
+			}
+
+			VirtualMemory::Decommit(reinterpret_cast<char*>(m_Data) + neededBytes, m_CommittedBytes - neededBytes);
+			MemoryTracker::RecordFree(m_Tag, m_CommittedBytes - neededBytes);
+			m_CommittedBytes = neededBytes;
+		}
+
+		T& operator[](size_t index) { return m_Data[index]; }
+		const T& operator[](size_t index) const { return m_Data[index]; }
+
+		T* Data() { return m_Data; }
+		const T* Data() const { return m_Data; }
+
+		size_t Size() const { return m_Size; }
+		size_t Capacity() const { return m_CommittedBytes / sizeof(T); }
+		size_t MaxSize() const { return m_MaxCount; }
+		size_t GetCommittedBytes() const { return m_CommittedBytes; }
+		bool IsEmpty() const { return m_Size == 0; }
+
+		T* begin() { return m_Data; }
+		T* end() { return m_Data + m_Size; }
+		const T* begin() const { return m_Data; }
+		const T* end() const { return m_Data + m_Size; }
+
+	private:
+		// Commit in 64KB steps so a push_back loop is not one syscall per page
+		static size_t GetCommitGranularity()
+		{
+			size_t pageSize = VirtualMemory::GetPageSize();
+			return pageSize > 65536 ? pageSize : 65536;
+		}
+
+		bool EnsureCommitted(size_t count)
+		{
+			if (count > m_MaxCount)
+			{
+				Logger::Error("VirtualArray: capacity of " + std::to_string(m_MaxCount) + " elements exceeded.");
+				return false;
+			}
+
+			size_t neededBytes = count * sizeof(T);
+			if (neededBytes <= m_CommittedBytes)
+			{
+				return true;
+			}
+
+			neededBytes = AlignUp(neededBytes, GetCommitGranularity());
+			if (!VirtualMemory::Commit(reinterpret_cast<char*>(m_Data) + m_CommittedBytes, neededBytes - m_CommittedBytes))
+			{
+				return false;
+			}
+
+			MemoryTracker::RecordAllocation(m_Tag, neededBytes - m_CommittedBytes);
+			m_CommittedBytes = neededBytes;
+			return true;
+		}
+
+		T* m_Data;
+		size_t m_Size;
+		size_t m_MaxCount;
+		size_t m_ReservedBytes;
+		size_t m_CommittedBytes;
+		MemoryTag m_Tag;
+	};
+}
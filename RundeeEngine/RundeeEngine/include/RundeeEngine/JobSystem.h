@@ -7,6 +7,7 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <thread>
 
 namespace RundeeEngine
@@ -16,11 +17,18 @@ namespace RundeeEngine
 	class JobSystem
 	{
 	public:
-		static void Initialize(size_t threadCount = std::thread::hardware_concurrency());
+		static void Initialize(size_t threadCount = std::thread::hardware_concurrency(), std::pmr::memory_resource* resource = nullptr);
 		static void Shutdown();
 
 		static void Dispatch(const std::function<void()>& job);
 
+		// Splits [0, count) into contiguous ranges of at least batchSize and runs
+		// job(begin, end) on each across the pool and the calling thread, returning
+		// once all have finished. The caller runs queued jobs while it waits, so
+		// nested calls from inside a job do not deadlock. Runs inline when the
+		// JobSystem is not initialized.
+		static void ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t begin, size_t end)>& job);
+
 	private:
 		static std::unique_ptr<ThreadPool> s_ThreadPool;
 	};
@@ -5,6 +5,7 @@
 //Description: Logger class header file
 
 #pragma once
+#include <memory_resource>
 #include <string>
 
 namespace RundeeEngine 
@@ -25,6 +26,9 @@ namespace RundeeEngine
 		static void Warning(const std::string& message);
 		static void Error(const std::string& message);
 
+		// Backs the per-line formatting buffer; nullptr restores the Logging-tagged heap
+		static void SetMemoryResource(std::pmr::memory_resource* resource);
+
 	private:
 		static void Print(const std::string& tag, const std::string& message);
 	};
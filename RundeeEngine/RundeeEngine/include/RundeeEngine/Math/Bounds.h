@@ -0,0 +1,262 @@
+//Project Name: RundeeEngine
+//File Name: Bounds.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Bounding volumes and intersection tests header file
+
+#pragma once
+#include "Mat4.h"
+#include "VecStream.h"
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+
+namespace RundeeEngine
+{
+	// Structure-of-arrays views used by the batch tests. The arrays are not
+	// owned and each holds Count floats.
+	struct AABB2Arrays
+	{
+		const float* MinX;
+		const float* MinY;
+		const float* MaxX;
+		const float* MaxY;
+		size_t Count;
+
+		AABB2Arrays(const float* minX, const float* minY, const float* maxX, const float* maxY, size_t count)
+			: MinX(minX), MinY(minY), MaxX(maxX), MaxY(maxY), Count(count) {}
+	};
+
+	struct AABB3Arrays
+	{
+		const float* MinX;
+		const float* MinY;
+		const float* MinZ;
+		const float* MaxX;
+		const float* MaxY;
+		const float* MaxZ;
+		size_t Count;
+
+		AABB3Arrays(const float* minX, const float* minY, const float* minZ, const float* maxX, const float* maxY, const float* maxZ, size_t count)
+			: MinX(minX), MinY(minY), MinZ(minZ), MaxX(maxX), MaxY(maxY), MaxZ(maxZ), Count(count) {}
+		// mins and maxs must be the same size
+		AABB3Arrays(const Vec3Stream& mins, const Vec3Stream& maxs)
+			: AABB3Arrays(mins.X(), mins.Y(), mins.Z(), maxs.X(), maxs.Y(), maxs.Z(), mins.Size()) {}
+	};
+
+	struct SphereArrays
+	{
+		const float* CenterX;
+		const float* CenterY;
+		const float* CenterZ;
+		const float* Radius;
+		size_t Count;
+
+		SphereArrays(const float* centerX, const float* centerY, const float* centerZ, const float* radius, size_t count)
+			: CenterX(centerX), CenterY(centerY), CenterZ(centerZ), Radius(radius), Count(count) {}
+		SphereArrays(const Vec3Stream& centers, const float* radius)
+			: SphereArrays(centers.X(), centers.Y(), centers.Z(), radius, centers.Size()) {}
+	};
+
+	// Touching boxes count as overlapping throughout. Batch tests write one
+	// byte per object (1 = hit) and run 8 or 4 objects per instruction.
+	struct AABB2
+	{
+		Vec2 Min;
+		Vec2 Max;
+
+		// Empty: Min above Max so the first Expand sets both
+		AABB2() : Min(FLT_MAX, FLT_MAX), Max(-FLT_MAX, -FLT_MAX) {}
+		AABB2(const Vec2& min, const Vec2& max) : Min(min), Max(max) {}
+		static AABB2 FromCenterExtents(const Vec2& center, const Vec2& extents) { return AABB2(center - extents, center + extents); }
+
+		Vec2 Center() const { return (Min + Max) * 0.5f; }
+		// Half size
+		Vec2 Extents() const { return (Max - Min) * 0.5f; }
+		Vec2 Size() const { return Max - Min; }
+		float Area() const { return (Max.x - Min.x) * (Max.y - Min.y); }
+		bool IsEmpty() const { return Min.x > Max.x || Min.y > Max.y; }
+
+		bool Contains(const Vec2& point) const { return point.x >= Min.x && point.x <= Max.x && point.y >= Min.y && point.y <= Max.y; }
+		bool Contains(const AABB2& other) const { return other.Min.x >= Min.x && other.Max.x <= Max.x && other.Min.y >= Min.y && other.Max.y <= Max.y; }
+		bool Intersects(const AABB2& other) const { return Min.x <= other.Max.x && Max.x >= other.Min.x && Min.y <= other.Max.y && Max.y >= other.Min.y; }
+
+		void Expand(const Vec2& point);
+		void Expand(const AABB2& other);
+
+		static void OverlapBatch(const AABB2& query, const AABB2Arrays& boxes, uint8_t* outResults);
+	};
+
+	struct AABB3
+	{
+		Vec3 Min;
+		Vec3 Max;
+
+		AABB3() : Min(FLT_MAX, FLT_MAX, FLT_MAX), Max(-FLT_MAX, -FLT_MAX, -FLT_MAX) {}
+		AABB3(const Vec3& min, const Vec3& max) : Min(min), Max(max) {}
+		static AABB3 FromCenterExtents(const Vec3& center, const Vec3& extents) { return AABB3(center - extents, center + extents); }
+
+		Vec3 Center() const { return (Min + Max) * 0.5f; }
+		Vec3 Extents() const { return (Max - Min) * 0.5f; }
+		Vec3 Size() const { return Max - Min; }
+		float Volume() const { Vec3 size = Size(); return size.x * size.y * size.z; }
+		float SurfaceArea() const { Vec3 size = Size(); return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x); }
+		bool IsEmpty() const { return Min.x > Max.x || Min.y > Max.y || Min.z > Max.z; }
+
+		bool Contains(const Vec3& point) const;
+		bool Contains(const AABB3& other) const;
+		bool Intersects(const AABB3& other) const;
+		Vec3 ClosestPoint(const Vec3& point) const { return point.Clamp(Min, Max); }
+
+		void Expand(const Vec3& point);
+		void Expand(const AABB3& other);
+		// Bounds of the transformed box (Arvo's method), looser than the box itself under rotation
+		AABB3 Transform(const Mat4& matrix) const;
+
+		static void OverlapBatch(const AABB3& query, const AABB3Arrays& boxes, uint8_t* outResults);
+	};
+
+	struct Sphere
+	{
+		Vec3 Center;
+		float Radius;
+
+		Sphere() : Center(), Radius(0.0f) {}
+		Sphere(const Vec3& center, float radius) : Center(center), Radius(radius) {}
+		// Not minimal: centred on the box
+		static Sphere FromAABB(const AABB3& box) { return Sphere(box.Center(), box.Extents().Length()); }
+
+		bool Contains(const Vec3& point) const { return Center.DistanceSquared(point) <= Radius * Radius; }
+		bool Intersects(const Sphere& other) const;
+		bool Intersects(const AABB3& box) const { return box.ClosestPoint(Center).DistanceSquared(Center) <= Radius * Radius; }
+
+		static void OverlapBatch(const Sphere& query, const SphereArrays& spheres, uint8_t* outResults);
+	};
+
+	// Points p with Normal.Dot(p) + Distance = 0. Signed distances are
+	// positive on the side the normal points to.
+	struct Plane
+	{
+		Vec3 Normal;
+		float Distance;
+
+		Plane() : Normal(0.0f, 1.0f, 0.0f), Distance(0.0f) {}
+		Plane(const Vec3& normal, float distance) : Normal(normal), Distance(distance) {}
+		static Plane FromPointNormal(const Vec3& point, const Vec3& normal);
+		// Counter-clockwise a, b, c faces the normal
+		static Plane FromPoints(const Vec3& a, const Vec3& b, const Vec3& c);
+
+		float SignedDistance(const Vec3& point) const { return Normal.Dot(point) + Distance; }
+		Vec3 ClosestPoint(const Vec3& point) const { return point - Normal * SignedDistance(point); }
+		// Unit normal with the distance scaled to match
+		Plane Normalize() const;
+	};
+
+	struct Ray
+	{
+		Vec3 Origin;
+		// Not required to be unit length; distances are in multiples of it
+		Vec3 Direction;
+
+		Ray() : Origin(), Direction(0.0f, 0.0f, 1.0f) {}
+		Ray(const Vec3& origin, const Vec3& direction) : Origin(origin), Direction(direction) {}
+
+		Vec3 At(float t) const { return Origin + Direction * t; }
+
+		// Each returns the entry distance, or zero when the origin is inside
+		bool Intersects(const AABB3& box, float maxDistance, float& outDistance) const;
+		bool Intersects(const Sphere& sphere, float maxDistance, float& outDistance) const;
+		bool Intersects(const Plane& plane, float maxDistance, float& outDistance) const;
+
+		// Slab test against every box. outDistances is optional. A ray running
+		// exactly along a box face may be reported either way.
+		static void IntersectBatch(const Ray& ray, const AABB3Arrays& boxes, float maxDistance, uint8_t* outResults, float* outDistances = nullptr);
+	};
+
+	// Oriented box: Rotation's columns are the box's local axes
+	struct OBB
+	{
+		Vec3 Center;
+		Vec3 Extents;
+		Mat3 Rotation;
+
+		OBB() : Center(), Extents(), Rotation() {}
+		OBB(const Vec3& center, const Vec3& extents, const Mat3& rotation) : Center(center), Extents(extents), Rotation(rotation) {}
+		// The box carried through an affine matrix; scale moves into the extents
+		static OBB FromAABB(const AABB3& box, const Mat4& matrix);
+
+		bool Contains(const Vec3& point) const;
+		Vec3 ClosestPoint(const Vec3& point) const;
+		// Separating axis test over the 15 candidate axes
+		bool Intersects(const OBB& other) const;
+		bool Intersects(const Sphere& sphere) const { return ClosestPoint(sphere.Center).DistanceSquared(sphere.Center) <= sphere.Radius * sphere.Radius; }
+		AABB3 ToAABB() const;
+	};
+
+	// Six inward-facing planes
+	struct Frustum
+	{
+		enum PlaneIndex { Left, Right, Bottom, Top, Near, Far, PlaneCount };
+		Plane Planes[PlaneCount];
+
+		// Planes of a view-projection matrix with OpenGL depth [-1, 1] (Gribb-Hartmann)
+		static Frustum FromMatrix(const Mat4& viewProjection);
+
+		bool Contains(const Vec3& point) const;
+		// Conservative: objects near a frustum corner can pass without being visible
+		bool Intersects(const Sphere& sphere) const;
+		bool Intersects(const AABB3& box) const;
+
+		static void OverlapBatch(const Frustum& frustum, const SphereArrays& spheres, uint8_t* outResults);
+		static void OverlapBatch(const Frustum& frustum, const AABB3Arrays& boxes, uint8_t* outResults);
+	};
+
+	//----------AABB Implementation----------
+
+	inline void AABB2::Expand(const Vec2& point)
+	{
+		Min = Vec2(fminf(Min.x, point.x), fminf(Min.y, point.y));
+		Max = Vec2(fmaxf(Max.x, point.x), fmaxf(Max.y, point.y));
+	}
+
+	inline void AABB2::Expand(const AABB2& other)
+	{
+		Min = Vec2(fminf(Min.x, other.Min.x), fminf(Min.y, other.Min.y));
+		Max = Vec2(fmaxf(Max.x, other.Max.x), fmaxf(Max.y, other.Max.y));
+	}
+
+	inline bool AABB3::Contains(const Vec3& point) const
+	{
+		return point.x >= Min.x && point.x <= Max.x && point.y >= Min.y && point.y <= Max.y && point.z >= Min.z && point.z <= Max.z;
+	}
+
+	inline bool AABB3::Contains(const AABB3& other) const
+	{
+		return other.Min.x >= Min.x && other.Max.x <= Max.x && other.Min.y >= Min.y && other.Max.y <= Max.y
+			&& other.Min.z >= Min.z && other.Max.z <= Max.z;
+	}
+
+	inline bool AABB3::Intersects(const AABB3& other) const
+	{
+		return Min.x <= other.Max.x && Max.x >= other.Min.x && Min.y <= other.Max.y && Max.y >= other.Min.y
+			&& Min.z <= other.Max.z && Max.z >= other.Min.z;
+	}
+
+	inline void AABB3::Expand(const Vec3& point)
+	{
+		Min = Vec3(fminf(Min.x, point.x), fminf(Min.y, point.y), fminf(Min.z, point.z));
+		Max = Vec3(fmaxf(Max.x, point.x), fmaxf(Max.y, point.y), fmaxf(Max.z, point.z));
+	}
+
+	inline void AABB3::Expand(const AABB3& other)
+	{
+		Min = Vec3(fminf(Min.x, other.Min.x), fminf(Min.y, other.Min.y), fminf(Min.z, other.Min.z));
+		Max = Vec3(fmaxf(Max.x, other.Max.x), fmaxf(Max.y, other.Max.y), fmaxf(Max.z, other.Max.z));
+	}
+
+	inline bool Sphere::Intersects(const Sphere& other) const
+	{
+		float radii = Radius + other.Radius;
+		return Center.DistanceSquared(other.Center) <= radii * radii;
+	}
+}
@@ -0,0 +1,73 @@
+//Project Name: RundeeEngine
+//File Name: Curve.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Piecewise cubic curves with batch and arc-length evaluation header file
+
+#pragma once
+#include "../Common/CommonType.h"
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace RundeeEngine
+{
+	enum class CurveType
+	{
+		// Every third point is on the curve, the two between are handles: 3n + 1 points
+		Bezier,
+		// Passes through every point (uniform, end points repeated): 2 or more points
+		CatmullRom,
+		// Alternating points and tangents: point, tangent, point, tangent, ...
+		Hermite,
+		// Uniform cubic B-spline: smoother, but only approximates its 4 or more points
+		BSpline
+	};
+
+	// Piecewise cubic over Vec2 or Vec3 control points. Each segment is
+	// stored as one polynomial, so every type evaluates the same way. t runs
+	// from 0 to 1 over the whole curve, each segment taking an equal share,
+	// and is clamped. Arc-length functions use a table built on construction.
+	template<typename V>
+	class Curve
+	{
+	public:
+		// Invalid point counts log an error and give an empty curve that evaluates to zero.
+		// arcLengthSamples: chords per segment in the arc-length table
+		Curve(CurveType type, const V* points, size_t count, size_t arcLengthSamples = 16);
+
+		CurveType GetType() const { return m_Type; }
+		size_t GetSegmentCount() const { return m_SegmentCount; }
+		bool IsEmpty() const { return m_SegmentCount == 0; }
+		float GetLength() const { return m_ArcLengths.empty() ? 0.0f : m_ArcLengths.back(); }
+
+		V Evaluate(float t) const;
+		// dPoint/dt
+		V Derivative(float t) const;
+		// t for a distance along the curve, clamped to [0, GetLength()]
+		float ParameterAtDistance(float distance) const;
+
+		// Any parameters, in any order
+		void Evaluate(const float* t, V* out, size_t count) const;
+		// count points at evenly spaced t, first and last on the curve's ends
+		void Sample(V* out, size_t count) const;
+		// count points evenly spaced along the curve by distance
+		void SampleUniform(V* out, size_t count) const;
+
+	private:
+		static constexpr size_t Dimension = sizeof(V) / sizeof(float);
+		static constexpr size_t SegmentStride = Dimension * 4;
+
+		void BuildArcLengths(size_t samplesPerSegment);
+
+		CurveType m_Type;
+		size_t m_SegmentCount;
+		// Per segment, per component: c0 + c1 s + c2 s^2 + c3 s^3
+		std::pmr::vector<float> m_Coefficients;
+		// Cumulative length at t = i / (m_ArcLengths.size() - 1)
+		std::pmr::vector<float> m_ArcLengths;
+	};
+
+	using Curve2 = Curve<Vec2>;
+	using Curve3 = Curve<Vec3>;
+}
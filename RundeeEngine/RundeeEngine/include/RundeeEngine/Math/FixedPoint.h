@@ -0,0 +1,446 @@
+//Project Name: RundeeEngine
+//File Name: FixedPoint.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Deterministic fixed-point scalar and vector types header file
+
+#pragma once
+#include "../Common/CommonType.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace RundeeEngine
+{
+	// Every operation below is integer-only, so results are bit-identical on
+	// every compiler, flag set and CPU; lockstep simulation state should be
+	// kept in these types and only converted to float for rendering.
+	// Addition wraps, multiplication rounds down, division truncates toward
+	// zero and saturates on overflow or division by zero.
+	template<typename T, int FractionBits>
+	struct Fixed;
+
+	// Q16.16: range about +-32768, resolution 1.5e-5
+	using Fixed16 = Fixed<int32_t, 16>;
+	// Q32.32: range about +-2.1e9, resolution 2.3e-10
+	using Fixed32 = Fixed<int64_t, 32>;
+
+	class FixedMath
+	{
+	public:
+		template<typename T, int F> static Fixed<T, F> Abs(Fixed<T, F> x);
+		template<typename T, int F> static Fixed<T, F> Min(Fixed<T, F> a, Fixed<T, F> b) { return b < a ? b : a; }
+		template<typename T, int F> static Fixed<T, F> Max(Fixed<T, F> a, Fixed<T, F> b) { return a < b ? b : a; }
+		template<typename T, int F> static Fixed<T, F> Clamp(Fixed<T, F> x, Fixed<T, F> min, Fixed<T, F> max) { return Min(Max(x, min), max); }
+		template<typename T, int F> static Fixed<T, F> Floor(Fixed<T, F> x);
+		template<typename T, int F> static Fixed<T, F> Ceil(Fixed<T, F> x);
+
+		// Exact floor of the root; zero for negative input
+		template<typename T, int F> static Fixed<T, F> Sqrt(Fixed<T, F> x);
+		// Radians. Error about 1e-9 before rounding to the type's resolution.
+		template<typename T, int F> static Fixed<T, F> Sin(Fixed<T, F> x);
+		template<typename T, int F> static Fixed<T, F> Cos(Fixed<T, F> x);
+		template<typename T, int F> static void SinCos(Fixed<T, F> x, Fixed<T, F>& outSin, Fixed<T, F>& outCos);
+		template<typename T, int F> static Fixed<T, F> Atan2(Fixed<T, F> y, Fixed<T, F> x);
+
+		// Q16.16 arrays, 8 (AVX2) or 4 (SSE2) per instruction and bit-identical
+		// to the scalar operators. out may alias the inputs.
+		static void Add(const Fixed16* a, const Fixed16* b, Fixed16* out, size_t count);
+		static void Subtract(const Fixed16* a, const Fixed16* b, Fixed16* out, size_t count);
+		static void Multiply(const Fixed16* a, const Fixed16* b, Fixed16* out, size_t count);
+		static void Scale(const Fixed16* a, Fixed16 scalar, Fixed16* out, size_t count);
+		// out = a * scalar + b, e.g. position = velocity * dt + position
+		static void MulAdd(const Fixed16* a, Fixed16 scalar, const Fixed16* b, Fixed16* out, size_t count);
+		static void Sqrt(const Fixed16* x, Fixed16* out, size_t count);
+		static void Length(const Fixed16* x, const Fixed16* y, Fixed16* out, size_t count);
+
+		// Raw helpers behind the types
+		// (a * b) >> shift through a 128-bit product, rounding down
+		static int64_t MulShift(int64_t a, int64_t b, int shift);
+		// (a << shift) / b through a 128-bit dividend, truncating and saturating
+		static int64_t DivShift(int64_t a, int64_t b, int shift);
+		// floor(sqrt(value * 2^shift)) for even shift
+		static uint64_t SqrtShift(uint64_t value, int shift);
+
+	private:
+		// Half-turns (x / pi) in Q32 to sine in Q30
+		static int64_t SinHalfTurns(int64_t halfTurns);
+		// Radians in Q30 of any two raw values with the same scale
+		static int64_t Atan2Radians(int64_t y, int64_t x);
+
+		template<int F> static int64_t HalfTurns(int64_t radians) { return MulShift(radians, InvPiQ61, 29 + F); }
+		template<int F> static int64_t FromQ30(int64_t value);
+
+		static constexpr int64_t InvPiQ61 = 733972625820500352;
+	};
+
+	template<typename T, int FractionBits>
+	struct Fixed
+	{
+		static_assert(std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value, "Fixed stores int32_t or int64_t");
+		static_assert(FractionBits > 0 && FractionBits < static_cast<int>(sizeof(T) * 8) - 1, "Fixed needs integer bits");
+
+		using RawType = T;
+		using UnsignedType = typename std::make_unsigned<T>::type;
+		static constexpr int Fraction = FractionBits;
+		static constexpr T OneRaw = static_cast<T>(1) << FractionBits;
+
+		T Raw;
+
+		constexpr Fixed() : Raw(0) {}
+		explicit constexpr Fixed(int value) : Raw(static_cast<T>(value) * OneRaw) {}
+
+		static constexpr Fixed FromRaw(T raw) { Fixed result; result.Raw = raw; return result; }
+		// Float input is only as deterministic as the float itself: use these
+		// for loading data and constants, not inside the simulation
+		static constexpr Fixed FromFloat(float value) { return FromDouble(static_cast<double>(value)); }
+		static constexpr Fixed FromDouble(double value) { return FromRaw(static_cast<T>(value * static_cast<double>(OneRaw) + (value >= 0.0 ? 0.5 : -0.5))); }
+		float ToFloat() const { return static_cast<float>(static_cast<double>(Raw) / static_cast<double>(OneRaw)); }
+		// Rounds down
+		constexpr T ToInt() const { return Raw >> FractionBits; }
+
+		static constexpr Fixed Zero() { return FromRaw(0); }
+		static constexpr Fixed One() { return FromRaw(OneRaw); }
+		static constexpr Fixed Half() { return FromRaw(OneRaw / 2); }
+		static constexpr Fixed Pi() { return FromDouble(3.14159265358979323846); }
+		static constexpr Fixed HalfPi() { return FromDouble(1.57079632679489661923); }
+		static constexpr Fixed TwoPi() { return FromDouble(6.28318530717958647692); }
+		// Smallest positive value
+		static constexpr Fixed Epsilon() { return FromRaw(1); }
+		static constexpr Fixed MaxValue() { return FromRaw(std::numeric_limits<T>::max()); }
+		static constexpr Fixed MinValue() { return FromRaw(std::numeric_limits<T>::min()); }
+
+		constexpr bool operator==(Fixed other) const { return Raw == other.Raw; }
+		constexpr bool operator!=(Fixed other) const { return Raw != other.Raw; }
+		constexpr bool operator<(Fixed other) const { return Raw < other.Raw; }
+		constexpr bool operator<=(Fixed other) const { return Raw <= other.Raw; }
+		constexpr bool operator>(Fixed other) const { return Raw > other.Raw; }
+		constexpr bool operator>=(Fixed other) const { return Raw >= other.Raw; }
+
+		// Wrapping, through unsigned arithmetic so overflow is not undefined
+		constexpr Fixed operator+(Fixed other) const { return FromRaw(static_cast<T>(static_cast<UnsignedType>(Raw) + static_cast<UnsignedType>(other.Raw))); }
+		constexpr Fixed operator-(Fixed other) const { return FromRaw(static_cast<T>(static_cast<UnsignedType>(Raw) - static_cast<UnsignedType>(other.Raw))); }
+		constexpr Fixed operator-() const { return FromRaw(static_cast<T>(0 - static_cast<UnsignedType>(Raw))); }
+		Fixed operator*(Fixed other) const;
+		Fixed operator/(Fixed other) const;
+
+		Fixed& operator+=(Fixed other) { return *this = *this + other; }
+		Fixed& operator-=(Fixed other) { return *this = *this - other; }
+		Fixed& operator*=(Fixed other) { return *this = *this * other; }
+		Fixed& operator/=(Fixed other) { return *this = *this / other; }
+	};
+
+	template<typename S>
+	struct FixedVec2
+	{
+		S x, y;
+		constexpr FixedVec2() : x(), y() {}
+		constexpr FixedVec2(S x, S y) : x(x), y(y) {}
+
+		static constexpr FixedVec2 Zero() { return FixedVec2(S::Zero(), S::Zero()); }
+		static constexpr FixedVec2 One() { return FixedVec2(S::One(), S::One()); }
+		static constexpr FixedVec2 UnitX() { return FixedVec2(S::One(), S::Zero()); }
+		static constexpr FixedVec2 UnitY() { return FixedVec2(S::Zero(), S::One()); }
+		static constexpr FixedVec2 FromVec2(const Vec2& v) { return FixedVec2(S::FromFloat(v.x), S::FromFloat(v.y)); }
+		Vec2 ToVec2() const { return Vec2(x.ToFloat(), y.ToFloat()); }
+
+		constexpr bool operator==(const FixedVec2& other) const { return x == other.x && y == other.y; }
+		constexpr bool operator!=(const FixedVec2& other) const { return !(*this == other); }
+
+		constexpr FixedVec2 operator+(const FixedVec2& other) const { return FixedVec2(x + other.x, y + other.y); }
+		constexpr FixedVec2 operator-(const FixedVec2& other) const { return FixedVec2(x - other.x, y - other.y); }
+		constexpr FixedVec2 operator-() const { return FixedVec2(-x, -y); }
+		FixedVec2 operator*(S scalar) const { return FixedVec2(x * scalar, y * scalar); }
+		FixedVec2 operator/(S scalar) const { return FixedVec2(x / scalar, y / scalar); }
+		FixedVec2 operator*(const FixedVec2& other) const { return FixedVec2(x * other.x, y * other.y); }
+		FixedVec2 operator/(const FixedVec2& other) const { return FixedVec2(x / other.x, y / other.y); }
+		FixedVec2& operator+=(const FixedVec2& other) { return *this = *this + other; }
+		FixedVec2& operator-=(const FixedVec2& other) { return *this = *this - other; }
+		FixedVec2& operator*=(S scalar) { return *this = *this * scalar; }
+		FixedVec2& operator/=(S scalar) { return *this = *this / scalar; }
+
+		S Length() const;
+		S LengthSquared() const { return x * x + y * y; }
+		FixedVec2 Normalize() const;
+
+		S Dot(const FixedVec2& other) const { return x * other.x + y * other.y; }
+		S Cross(const FixedVec2& other) const { return x * other.y - y * other.x; }
+		S Distance(const FixedVec2& other) const { return (*this - other).Length(); }
+		S DistanceSquared(const FixedVec2& other) const { return (*this - other).LengthSquared(); }
+
+		constexpr FixedVec2 Perpendicular() const { return FixedVec2(-y, x); }
+		FixedVec2 Rotate(S angle) const;
+		FixedVec2 Lerp(const FixedVec2& other, S t) const { return *this + (other - *this) * t; }
+		FixedVec2 Clamp(const FixedVec2& min, const FixedVec2& max) const { return FixedVec2(FixedMath::Clamp(x, min.x, max.x), FixedMath::Clamp(y, min.y, max.y)); }
+		FixedVec2 Reflect(const FixedVec2& normal) const { S d = Dot(normal); return *this - normal * (d + d); }
+		FixedVec2 Project(const FixedVec2& other) const;
+
+		constexpr bool IsZero() const { return x.Raw == 0 && y.Raw == 0; }
+		S Angle() const { return FixedMath::Atan2(y, x); }
+	};
+
+	template<typename S>
+	struct FixedVec3
+	{
+		S x, y, z;
+		constexpr FixedVec3() : x(), y(), z() {}
+		constexpr FixedVec3(S x, S y, S z) : x(x), y(y), z(z) {}
+
+		static constexpr FixedVec3 Zero() { return FixedVec3(S::Zero(), S::Zero(), S::Zero()); }
+		static constexpr FixedVec3 One() { return FixedVec3(S::One(), S::One(), S::One()); }
+		static constexpr FixedVec3 UnitX() { return FixedVec3(S::One(), S::Zero(), S::Zero()); }
+		static constexpr FixedVec3 UnitY() { return FixedVec3(S::Zero(), S::One(), S::Zero()); }
+		static constexpr FixedVec3 UnitZ() { return FixedVec3(S::Zero(), S::Zero(), S::One()); }
+		static constexpr FixedVec3 FromVec3(const Vec3& v) { return FixedVec3(S::FromFloat(v.x), S::FromFloat(v.y), S::FromFloat(v.z)); }
+		Vec3 ToVec3() const { return Vec3(x.ToFloat(), y.ToFloat(), z.ToFloat()); }
+
+		constexpr bool operator==(const FixedVec3& other) const { return x == other.x && y == other.y && z == other.z; }
+		constexpr bool operator!=(const FixedVec3& other) const { return !(*this == other); }
+
+		constexpr FixedVec3 operator+(const FixedVec3& other) const { return FixedVec3(x + other.x, y + other.y, z + other.z); }
+		constexpr FixedVec3 operator-(const FixedVec3& other) const { return FixedVec3(x - other.x, y - other.y, z - other.z); }
+		constexpr FixedVec3 operator-() const { return FixedVec3(-x, -y, -z); }
+		FixedVec3 operator*(S scalar) const { return FixedVec3(x * scalar, y * scalar, z * scalar); }
+		FixedVec3 operator/(S scalar) const { return FixedVec3(x / scalar, y / scalar, z / scalar); }
+		FixedVec3 operator*(const FixedVec3& other) const { return FixedVec3(x * other.x, y * other.y, z * other.z); }
+		FixedVec3 operator/(const FixedVec3& other) const { return FixedVec3(x / other.x, y / other.y, z / other.z); }
+		FixedVec3& operator+=(const FixedVec3& other) { return *this = *this + other; }
+		FixedVec3& operator-=(const FixedVec3& other) { return *this = *this - other; }
+		FixedVec3& operator*=(S scalar) { return *this = *this * scalar; }
+		FixedVec3& operator/=(S scalar) { return *this = *this / scalar; }
+
+		S Length() const;
+		S LengthSquared() const { return x * x + y * y + z * z; }
+		FixedVec3 Normalize() const;
+
+		S Dot(const FixedVec3& other) const { return x * other.x + y * other.y + z * other.z; }
+		FixedVec3 Cross(const FixedVec3& other) const { return FixedVec3(y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x); }
+		S Distance(const FixedVec3& other) const { return (*this - other).Length(); }
+		S DistanceSquared(const FixedVec3& other) const { return (*this - other).LengthSquared(); }
+
+		FixedVec3 Lerp(const FixedVec3& other, S t) const { return *this + (other - *this) * t; }
+		FixedVec3 Clamp(const FixedVec3& min, const FixedVec3& max) const { return FixedVec3(FixedMath::Clamp(x, min.x, max.x), FixedMath::Clamp(y, min.y, max.y), FixedMath::Clamp(z, min.z, max.z)); }
+		FixedVec3 Reflect(const FixedVec3& normal) const { S d = Dot(normal); return *this - normal * (d + d); }
+		FixedVec3 Project(const FixedVec3& other) const;
+
+		constexpr bool IsZero() const { return x.Raw == 0 && y.Raw == 0 && z.Raw == 0; }
+	};
+
+	using Fixed16Vec2 = FixedVec2<Fixed16>;
+	using Fixed16Vec3 = FixedVec3<Fixed16>;
+	using Fixed32Vec2 = FixedVec2<Fixed32>;
+	using Fixed32Vec3 = FixedVec3<Fixed32>;
+
+	//----------Fixed Implementation----------
+
+	template<typename T, int F>
+	inline Fixed<T, F> Fixed<T, F>::operator*(Fixed other) const
+	{
+		if constexpr (sizeof(T) == 4)
+		{
+			return FromRaw(static_cast<T>((static_cast<int64_t>(Raw) * other.Raw) >> F));
+		}
+		else
+		{
+			return FromRaw(FixedMath::MulShift(Raw, other.Raw, F));
+		}
+	}
+
+	template<typename T, int F>
+	inline Fixed<T, F> Fixed<T, F>::operator/(Fixed other) const
+	{
+		if constexpr (sizeof(T) == 4)
+		{
+			if (other.Raw == 0)
+			{
+				return Raw < 0 ? MinValue() : MaxValue();
+			}
+			int64_t quotient = static_cast<int64_t>(Raw) * OneRaw / other.Raw;
+			if (quotient > std::numeric_limits<T>::max())
+			{
+				return MaxValue();
+			}
+			if (quotient < std::numeric_limits<T>::min())
+			{
+				return MinValue();
+			}
+			return FromRaw(static_cast<T>(quotient));
+		}
+		else
+		{
+			return FromRaw(FixedMath::DivShift(Raw, other.Raw, F));
+		}
+	}
+
+	//----------FixedMath Implementation----------
+
+	inline int64_t FixedMath::MulShift(int64_t a, int64_t b, int shift)
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		int64_t high;
+		uint64_t low = static_cast<uint64_t>(_mul128(a, b, &high));
+		return shift == 0 ? static_cast<int64_t>(low) : static_cast<int64_t>((low >> shift) | (static_cast<uint64_t>(high) << (64 - shift)));
+#else
+		return static_cast<int64_t>((static_cast<__int128>(a) * b) >> shift);
+#endif
+	}
+
+	template<int F>
+	inline int64_t FixedMath::FromQ30(int64_t value)
+	{
+		if constexpr (F <= 30)
+		{
+			return value >> (30 - F);
+		}
+		else
+		{
+			return value * (static_cast<int64_t>(1) << (F - 30));
+		}
+	}
+
+	template<typename T, int F>
+	inline Fixed<T, F> FixedMath::Abs(Fixed<T, F> x)
+	{
+		return x.Raw < 0 ? -x : x;
+	}
+
+	template<typename T, int F>
+	inline Fixed<T, F> FixedMath::Floor(Fixed<T, F> x)
+	{
+		return Fixed<T, F>::FromRaw(static_cast<T>(x.Raw & ~(Fixed<T, F>::OneRaw - 1)));
+	}
+
+	template<typename T, int F>
+	inline Fixed<T, F> FixedMath::Ceil(Fixed<T, F> x)
+	{
+		return Floor(x + Fixed<T, F>::FromRaw(Fixed<T, F>::OneRaw - 1));
+	}
+
+	template<typename T, int F>
+	inline Fixed<T, F> FixedMath::Sqrt(Fixed<T, F> x)
+	{
+		if (x.Raw <= 0)
+		{
+			return Fixed<T, F>::Zero();
+		}
+		return Fixed<T, F>::FromRaw(static_cast<T>(SqrtShift(static_cast<uint64_t>(x.Raw), F)));
+	}
+
+	template<typename T, int F>
+	inline Fixed<T, F> FixedMath::Sin(Fixed<T, F> x)
+	{
+		return Fixed<T, F>::FromRaw(static_cast<T>(FromQ30<F>(SinHalfTurns(HalfTurns<F>(x.Raw)))));
+	}
+
+	template<typename T, int F>
+	inline Fixed<T, F> FixedMath::Cos(Fixed<T, F> x)
+	{
+		// cos(x) = sin(x + pi / 2), added as half a half-turn so no precision is lost
+		uint64_t halfTurns = static_cast<uint64_t>(HalfTurns<F>(x.Raw)) + (static_cast<uint64_t>(1) << 31);
+		return Fixed<T, F>::FromRaw(static_cast<T>(FromQ30<F>(SinHalfTurns(static_cast<int64_t>(halfTurns)))));
+	}
+
+	template<typename T, int F>
+	inline void FixedMath::SinCos(Fixed<T, F> x, Fixed<T, F>& outSin, Fixed<T, F>& outCos)
+	{
+		int64_t halfTurns = HalfTurns<F>(x.Raw);
+		outSin = Fixed<T, F>::FromRaw(static_cast<T>(FromQ30<F>(SinHalfTurns(halfTurns))));
+		outCos = Fixed<T, F>::FromRaw(static_cast<T>(FromQ30<F>(SinHalfTurns(static_cast<int64_t>(static_cast<uint64_t>(halfTurns) + (static_cast<uint64_t>(1) << 31))))));
+	}
+
+	template<typename T, int F>
+	inline Fixed<T, F> FixedMath::Atan2(Fixed<T, F> y, Fixed<T, F> x)
+	{
+		return Fixed<T, F>::FromRaw(static_cast<T>(FromQ30<F>(Atan2Radians(y.Raw, x.Raw))));
+	}
+
+	//----------FixedVec Implementation----------
+
+	// Q16.16 lengths square into 64 bits, so the root is exact and does not
+	// overflow for components up to the type's range
+	template<typename S>
+	inline S FixedVec2<S>::Length() const
+	{
+		if constexpr (sizeof(typename S::RawType) == 4)
+		{
+			uint64_t sum = static_cast<uint64_t>(static_cast<int64_t>(x.Raw) * x.Raw) + static_cast<uint64_t>(static_cast<int64_t>(y.Raw) * y.Raw);
+			return S::FromRaw(static_cast<typename S::RawType>(FixedMath::SqrtShift(sum, 0)));
+		}
+		else
+		{
+			return FixedMath::Sqrt(LengthSquared());
+		}
+	}
+
+	template<typename S>
+	inline FixedVec2<S> FixedVec2<S>::Normalize() const
+	{
+		S length = Length();
+		if (length.Raw == 0)
+		{
+			return Zero();
+		}
+		return FixedVec2(x / length, y / length);
+	}
+
+	template<typename S>
+	inline FixedVec2<S> FixedVec2<S>::Rotate(S angle) const
+	{
+		S s, c;
+		FixedMath::SinCos(angle, s, c);
+		return FixedVec2(x * c - y * s, x * s + y * c);
+	}
+
+	template<typename S>
+	inline FixedVec2<S> FixedVec2<S>::Project(const FixedVec2& other) const
+	{
+		S lengthSquared = other.LengthSquared();
+		if (lengthSquared.Raw == 0)
+		{
+			return Zero();
+		}
+		return other * (Dot(other) / lengthSquared);
+	}
+
+	template<typename S>
+	inline S FixedVec3<S>::Length() const
+	{
+		if constexpr (sizeof(typename S::RawType) == 4)
+		{
+			uint64_t sum = static_cast<uint64_t>(static_cast<int64_t>(x.Raw) * x.Raw) + static_cast<uint64_t>(static_cast<int64_t>(y.Raw) * y.Raw)
+				+ static_cast<uint64_t>(static_cast<int64_t>(z.Raw) * z.Raw);
+			return S::FromRaw(static_cast<typename S::RawType>(FixedMath::SqrtShift(sum, 0)));
+		}
+		else
+		{
+			return FixedMath::Sqrt(LengthSquared());
+		}
+	}
+
+	template<typename S>
+	inline FixedVec3<S> FixedVec3<S>::Normalize() const
+	{
+		S length = Length();
+		if (length.Raw == 0)
+		{
+			return Zero();
+		}
+		return FixedVec3(x / length, y / length, z / length);
+	}
+
+	template<typename S>
+	inline FixedVec3<S> FixedVec3<S>::Project(const FixedVec3& other) const
+	{
+		S lengthSquared = other.LengthSquared();
+		if (lengthSquared.Raw == 0)
+		{
+			return Zero();
+		}
+		return other * (Dot(other) / lengthSquared);
+	}
+}
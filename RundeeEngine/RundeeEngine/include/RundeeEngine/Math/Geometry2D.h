@@ -0,0 +1,101 @@
+//Project Name: RundeeEngine
+//File Name: Geometry2D.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Convex hulls, triangulation, clipping and offsetting of 2D polygons header file
+
+#pragma once
+#include "../Common/CommonType.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace RundeeEngine
+{
+	enum class DelaunayFill
+	{
+		// Every triangle of the convex hull
+		All,
+		// Triangles inside the constraint edges by the even-odd rule: an
+		// outline with hole outlines gives the filled shape
+		EvenOdd
+	};
+
+	enum class JoinType
+	{
+		// Sharp corners, bevelled beyond MiterLimit
+		Miter,
+		Bevel,
+		Round
+	};
+
+	struct OffsetSettings
+	{
+		JoinType Join = JoinType::Miter;
+		// Longest miter allowed, in multiples of the offset distance
+		float MiterLimit = 2.0f;
+		// Furthest a round join's chords may stray from the true arc
+		float ArcTolerance = 0.25f;
+	};
+
+	// Polygons are closed loops of Vec2 without a repeated last point.
+	// Counter-clockwise (with y up) has positive area; functions accept
+	// either winding unless noted, and triangles come out counter-clockwise
+	// as index triples into the input points.
+	//
+	// Each operation has a form writing into caller buffers, which does not
+	// allocate (scratch sizes come from the Get*ScratchSize functions, in
+	// bytes, 8-byte aligned), and a form filling a pmr vector that allocates
+	// its scratch from the Math heap. Buffer forms log an error and return 0
+	// when an output would not fit.
+	class Geometry2D
+	{
+	public:
+		static float SignedArea(const Vec2* polygon, size_t count);
+		// Even-odd rule; points exactly on an edge may go either way
+		static bool ContainsPoint(const Vec2* polygon, size_t count, const Vec2& point);
+
+		// Andrew's monotone chain, O(n log n). Counter-clockwise from the
+		// lowest x (then y) point, without collinear points. points is sorted
+		// in place and outHull holds count + 1 points; returns the hull size.
+		static size_t ConvexHull(Vec2* points, size_t count, Vec2* outHull);
+		static void ConvexHull(const Vec2* points, size_t count, std::pmr::vector<Vec2>& outHull);
+
+		// Ear clipping of a simple polygon. Candidate ears are checked only
+		// against vertices near them on a z-order curve, which keeps large
+		// inputs close to linear; outlines whose ears are long and thin
+		// (deep, dense spikes) still approach quadratic and triangulate
+		// faster through TriangulateDelaunay with EvenOdd. Degenerate and
+		// self-touching input is cleaned up or split rather than rejected.
+		// outIndices holds 3 * (count - 2); returns the triangle count.
+		static size_t GetTriangulateScratchSize(size_t count);
+		static size_t Triangulate(const Vec2* polygon, size_t count, uint32_t* outIndices, void* scratch);
+		static void Triangulate(const Vec2* polygon, size_t count, std::pmr::vector<uint32_t>& outIndices);
+
+		// Constrained Delaunay triangulation: incremental insertion in a
+		// randomised z-order with Lawson flips, then each constraint edge
+		// (index pairs into points) flipped into place. Duplicate points are
+		// merged and constraints passing through points are split there;
+		// crossing constraints are an error and the later one is skipped.
+		// outIndices holds 3 * GetDelaunayMaxTriangles(pointCount).
+		static size_t GetDelaunayScratchSize(size_t pointCount, size_t edgeCount);
+		static size_t GetDelaunayMaxTriangles(size_t pointCount) { return pointCount < 3 ? 0 : 2 * pointCount - 5; }
+		static size_t TriangulateDelaunay(const Vec2* points, size_t pointCount, const uint32_t* edges, size_t edgeCount, DelaunayFill fill, uint32_t* outIndices, void* scratch);
+		static void TriangulateDelaunay(const Vec2* points, size_t pointCount, const uint32_t* edges, size_t edgeCount, DelaunayFill fill, std::pmr::vector<uint32_t>& outIndices);
+
+		// Sutherland-Hodgman: subject clipped to a convex clip polygon.
+		// outPolygon and scratch each hold capacity points; subjectCount +
+		// clipCount is enough for a convex subject. Concave subjects can come
+		// out with zero-width bridges along the clip edges.
+		static size_t ClipPolygon(const Vec2* subject, size_t subjectCount, const Vec2* clip, size_t clipCount, Vec2* outPolygon, Vec2* scratch, size_t capacity);
+		static void ClipPolygon(const Vec2* subject, size_t subjectCount, const Vec2* clip, size_t clipCount, std::pmr::vector<Vec2>& outPolygon);
+
+		// Moves every edge distance outwards (inwards when negative), keeping
+		// the winding. Nothing removes the loops left where an inset is
+		// deeper than a feature is wide. outPolygon holds capacity points;
+		// 2 * count is enough for miter and bevel joins.
+		static size_t OffsetPolygon(const Vec2* polygon, size_t count, float distance, const OffsetSettings& settings, Vec2* outPolygon, size_t capacity);
+		static void OffsetPolygon(const Vec2* polygon, size_t count, float distance, const OffsetSettings& settings, std::pmr::vector<Vec2>& outPolygon);
+	};
+}
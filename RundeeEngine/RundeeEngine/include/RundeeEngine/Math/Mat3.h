@@ -0,0 +1,137 @@
+//Project Name: RundeeEngine
+//File Name: Mat3.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: 3x3 matrix header file
+
+#pragma once
+#include "Vec4.h"
+#include <cstddef>
+
+namespace RundeeEngine
+{
+	// Column-major, column vectors (v' = M * v). Each column is padded to a
+	// Vec4 with w = 0 so it can be loaded as one register. Angles are radians.
+	struct alignas(16) Mat3
+	{
+		Vec4 Columns[3];
+
+		// Identity
+		Mat3();
+		Mat3(const Vec3& column0, const Vec3& column1, const Vec3& column2);
+
+		static Mat3 Identity() { return Mat3(); }
+		static Mat3 Zero() { return Mat3(Vec3(), Vec3(), Vec3()); }
+		static Mat3 Scale(const Vec3& scale);
+		static Mat3 RotationX(float radians);
+		static Mat3 RotationY(float radians);
+		static Mat3 RotationZ(float radians);
+		static Mat3 RotationAxis(const Vec3& axis, float radians);
+
+		Vec4& operator[](int column) { return Columns[column]; }
+		const Vec4& operator[](int column) const { return Columns[column]; }
+
+		bool operator==(const Mat3& other) const;
+		bool operator!=(const Mat3& other) const { return !(*this == other); }
+
+		Mat3 operator*(const Mat3& other) const;
+		Vec3 operator*(const Vec3& vector) const;
+		Mat3& operator*=(const Mat3& other) { return *this = *this * other; }
+
+		Mat3 Transpose() const;
+		float Determinant() const;
+
+		// Zero matrix when singular, matching the vector divide-by-zero convention
+		Mat3 Inverse() const;
+
+		static void TransformVectors(const Mat3& matrix, const Vec3* vectors, Vec3* out, size_t count);
+	};
+
+	//----------Mat3 Implementation----------
+
+	inline Mat3::Mat3()
+		: Columns{ Vec4(1.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, 1.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, 1.0f, 0.0f) }
+	{
+	}
+
+	inline Mat3::Mat3(const Vec3& column0, const Vec3& column1, const Vec3& column2)
+		: Columns{ Vec4(column0, 0.0f), Vec4(column1, 0.0f), Vec4(column2, 0.0f) }
+	{
+	}
+
+	inline bool Mat3::operator==(const Mat3& other) const
+	{
+		return Columns[0] == other.Columns[0] && Columns[1] == other.Columns[1] && Columns[2] == other.Columns[2];
+	}
+
+	#if RUNDEE_SIMD_SSE2
+
+	inline Vec3 Mat3::operator*(const Vec3& vector) const
+	{
+		__m128 result = _mm_mul_ps(Columns[0].Load(), _mm_set1_ps(vector.x));
+		result = SimdMulAdd(Columns[1].Load(), _mm_set1_ps(vector.y), result);
+		result = SimdMulAdd(Columns[2].Load(), _mm_set1_ps(vector.z), result);
+		return Vec4(result).ToVec3();
+	}
+
+	inline Mat3 Mat3::operator*(const Mat3& other) const
+	{
+		__m128 c0 = Columns[0].Load();
+		__m128 c1 = Columns[1].Load();
+		__m128 c2 = Columns[2].Load();
+
+		Mat3 result;
+		for (int i = 0; i < 3; ++i)
+		{
+			__m128 column = other.Columns[i].Load();
+			__m128 value = _mm_mul_ps(c0, SimdSplat<0>(column));
+			value = SimdMulAdd(c1, SimdSplat<1>(column), value);
+			value = SimdMulAdd(c2, SimdSplat<2>(column), value);
+			result.Columns[i] = Vec4(value);
+		}
+		return result;
+	}
+
+	inline Mat3 Mat3::Transpose() const
+	{
+		__m128 c0 = Columns[0].Load();
+		__m128 c1 = Columns[1].Load();
+		__m128 c2 = Columns[2].Load();
+		__m128 c3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+		Mat3 result;
+		result.Columns[0] = Vec4(c0);
+		result.Columns[1] = Vec4(c1);
+		result.Columns[2] = Vec4(c2);
+		return result;
+	}
+
+	#else
+
+	inline Vec3 Mat3::operator*(const Vec3& vector) const
+	{
+		return (Columns[0] * vector.x + Columns[1] * vector.y + Columns[2] * vector.z).ToVec3();
+	}
+
+	inline Mat3 Mat3::operator*(const Mat3& other) const
+	{
+		Mat3 result;
+		for (int i = 0; i < 3; ++i)
+		{
+			const Vec4& column = other.Columns[i];
+			result.Columns[i] = Columns[0] * column.x + Columns[1] * column.y + Columns[2] * column.z;
+		}
+		return result;
+	}
+
+	inline Mat3 Mat3::Transpose() const
+	{
+		return Mat3(
+			Vec3(Columns[0].x, Columns[1].x, Columns[2].x),
+			Vec3(Columns[0].y, Columns[1].y, Columns[2].y),
+			Vec3(Columns[0].z, Columns[1].z, Columns[2].z));
+	}
+
+	#endif
+}
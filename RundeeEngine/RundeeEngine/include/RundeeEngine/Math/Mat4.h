@@ -0,0 +1,213 @@
+//Project Name: RundeeEngine
+//File Name: Mat4.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: 4x4 matrix header file
+
+#pragma once
+#include "Mat3.h"
+#include "Vec4.h"
+#include <cstddef>
+
+namespace RundeeEngine
+{
+	// Column-major, column vectors (v' = M * v), so Data() can go straight
+	// to OpenGL. Right-handed; projections map depth to [-1, 1]. Angles are
+	// radians.
+	struct alignas(16) Mat4
+	{
+		Vec4 Columns[4];
+
+		// Identity
+		Mat4();
+		Mat4(const Vec4& column0, const Vec4& column1, const Vec4& column2, const Vec4& column3);
+		explicit Mat4(const Mat3& rotationScale, const Vec3& translation = Vec3());
+
+		static Mat4 Identity() { return Mat4(); }
+		static Mat4 Zero() { return Mat4(Vec4(), Vec4(), Vec4(), Vec4()); }
+		static Mat4 Translation(const Vec3& translation);
+		static Mat4 Scale(const Vec3& scale);
+		static Mat4 RotationX(float radians);
+		static Mat4 RotationY(float radians);
+		static Mat4 RotationZ(float radians);
+		static Mat4 RotationAxis(const Vec3& axis, float radians);
+		static Mat4 Orthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane);
+		static Mat4 Perspective(float fovY, float aspect, float nearPlane, float farPlane);
+		static Mat4 LookAt(const Vec3& eye, const Vec3& target, const Vec3& up);
+
+		Vec4& operator[](int column) { return Columns[column]; }
+		const Vec4& operator[](int column) const { return Columns[column]; }
+		float* Data() { return &Columns[0].x; }
+		const float* Data() const { return &Columns[0].x; }
+
+		bool operator==(const Mat4& other) const;
+		bool operator!=(const Mat4& other) const { return !(*this == other); }
+
+		Mat4 operator*(const Mat4& other) const;
+		Vec4 operator*(const Vec4& vector) const;
+		Mat4& operator*=(const Mat4& other) { return *this = *this * other; }
+
+		// w = 1 with no perspective divide, for affine transforms
+		Vec3 TransformPoint(const Vec3& point) const;
+		// w = 0, ignores translation
+		Vec3 TransformVector(const Vec3& vector) const;
+
+		Mat4 Transpose() const;
+		float Determinant() const;
+		Mat3 ToMat3() const;
+
+		// General inverse; zero matrix when singular
+		Mat4 Inverse() const;
+		// Cheaper inverse when the bottom row is (0, 0, 0, 1)
+		Mat4 InverseAffine() const;
+
+		// out may alias the input. Points are transformed with w = 1, vectors with w = 0.
+		static void TransformPoints(const Mat4& matrix, const Vec3* points, Vec3* out, size_t count);
+		static void TransformVectors(const Mat4& matrix, const Vec3* vectors, Vec3* out, size_t count);
+		static void Transform(const Mat4& matrix, const Vec4* vectors, Vec4* out, size_t count);
+	};
+
+	//----------Mat4 Implementation----------
+
+	inline Mat4::Mat4()
+		: Columns{ Vec4::UnitX(), Vec4::UnitY(), Vec4::UnitZ(), Vec4::UnitW() }
+	{
+	}
+
+	inline Mat4::Mat4(const Vec4& column0, const Vec4& column1, const Vec4& column2, const Vec4& column3)
+		: Columns{ column0, column1, column2, column3 }
+	{
+	}
+
+	inline Mat4::Mat4(const Mat3& rotationScale, const Vec3& translation)
+		: Columns{ rotationScale.Columns[0], rotationScale.Columns[1], rotationScale.Columns[2], Vec4(translation, 1.0f) }
+	{
+	}
+
+	inline bool Mat4::operator==(const Mat4& other) const
+	{
+		return Columns[0] == other.Columns[0] && Columns[1] == other.Columns[1]
+			&& Columns[2] == other.Columns[2] && Columns[3] == other.Columns[3];
+	}
+
+	inline Mat3 Mat4::ToMat3() const
+	{
+		return Mat3(Columns[0].ToVec3(), Columns[1].ToVec3(), Columns[2].ToVec3());
+	}
+
+	#if RUNDEE_SIMD_SSE2
+
+	inline Vec4 Mat4::operator*(const Vec4& vector) const
+	{
+		__m128 v = vector.Load();
+		__m128 result = _mm_mul_ps(Columns[0].Load(), SimdSplat<0>(v));
+		result = SimdMulAdd(Columns[1].Load(), SimdSplat<1>(v), result);
+		result = SimdMulAdd(Columns[2].Load(), SimdSplat<2>(v), result);
+		result = SimdMulAdd(Columns[3].Load(), SimdSplat<3>(v), result);
+		return Vec4(result);
+	}
+
+	inline Mat4 Mat4::operator*(const Mat4& other) const
+	{
+		Mat4 result;
+
+		#if RUNDEE_SIMD_AVX
+		// Two result columns per iteration: each half of a register holds one column
+		__m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&Columns[0]));
+		__m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&Columns[1]));
+		__m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&Columns[2]));
+		__m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&Columns[3]));
+
+		for (int i = 0; i < 4; i += 2)
+		{
+			__m256 b = _mm256_loadu_ps(&other.Columns[i].x);
+			__m256 value = _mm256_mul_ps(a0, _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0)));
+			value = SimdMulAdd(a1, _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1)), value);
+			value = SimdMulAdd(a2, _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2)), value);
+			value = SimdMulAdd(a3, _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3)), value);
+			_mm256_storeu_ps(&result.Columns[i].x, value);
+		}
+		#else
+		__m128 a0 = Columns[0].Load();
+		__m128 a1 = Columns[1].Load();
+		__m128 a2 = Columns[2].Load();
+		__m128 a3 = Columns[3].Load();
+
+		for (int i = 0; i < 4; ++i)
+		{
+			__m128 b = other.Columns[i].Load();
+			__m128 value = _mm_mul_ps(a0, SimdSplat<0>(b));
+			value = SimdMulAdd(a1, SimdSplat<1>(b), value);
+			value = SimdMulAdd(a2, SimdSplat<2>(b), value);
+			value = SimdMulAdd(a3, SimdSplat<3>(b), value);
+			result.Columns[i] = Vec4(value);
+		}
+		#endif
+
+		return result;
+	}
+
+	inline Vec3 Mat4::TransformPoint(const Vec3& point) const
+	{
+		__m128 result = SimdMulAdd(Columns[0].Load(), _mm_set1_ps(point.x), Columns[3].Load());
+		result = SimdMulAdd(Columns[1].Load(), _mm_set1_ps(point.y), result);
+		result = SimdMulAdd(Columns[2].Load(), _mm_set1_ps(point.z), result);
+		return Vec4(result).ToVec3();
+	}
+
+	inline Vec3 Mat4::TransformVector(const Vec3& vector) const
+	{
+		__m128 result = _mm_mul_ps(Columns[0].Load(), _mm_set1_ps(vector.x));
+		result = SimdMulAdd(Columns[1].Load(), _mm_set1_ps(vector.y), result);
+		result = SimdMulAdd(Columns[2].Load(), _mm_set1_ps(vector.z), result);
+		return Vec4(result).ToVec3();
+	}
+
+	inline Mat4 Mat4::Transpose() const
+	{
+		__m128 c0 = Columns[0].Load();
+		__m128 c1 = Columns[1].Load();
+		__m128 c2 = Columns[2].Load();
+		__m128 c3 = Columns[3].Load();
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		return Mat4(Vec4(c0), Vec4(c1), Vec4(c2), Vec4(c3));
+	}
+
+	#else
+
+	inline Vec4 Mat4::operator*(const Vec4& vector) const
+	{
+		return Columns[0] * vector.x + Columns[1] * vector.y + Columns[2] * vector.z + Columns[3] * vector.w;
+	}
+
+	inline Mat4 Mat4::operator*(const Mat4& other) const
+	{
+		Mat4 result;
+		for (int i = 0; i < 4; ++i)
+		{
+			result.Columns[i] = *this * other.Columns[i];
+		}
+		return result;
+	}
+
+	inline Vec3 Mat4::TransformPoint(const Vec3& point) const
+	{
+		return (Columns[0] * point.x + Columns[1] * point.y + Columns[2] * point.z + Columns[3]).ToVec3();
+	}
+
+	inline Vec3 Mat4::TransformVector(const Vec3& vector) const
+	{
+		return (Columns[0] * vector.x + Columns[1] * vector.y + Columns[2] * vector.z).ToVec3();
+	}
+
+	inline Mat4 Mat4::Transpose() const
+	{
+		return Mat4(
+			Vec4(Columns[0].x, Columns[1].x, Columns[2].x, Columns[3].x),
+			Vec4(Columns[0].y, Columns[1].y, Columns[2].y, Columns[3].y),
+			Vec4(Columns[0].z, Columns[1].z, Columns[2].z, Columns[3].z),
+			Vec4(Columns[0].w, Columns[1].w, Columns[2].w, Columns[3].w));
+	}
+
+	#endif
+}
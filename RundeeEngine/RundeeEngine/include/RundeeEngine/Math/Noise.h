@@ -0,0 +1,58 @@
+//Project Name: RundeeEngine
+//File Name: Noise.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Procedural noise generation header file
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace RundeeEngine
+{
+	enum class NoiseType
+	{
+		Simplex,
+		Value
+	};
+
+	enum class FractalType
+	{
+		None,
+		// Octaves summed with falling amplitude
+		FBm,
+		// Octaves of 1 - |noise|, squared: sharp crests for mountains and veins
+		Ridged
+	};
+
+	struct NoiseSettings
+	{
+		NoiseType Type = NoiseType::Simplex;
+		FractalType Fractal = FractalType::FBm;
+		int32_t Seed = 1337;
+		// Applied to the input coordinates
+		float Frequency = 0.01f;
+		int Octaves = 5;
+		// Frequency multiplier per octave
+		float Lacunarity = 2.0f;
+		// Amplitude multiplier per octave
+		float Gain = 0.5f;
+	};
+
+	// Hash-based (no permutation table) simplex and value noise, evaluated 4
+	// or 8 samples at a time. Output is in roughly [-1, 1].
+	class Noise
+	{
+	public:
+		static float Sample2D(const NoiseSettings& settings, float x, float y);
+		static float Sample3D(const NoiseSettings& settings, float x, float y, float z);
+
+		// out[y * width + x] = Sample2D(originX + x * step, originY + y * step).
+		// Rows are spread across the JobSystem.
+		static void Grid2D(const NoiseSettings& settings, float* out, size_t width, size_t height,
+			float originX = 0.0f, float originY = 0.0f, float step = 1.0f);
+		// out[(z * height + y) * width + x], as Grid2D with a third axis
+		static void Grid3D(const NoiseSettings& settings, float* out, size_t width, size_t height, size_t depth,
+			float originX = 0.0f, float originY = 0.0f, float originZ = 0.0f, float step = 1.0f);
+	};
+}
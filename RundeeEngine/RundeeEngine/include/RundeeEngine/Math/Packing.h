@@ -0,0 +1,63 @@
+//Project Name: RundeeEngine
+//File Name: Packing.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Half-precision, normalized integer and unit vector packing header file
+
+#pragma once
+#include "../Common/CommonType.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace RundeeEngine
+{
+	// Compact storage formats for snapshots, vertex data and network
+	// payloads. Normalized formats follow the GPU conventions: snorm maps
+	// [-1, 1] to [-max, max], unorm maps [0, 1] to [0, max], values are
+	// clamped and rounded to nearest. The batch forms produce the same
+	// results as the single-value forms; in and out must not overlap.
+	class Packing
+	{
+	public:
+		// IEEE 754 binary16: rounds to nearest even, overflows to infinity, keeps NaN
+		static uint16_t FloatToHalf(float value);
+		static float HalfToFloat(uint16_t value);
+
+		static int16_t PackSnorm16(float value) { return static_cast<int16_t>(Quantize(value, -1.0f, 1.0f, 32767.0f)); }
+		static float UnpackSnorm16(int16_t value) { return fmaxf(static_cast<float>(value) * (1.0f / 32767.0f), -1.0f); }
+		static int8_t PackSnorm8(float value) { return static_cast<int8_t>(Quantize(value, -1.0f, 1.0f, 127.0f)); }
+		static float UnpackSnorm8(int8_t value) { return fmaxf(static_cast<float>(value) * (1.0f / 127.0f), -1.0f); }
+		static uint16_t PackUnorm16(float value) { return static_cast<uint16_t>(Quantize(value, 0.0f, 1.0f, 65535.0f)); }
+		static float UnpackUnorm16(uint16_t value) { return static_cast<float>(value) * (1.0f / 65535.0f); }
+		static uint8_t PackUnorm8(float value) { return static_cast<uint8_t>(Quantize(value, 0.0f, 1.0f, 255.0f)); }
+		static float UnpackUnorm8(uint8_t value) { return static_cast<float>(value) * (1.0f / 255.0f); }
+
+		// Unit vectors folded onto an octahedron and stored as two snorms
+		// (x in the low half). Worst-case angular error is about 0.004 degrees
+		// for 32 bits and 0.95 degrees for 16. Zero vectors decode as +Z.
+		static uint32_t PackOctahedral32(const Vec3& unit);
+		static Vec3 UnpackOctahedral32(uint32_t packed);
+		static uint16_t PackOctahedral16(const Vec3& unit);
+		static Vec3 UnpackOctahedral16(uint16_t packed);
+
+		static void FloatToHalf(const float* in, uint16_t* out, size_t count);
+		static void HalfToFloat(const uint16_t* in, float* out, size_t count);
+		static void PackSnorm16(const float* in, int16_t* out, size_t count);
+		static void UnpackSnorm16(const int16_t* in, float* out, size_t count);
+		static void PackSnorm8(const float* in, int8_t* out, size_t count);
+		static void UnpackSnorm8(const int8_t* in, float* out, size_t count);
+		static void PackUnorm16(const float* in, uint16_t* out, size_t count);
+		static void UnpackUnorm16(const uint16_t* in, float* out, size_t count);
+		static void PackUnorm8(const float* in, uint8_t* out, size_t count);
+		static void UnpackUnorm8(const uint8_t* in, float* out, size_t count);
+
+		// Structure-of-arrays unit vectors, e.g. a Vec3Stream's X(), Y(), Z()
+		static void PackOctahedral32(const float* x, const float* y, const float* z, uint32_t* out, size_t count);
+		static void UnpackOctahedral32(const uint32_t* in, float* outX, float* outY, float* outZ, size_t count);
+
+	private:
+		// lrintf rounds to nearest even, as the SSE conversions do
+		static int32_t Quantize(float value, float min, float max, float scale) { return static_cast<int32_t>(lrintf(fminf(fmaxf(value, min), max) * scale)); }
+	};
+}
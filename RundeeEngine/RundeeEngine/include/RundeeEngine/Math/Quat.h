@@ -0,0 +1,176 @@
+//Project Name: RundeeEngine
+//File Name: Quat.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Rotation quaternion header file
+
+#pragma once
+#include "Mat3.h"
+#include <cstddef>
+
+namespace RundeeEngine
+{
+	// Unit quaternion (x, y, z) * sin(a / 2) + w * cos(a / 2), stored like a
+	// Vec4 so it loads as one register. a * b rotates by b first, then a,
+	// matching matrix composition. Angles are radians.
+	struct alignas(16) Quat
+	{
+		float x, y, z, w;
+
+		// Identity
+		constexpr Quat() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+		constexpr Quat(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+		static constexpr Quat Identity() { return Quat(); }
+		static Quat FromAxisAngle(const Vec3& axis, float radians);
+		// Applied in the order x, then y, then z
+		static Quat FromEuler(const Vec3& radians);
+		// rotation must be orthonormal
+		static Quat FromMat3(const Mat3& rotation);
+		// Shortest arc taking direction from onto direction to
+		static Quat FromTo(const Vec3& from, const Vec3& to);
+
+		bool operator==(const Quat& other) const;
+		bool operator!=(const Quat& other) const { return !(*this == other); }
+
+		Quat operator*(const Quat& other) const;
+		Quat& operator*=(const Quat& other) { return *this = *this * other; }
+		Vec3 operator*(const Vec3& vector) const { return Rotate(vector); }
+
+		Vec3 Rotate(const Vec3& vector) const;
+		float Dot(const Quat& other) const;
+		float Length() const;
+		Quat Normalize() const;
+		// Inverse of a unit quaternion
+		Quat Conjugate() const { return Quat(-x, -y, -z, w); }
+		// Inverse for any non-zero quaternion; identity when zero
+		Quat Inverse() const;
+
+		Mat3 ToMat3() const;
+		void ToAxisAngle(Vec3& axis, float& radians) const;
+		bool IsEqual(const Quat& other, float epsilon = 1e-6f) const;
+
+		// Both take the shorter path. Nlerp is cheaper and close enough for
+		// small steps such as animation blending between nearby keys.
+		static Quat Slerp(const Quat& a, const Quat& b, float t);
+		static Quat Nlerp(const Quat& a, const Quat& b, float t);
+
+		// out may alias the input
+		static void RotateVectors(const Quat& rotation, const Vec3* vectors, Vec3* out, size_t count);
+
+		#if RUNDEE_SIMD_SSE2
+		explicit Quat(__m128 value) { _mm_store_ps(&x, value); }
+		__m128 Load() const { return _mm_load_ps(&x); }
+		#endif
+	};
+
+	//----------Quat Implementation----------
+
+	inline bool Quat::operator==(const Quat& other) const
+	{
+		return x == other.x && y == other.y && z == other.z && w == other.w;
+	}
+
+	inline float Quat::Length() const
+	{
+		return sqrtf(Dot(*this));
+	}
+
+	inline Quat Quat::Inverse() const
+	{
+		float lengthSquared = Dot(*this);
+		if (lengthSquared > 0.0f)
+		{
+			float inverseLength = 1.0f / lengthSquared;
+			return Quat(-x * inverseLength, -y * inverseLength, -z * inverseLength, w * inverseLength);
+		}
+		return Quat();
+	}
+
+	inline bool Quat::IsEqual(const Quat& other, float epsilon) const
+	{
+		return fabsf(x - other.x) < epsilon && fabsf(y - other.y) < epsilon && fabsf(z - other.z) < epsilon && fabsf(w - other.w) < epsilon;
+	}
+
+	#if RUNDEE_SIMD_SSE2
+
+	// Each lane of the product is a signed dot product of a with a permutation
+	// of b, so it is four broadcasts, three shuffles and three sign flips
+	inline Quat Quat::operator*(const Quat& other) const
+	{
+		__m128 a = Load();
+		__m128 b = other.Load();
+
+		__m128 bWZYX = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+		__m128 bZWXY = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f));
+		__m128 bYXWZ = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+		__m128 result = _mm_mul_ps(SimdSplat<3>(a), b);
+		result = SimdMulAdd(SimdSplat<0>(a), bWZYX, result);
+		result = SimdMulAdd(SimdSplat<1>(a), bZWXY, result);
+		result = SimdMulAdd(SimdSplat<2>(a), bYXWZ, result);
+		return Quat(result);
+	}
+
+	// v + w * t + q x t with t = 2 * (q x v); no trigonometry or matrix needed
+	inline Vec3 Quat::Rotate(const Vec3& vector) const
+	{
+		__m128 q = Load();
+		__m128 v = _mm_setr_ps(vector.x, vector.y, vector.z, 0.0f);
+		__m128 t = SimdCross3(q, v);
+		t = _mm_add_ps(t, t);
+		__m128 result = SimdMulAdd(SimdSplat<3>(q), t, _mm_add_ps(v, SimdCross3(q, t)));
+		return Vec4(result).ToVec3();
+	}
+
+	inline float Quat::Dot(const Quat& other) const
+	{
+		return _mm_cvtss_f32(SimdSum(_mm_mul_ps(Load(), other.Load())));
+	}
+
+	inline Quat Quat::Normalize() const
+	{
+		__m128 value = Load();
+		__m128 lengthSquared = SimdSum(_mm_mul_ps(value, value));
+		if (_mm_cvtss_f32(lengthSquared) > 0.0f)
+		{
+			return Quat(_mm_div_ps(value, _mm_sqrt_ps(lengthSquared)));
+		}
+		return Quat();
+	}
+
+	#else
+
+	inline Quat Quat::operator*(const Quat& other) const
+	{
+		return Quat(
+			w * other.x + x * other.w + y * other.z - z * other.y,
+			w * other.y - x * other.z + y * other.w + z * other.x,
+			w * other.z + x * other.y - y * other.x + z * other.w,
+			w * other.w - x * other.x - y * other.y - z * other.z);
+	}
+
+	inline Vec3 Quat::Rotate(const Vec3& vector) const
+	{
+		Vec3 axis(x, y, z);
+		Vec3 t = axis.Cross(vector) * 2.0f;
+		return vector + t * w + axis.Cross(t);
+	}
+
+	inline float Quat::Dot(const Quat& other) const
+	{
+		return x * other.x + y * other.y + z * other.z + w * other.w;
+	}
+
+	inline Quat Quat::Normalize() const
+	{
+		float length = Length();
+		if (length > 0.0f)
+		{
+			return Quat(x / length, y / length, z / length, w / length);
+		}
+		return Quat();
+	}
+
+	#endif
+}
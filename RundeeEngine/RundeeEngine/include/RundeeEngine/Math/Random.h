@@ -0,0 +1,143 @@
+//Project Name: RundeeEngine
+//File Name: Random.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Pseudo-random number generators header file
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace RundeeEngine
+{
+	// Generators are small value types with no locking: give each job or
+	// thread its own. None of them are suitable for cryptography.
+
+	// PCG32 (XSH RR): 16 bytes, 2^63 independent streams selected in O(1)
+	class Pcg32
+	{
+	public:
+		explicit Pcg32(uint64_t seed = 0x853C49E6748FEA9Bull, uint64_t stream = 0);
+
+		uint32_t NextUInt32();
+		// Uniform in [0, bound) without modulo bias
+		uint32_t NextUInt32(uint32_t bound);
+		// Uniform in [0, 1)
+		float NextFloat() { return static_cast<float>(NextUInt32() >> 8) * (1.0f / 16777216.0f); }
+		float NextFloat(float min, float max) { return min + (max - min) * NextFloat(); }
+		// Uniform in [min, max]
+		int32_t NextInt(int32_t min, int32_t max);
+
+		// Skips delta outputs in O(log delta); negative deltas go backwards
+		void Advance(int64_t delta);
+
+	private:
+		uint64_t m_State;
+		uint64_t m_Increment;
+	};
+
+	// xoshiro256**: 32 bytes, period 2^256 - 1, Jump() splits the sequence
+	// into 2^128 non-overlapping subsequences for parallel work
+	class Xoshiro256
+	{
+	public:
+		explicit Xoshiro256(uint64_t seed = 0x9E3779B97F4A7C15ull);
+
+		uint64_t NextUInt64();
+		uint32_t NextUInt32() { return static_cast<uint32_t>(NextUInt64() >> 32); }
+		uint32_t NextUInt32(uint32_t bound);
+		float NextFloat() { return static_cast<float>(NextUInt64() >> 40) * (1.0f / 16777216.0f); }
+		float NextFloat(float min, float max) { return min + (max - min) * NextFloat(); }
+		double NextDouble() { return static_cast<double>(NextUInt64() >> 11) * (1.0 / 9007199254740992.0); }
+		int32_t NextInt(int32_t min, int32_t max);
+
+		// Equivalent to 2^128 / 2^192 calls of NextUInt64
+		void Jump();
+		void LongJump();
+		// The stream-th 2^128 block after seed; costs one Jump per stream
+		static Xoshiro256 ForStream(uint64_t seed, uint32_t stream);
+
+	private:
+		void ApplyJump(const uint64_t (&polynomial)[4]);
+
+		uint64_t m_State[4];
+	};
+
+	// Eight interleaved xoshiro128** generators filling arrays 8 values at a
+	// time (one AVX2 or two SSE2 registers). The integer sequence is the
+	// same on every build (float ranges may differ in the last bit where FMA
+	// is used); partial blocks discard their unused values.
+	class RandomStream
+	{
+	public:
+		explicit RandomStream(uint64_t seed, uint64_t stream = 0);
+
+		void FillUInt32(uint32_t* out, size_t count);
+		// Uniform in [0, 1)
+		void FillFloat(float* out, size_t count);
+		void FillFloat(float* out, size_t count, float min, float max);
+		// Uniform in [min, max]; bias is below range / 2^32
+		void FillInt(int32_t* out, size_t count, int32_t min, int32_t max);
+		// Uniform directions, as structure-of-arrays
+		void FillUnitVec2(float* outX, float* outY, size_t count);
+		void FillUnitVec3(float* outX, float* outY, float* outZ, size_t count);
+
+	private:
+		static constexpr size_t LaneCount = 8;
+
+		// blockCount steps of all lanes, LaneCount values per step
+		void NextBlocks(uint32_t* out, size_t blockCount);
+
+		alignas(32) uint32_t m_State[4][LaneCount];
+	};
+
+	// Per-thread generators for code that just wants a number (the rand()
+	// replacement). Each thread's generator is derived from the global seed
+	// and the order in which threads first ask, so use explicit streams
+	// where results must reproduce.
+	class Random
+	{
+	public:
+		// Reseeds every thread's generator on its next use
+		static void SetSeed(uint64_t seed);
+		// Hoist out of hot loops: each call checks for a reseed
+		static Xoshiro256& ThreadLocal();
+
+		static uint32_t NextUInt32() { return ThreadLocal().NextUInt32(); }
+		static float NextFloat() { return ThreadLocal().NextFloat(); }
+		static float NextFloat(float min, float max) { return ThreadLocal().NextFloat(min, max); }
+		static int32_t NextInt(int32_t min, int32_t max) { return ThreadLocal().NextInt(min, max); }
+
+	private:
+		static std::atomic<uint64_t> s_Seed;
+		static std::atomic<uint32_t> s_Generation;
+		static std::atomic<uint32_t> s_ThreadCount;
+	};
+
+	//----------Generator Implementation----------
+
+	inline uint32_t Pcg32::NextUInt32()
+	{
+		uint64_t state = m_State;
+		m_State = state * 6364136223846793005ull + m_Increment;
+		uint32_t xorShifted = static_cast<uint32_t>(((state >> 18) ^ state) >> 27);
+		uint32_t rotation = static_cast<uint32_t>(state >> 59);
+		return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+	}
+
+	inline uint64_t Xoshiro256::NextUInt64()
+	{
+		uint64_t* s = m_State;
+		uint64_t result = s[1] * 5;
+		result = ((result << 7) | (result >> 57)) * 9;
+		uint64_t t = s[1] << 17;
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = (s[3] << 45) | (s[3] >> 19);
+		return result;
+	}
+}
@@ -0,0 +1,489 @@
+//Project Name: RundeeEngine
+//File Name: SIMD.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: SIMD instruction set selection and shared helpers header file
+
+#pragma once
+
+// Picks the widest instruction set the compiler was told it may use.
+// x64 always has SSE2; AVX and FMA need /arch:AVX2 or -mavx -mfma.
+// Define RUNDEE_SIMD_FORCE_SCALAR to build the plain C++ fallback.
+// RUNDEE_SIMD_TARGET_AVX2 marks a file that switched its own target to
+// AVX2, FMA and F16C with a pragma, which does not define the feature
+// macros in C++ (see SimdKernelsAVX2.cpp).
+#if defined(RUNDEE_SIMD_FORCE_SCALAR)
+#define RUNDEE_SIMD_SSE2 0
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RUNDEE_SIMD_SSE2 1
+#else
+#define RUNDEE_SIMD_SSE2 0
+#endif
+
+#if RUNDEE_SIMD_SSE2 && (defined(__AVX__) || defined(RUNDEE_SIMD_TARGET_AVX2))
+#define RUNDEE_SIMD_AVX 1
+#else
+#define RUNDEE_SIMD_AVX 0
+#endif
+
+#if RUNDEE_SIMD_AVX && (defined(__AVX2__) || defined(RUNDEE_SIMD_TARGET_AVX2))
+#define RUNDEE_SIMD_AVX2 1
+#else
+#define RUNDEE_SIMD_AVX2 0
+#endif
+
+// MSVC has no __FMA__; /arch:AVX2 implies it
+#if RUNDEE_SIMD_AVX && (defined(__FMA__) || defined(__AVX2__) || defined(RUNDEE_SIMD_TARGET_AVX2))
+#define RUNDEE_SIMD_FMA 1
+#else
+#define RUNDEE_SIMD_FMA 0
+#endif
+
+// Half-precision conversions; likewise implied by /arch:AVX2
+#if RUNDEE_SIMD_AVX && (defined(__F16C__) || defined(__AVX2__) || defined(RUNDEE_SIMD_TARGET_AVX2))
+#define RUNDEE_SIMD_F16C 1
+#else
+#define RUNDEE_SIMD_F16C 0
+#endif
+
+#if RUNDEE_SIMD_AVX
+#include <immintrin.h>
+#elif RUNDEE_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Kernel files may be built for a wider instruction set than the rest of
+// the engine (see SimdKernels), and the lanes differ per build. Naming the
+// inline namespace after the build keeps the linker from merging copies.
+#if RUNDEE_SIMD_AVX2
+#define RUNDEE_SIMD_NAMESPACE SimdAVX2
+#elif RUNDEE_SIMD_AVX && RUNDEE_SIMD_FMA
+#define RUNDEE_SIMD_NAMESPACE SimdAVXFMA
+#elif RUNDEE_SIMD_AVX
+#define RUNDEE_SIMD_NAMESPACE SimdAVX
+#elif RUNDEE_SIMD_SSE2
+#define RUNDEE_SIMD_NAMESPACE SimdSSE2
+#else
+#define RUNDEE_SIMD_NAMESPACE SimdScalar
+#endif
+
+namespace RundeeEngine
+{
+	inline namespace RUNDEE_SIMD_NAMESPACE
+	{
+		#if RUNDEE_SIMD_SSE2
+		// a * b + c, fused when FMA is available
+		inline __m128 SimdMulAdd(__m128 a, __m128 b, __m128 c)
+		{
+			#if RUNDEE_SIMD_FMA
+			return _mm_fmadd_ps(a, b, c);
+			#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+			#endif
+		}
+
+		template<int Lane>
+		inline __m128 SimdSplat(__m128 value)
+		{
+			return _mm_shuffle_ps(value, value, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+		}
+
+		// Horizontal sum broadcast to every lane
+		inline __m128 SimdSum(__m128 value)
+		{
+			__m128 sum = _mm_add_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+		}
+
+		// Cross product of the xyz lanes; w comes out as zero
+		inline __m128 SimdCross3(__m128 a, __m128 b)
+		{
+			__m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+			__m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+			__m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+			return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+		}
+
+		// Deinterleaves four packed xyz triples (12 floats) into x, y and z registers
+		inline void SimdLoadXYZ4(const float* source, __m128& x, __m128& y, __m128& z)
+		{
+			__m128 m0 = _mm_loadu_ps(source);
+			__m128 m1 = _mm_loadu_ps(source + 4);
+			__m128 m2 = _mm_loadu_ps(source + 8);
+
+			__m128 xy = _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 1, 3, 2));
+			__m128 yz = _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 0, 2, 1));
+			x = _mm_shuffle_ps(m0, xy, _MM_SHUFFLE(2, 0, 3, 0));
+			y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+			z = _mm_shuffle_ps(yz, m2, _MM_SHUFFLE(3, 0, 3, 1));
+		}
+
+		// Inverse of SimdLoadXYZ4
+		inline void SimdStoreXYZ4(float* destination, __m128 x, __m128 y, __m128 z)
+		{
+			__m128 xy = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+			__m128 yz = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+			__m128 zx = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+			_mm_storeu_ps(destination, _mm_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(destination + 4, _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)));
+			_mm_storeu_ps(destination + 8, _mm_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+		#endif
+
+		#if RUNDEE_SIMD_AVX
+		inline __m256 SimdMulAdd(__m256 a, __m256 b, __m256 c)
+		{
+			#if RUNDEE_SIMD_FMA
+			return _mm256_fmadd_ps(a, b, c);
+			#else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+			#endif
+		}
+
+		// Eight xyz triples (24 floats). Lanes come out in the order 0,1,2,3 in the
+		// low half and 4,5,6,7 in the high half, matching SimdStoreXYZ8.
+		inline void SimdLoadXYZ8(const float* source, __m256& x, __m256& y, __m256& z)
+		{
+			__m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(source)), _mm_loadu_ps(source + 12), 1);
+			__m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(source + 4)), _mm_loadu_ps(source + 16), 1);
+			__m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(source + 8)), _mm_loadu_ps(source + 20), 1);
+
+			__m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+			__m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+			x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+			y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+			z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+		}
+
+		inline void SimdStoreXYZ8(float* destination, __m256 x, __m256 y, __m256 z)
+		{
+			__m256 xy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+			__m256 yz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+			__m256 zx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+			__m256 r03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+			__m256 r14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+			__m256 r25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+
+			_mm_storeu_ps(destination, _mm256_castps256_ps128(r03));
+			_mm_storeu_ps(destination + 4, _mm256_castps256_ps128(r14));
+			_mm_storeu_ps(destination + 8, _mm256_castps256_ps128(r25));
+			_mm_storeu_ps(destination + 12, _mm256_extractf128_ps(r03, 1));
+			_mm_storeu_ps(destination + 16, _mm256_extractf128_ps(r14, 1));
+			_mm_storeu_ps(destination + 20, _mm256_extractf128_ps(r25, 1));
+		}
+		#endif
+
+		// Uniform wrappers so a batch kernel can be written once as a template and
+		// instantiated for 1, 4 and 8 lanes. Loads and stores are unaligned.
+		// Comparisons return all-ones or all-zero bit masks in the float type for
+		// And/Select; IntType holds 32-bit integer lanes for bit manipulation.
+		struct SimdFloat1
+		{
+			using Type = float;
+			using IntType = int32_t;
+			static constexpr size_t Width = 1;
+
+			static Type Load(const float* source) { return *source; }
+			static void Store(float* destination, Type value) { *destination = value; }
+			static Type Set(float value) { return value; }
+			static Type Add(Type a, Type b) { return a + b; }
+			static Type Sub(Type a, Type b) { return a - b; }
+			static Type Mul(Type a, Type b) { return a * b; }
+			static Type Div(Type a, Type b) { return a / b; }
+			static Type MulAdd(Type a, Type b, Type c) { return a * b + c; }
+			static Type Min(Type a, Type b) { return a < b ? a : b; }
+			static Type Max(Type a, Type b) { return a > b ? a : b; }
+			static Type Abs(Type value) { return fabsf(value); }
+			static Type Sqrt(Type value) { return sqrtf(value); }
+
+			static Type RSqrt(Type value)
+			{
+				#if RUNDEE_SIMD_SSE2
+				// Same estimate and refinement as the wide lanes so tails match
+				__m128 v = _mm_set_ss(value);
+				__m128 estimate = _mm_rsqrt_ss(v);
+				__m128 halfValue = _mm_mul_ss(v, _mm_set_ss(0.5f));
+				__m128 correction = _mm_sub_ss(_mm_set_ss(1.5f), _mm_mul_ss(halfValue, _mm_mul_ss(estimate, estimate)));
+				return _mm_cvtss_f32(_mm_mul_ss(estimate, correction));
+				#else
+				return 1.0f / sqrtf(value);
+				#endif
+			}
+
+			// value where test > 0, otherwise zero
+			static Type KeepWherePositive(Type value, Type test) { return test > 0.0f ? value : 0.0f; }
+
+			static Type AsFloat(IntType value) { float result; memcpy(&result, &value, sizeof(result)); return result; }
+			static IntType AsInt(Type value) { int32_t result; memcpy(&result, &value, sizeof(result)); return result; }
+			static Type Mask(bool condition) { return AsFloat(-static_cast<int32_t>(condition)); }
+
+			static Type And(Type a, Type b) { return AsFloat(AsInt(a) & AsInt(b)); }
+			static Type Or(Type a, Type b) { return AsFloat(AsInt(a) | AsInt(b)); }
+			static Type Xor(Type a, Type b) { return AsFloat(AsInt(a) ^ AsInt(b)); }
+			// Bitwise rather than a branch: the masks are usually data dependent
+			static Type Select(Type mask, Type a, Type b) { return AsFloat((AsInt(mask) & AsInt(a)) | (~AsInt(mask) & AsInt(b))); }
+			static Type CmpLt(Type a, Type b) { return Mask(a < b); }
+			static Type CmpLe(Type a, Type b) { return Mask(a <= b); }
+			static Type CmpGt(Type a, Type b) { return Mask(a > b); }
+			static Type CmpEq(Type a, Type b) { return Mask(a == b); }
+			// Writes 1 for set mask lanes and 0 otherwise, one byte per lane
+			static void StoreMask(uint8_t* destination, Type mask) { *destination = static_cast<uint8_t>(static_cast<uint32_t>(AsInt(mask)) >> 31); }
+
+			static IntType IntLoad(const int32_t* source) { return *source; }
+			static Type Gather(const float* base, IntType indices) { return base[indices]; }
+			static void IntStore(int32_t* destination, IntType value) { *destination = value; }
+			static IntType IntSet(int32_t value) { return value; }
+			// Wrapping like the vector lanes; hashes rely on it
+			static IntType IntAdd(IntType a, IntType b) { return static_cast<int32_t>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b)); }
+			static IntType IntAnd(IntType a, IntType b) { return a & b; }
+			static IntType IntXor(IntType a, IntType b) { return a ^ b; }
+			// Low 32 bits of the product, wrapping
+			static IntType IntMul(IntType a, IntType b) { return static_cast<int32_t>(static_cast<uint32_t>(a) * static_cast<uint32_t>(b)); }
+			static Type IntEq(IntType a, IntType b) { return Mask(a == b); }
+			template<int Shift> static IntType IntShiftLeft(IntType value) { return static_cast<int32_t>(static_cast<uint32_t>(value) << Shift); }
+			template<int Shift> static IntType IntShiftRight(IntType value) { return static_cast<int32_t>(static_cast<uint32_t>(value) >> Shift); }
+			static Type IntToFloat(IntType value) { return static_cast<float>(value); }
+
+			// Round to nearest, ties to even like the vector lanes
+			static IntType RoundToInt(Type value)
+			{
+				#if RUNDEE_SIMD_SSE2
+				return _mm_cvtss_si32(_mm_set_ss(value));
+				#else
+				return ToInt(nearbyintf(value));
+				#endif
+			}
+			static IntType FloorToInt(Type value) { return ToInt(floorf(value)); }
+
+			// Out of range and NaN give INT32_MIN like the SSE conversions,
+			// where a plain cast would be undefined
+			static IntType ToInt(Type value)
+			{
+				return value >= -2147483648.0f && value < 2147483648.0f ? static_cast<int32_t>(value) : INT32_MIN;
+			}
+		};
+
+		#if RUNDEE_SIMD_SSE2
+		struct SimdFloat4
+		{
+			using Type = __m128;
+			using IntType = __m128i;
+			static constexpr size_t Width = 4;
+
+			static Type Load(const float* source) { return _mm_loadu_ps(source); }
+			static void Store(float* destination, Type value) { _mm_storeu_ps(destination, value); }
+			static Type Set(float value) { return _mm_set1_ps(value); }
+			static Type Add(Type a, Type b) { return _mm_add_ps(a, b); }
+			static Type Sub(Type a, Type b) { return _mm_sub_ps(a, b); }
+			static Type Mul(Type a, Type b) { return _mm_mul_ps(a, b); }
+			static Type Div(Type a, Type b) { return _mm_div_ps(a, b); }
+			static Type MulAdd(Type a, Type b, Type c) { return SimdMulAdd(a, b, c); }
+			static Type Min(Type a, Type b) { return _mm_min_ps(a, b); }
+			static Type Max(Type a, Type b) { return _mm_max_ps(a, b); }
+			static Type Abs(Type value) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), value); }
+			static Type Sqrt(Type value) { return _mm_sqrt_ps(value); }
+
+			// Hardware estimate refined by one Newton-Raphson step
+			static Type RSqrt(Type value)
+			{
+				__m128 estimate = _mm_rsqrt_ps(value);
+				__m128 halfValue = _mm_mul_ps(value, _mm_set1_ps(0.5f));
+				__m128 correction = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfValue, _mm_mul_ps(estimate, estimate)));
+				return _mm_mul_ps(estimate, correction);
+			}
+
+			static Type KeepWherePositive(Type value, Type test) { return _mm_and_ps(value, _mm_cmpgt_ps(test, _mm_setzero_ps())); }
+
+			static Type AsFloat(IntType value) { return _mm_castsi128_ps(value); }
+			static IntType AsInt(Type value) { return _mm_castps_si128(value); }
+
+			static Type And(Type a, Type b) { return _mm_and_ps(a, b); }
+			static Type Or(Type a, Type b) { return _mm_or_ps(a, b); }
+			static Type Xor(Type a, Type b) { return _mm_xor_ps(a, b); }
+			static Type Select(Type mask, Type a, Type b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+			static Type CmpLt(Type a, Type b) { return _mm_cmplt_ps(a, b); }
+			static Type CmpLe(Type a, Type b) { return _mm_cmple_ps(a, b); }
+			static Type CmpGt(Type a, Type b) { return _mm_cmpgt_ps(a, b); }
+			static Type CmpEq(Type a, Type b) { return _mm_cmpeq_ps(a, b); }
+
+			static void StoreMask(uint8_t* destination, Type mask)
+			{
+				__m128i words = _mm_packs_epi32(_mm_castps_si128(mask), _mm_setzero_si128());
+				__m128i bytes = _mm_and_si128(_mm_packs_epi16(words, words), _mm_set1_epi8(1));
+				int32_t packed = _mm_cvtsi128_si32(bytes);
+				memcpy(destination, &packed, sizeof(packed));
+			}
+
+			static IntType IntLoad(const int32_t* source) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)); }
+
+			static Type Gather(const float* base, IntType indices)
+			{
+				#if RUNDEE_SIMD_AVX2
+				return _mm_i32gather_ps(base, indices, 4);
+				#else
+				alignas(16) int32_t index[4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(index), indices);
+				return _mm_setr_ps(base[index[0]], base[index[1]], base[index[2]], base[index[3]]);
+				#endif
+			}
+
+			static void IntStore(int32_t* destination, IntType value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value); }
+			static IntType IntSet(int32_t value) { return _mm_set1_epi32(value); }
+			static IntType IntAdd(IntType a, IntType b) { return _mm_add_epi32(a, b); }
+			static IntType IntAnd(IntType a, IntType b) { return _mm_and_si128(a, b); }
+			static IntType IntXor(IntType a, IntType b) { return _mm_xor_si128(a, b); }
+
+			static IntType IntMul(IntType a, IntType b)
+			{
+				#if RUNDEE_SIMD_AVX
+				return _mm_mullo_epi32(a, b);
+				#else
+				// SSE2 multiplies even lanes only; do the odd ones shifted down and interleave
+				__m128i even = _mm_mul_epu32(a, b);
+				__m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+				return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+				#endif
+			}
+
+			static Type IntEq(IntType a, IntType b) { return _mm_castsi128_ps(_mm_cmpeq_epi32(a, b)); }
+			template<int Shift> static IntType IntShiftLeft(IntType value) { return _mm_slli_epi32(value, Shift); }
+			template<int Shift> static IntType IntShiftRight(IntType value) { return _mm_srli_epi32(value, Shift); }
+			static Type IntToFloat(IntType value) { return _mm_cvtepi32_ps(value); }
+			static IntType RoundToInt(Type value) { return _mm_cvtps_epi32(value); }
+
+			// Truncate, then step down where truncation rounded a negative value up
+			static IntType FloorToInt(Type value)
+			{
+				__m128i truncated = _mm_cvttps_epi32(value);
+				return _mm_add_epi32(truncated, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(truncated), value)));
+			}
+		};
+		#endif
+
+		#if RUNDEE_SIMD_AVX
+		struct SimdFloat8
+		{
+			using Type = __m256;
+			using IntType = __m256i;
+			static constexpr size_t Width = 8;
+
+			static Type Load(const float* source) { return _mm256_loadu_ps(source); }
+			static void Store(float* destination, Type value) { _mm256_storeu_ps(destination, value); }
+			static Type Set(float value) { return _mm256_set1_ps(value); }
+			static Type Add(Type a, Type b) { return _mm256_add_ps(a, b); }
+			static Type Sub(Type a, Type b) { return _mm256_sub_ps(a, b); }
+			static Type Mul(Type a, Type b) { return _mm256_mul_ps(a, b); }
+			static Type Div(Type a, Type b) { return _mm256_div_ps(a, b); }
+			static Type MulAdd(Type a, Type b, Type c) { return SimdMulAdd(a, b, c); }
+			static Type Min(Type a, Type b) { return _mm256_min_ps(a, b); }
+			static Type Max(Type a, Type b) { return _mm256_max_ps(a, b); }
+			static Type Abs(Type value) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value); }
+			static Type Sqrt(Type value) { return _mm256_sqrt_ps(value); }
+
+			static Type RSqrt(Type value)
+			{
+				__m256 estimate = _mm256_rsqrt_ps(value);
+				__m256 halfValue = _mm256_mul_ps(value, _mm256_set1_ps(0.5f));
+				__m256 correction = _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfValue, _mm256_mul_ps(estimate, estimate)));
+				return _mm256_mul_ps(estimate, correction);
+			}
+
+			static Type KeepWherePositive(Type value, Type test) { return _mm256_and_ps(value, _mm256_cmp_ps(test, _mm256_setzero_ps(), _CMP_GT_OQ)); }
+
+			static Type AsFloat(IntType value) { return _mm256_castsi256_ps(value); }
+			static IntType AsInt(Type value) { return _mm256_castps_si256(value); }
+
+			static Type And(Type a, Type b) { return _mm256_and_ps(a, b); }
+			static Type Or(Type a, Type b) { return _mm256_or_ps(a, b); }
+			static Type Xor(Type a, Type b) { return _mm256_xor_ps(a, b); }
+			static Type Select(Type mask, Type a, Type b) { return _mm256_blendv_ps(b, a, mask); }
+			static Type CmpLt(Type a, Type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+			static Type CmpLe(Type a, Type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+			static Type CmpGt(Type a, Type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+			static Type CmpEq(Type a, Type b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+
+			static void StoreMask(uint8_t* destination, Type mask)
+			{
+				__m128i words = _mm_packs_epi32(_mm_castps_si128(_mm256_castps256_ps128(mask)), _mm_castps_si128(_mm256_extractf128_ps(mask, 1)));
+				__m128i bytes = _mm_and_si128(_mm_packs_epi16(words, words), _mm_set1_epi8(1));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(destination), bytes);
+			}
+
+			static IntType IntLoad(const int32_t* source) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)); }
+
+			static Type Gather(const float* base, IntType indices)
+			{
+				#if RUNDEE_SIMD_AVX2
+				return _mm256_i32gather_ps(base, indices, 4);
+				#else
+				alignas(32) int32_t index[8];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(index), indices);
+				return _mm256_setr_ps(base[index[0]], base[index[1]], base[index[2]], base[index[3]],
+					base[index[4]], base[index[5]], base[index[6]], base[index[7]]);
+				#endif
+			}
+
+			static void IntStore(int32_t* destination, IntType value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value); }
+			static IntType IntSet(int32_t value) { return _mm256_set1_epi32(value); }
+			static IntType IntAnd(IntType a, IntType b) { return AsInt(_mm256_and_ps(AsFloat(a), AsFloat(b))); }
+			static Type IntToFloat(IntType value) { return _mm256_cvtepi32_ps(value); }
+			static IntType RoundToInt(Type value) { return _mm256_cvtps_epi32(value); }
+			static IntType FloorToInt(Type value) { return _mm256_cvttps_epi32(_mm256_floor_ps(value)); }
+			static IntType IntXor(IntType a, IntType b) { return AsInt(_mm256_xor_ps(AsFloat(a), AsFloat(b))); }
+
+			#if RUNDEE_SIMD_AVX2
+			static IntType IntAdd(IntType a, IntType b) { return _mm256_add_epi32(a, b); }
+			static IntType IntMul(IntType a, IntType b) { return _mm256_mullo_epi32(a, b); }
+			static Type IntEq(IntType a, IntType b) { return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)); }
+			template<int Shift> static IntType IntShiftLeft(IntType value) { return _mm256_slli_epi32(value, Shift); }
+			template<int Shift> static IntType IntShiftRight(IntType value) { return _mm256_srli_epi32(value, Shift); }
+			#else
+			// AVX1 has no 256-bit integer arithmetic, so work on the two halves
+			static IntType Combine(__m128i low, __m128i high) { return _mm256_insertf128_si256(_mm256_castsi128_si256(low), high, 1); }
+			static __m128i Low(IntType value) { return _mm256_castsi256_si128(value); }
+			static __m128i High(IntType value) { return _mm256_extractf128_si256(value, 1); }
+
+			static IntType IntAdd(IntType a, IntType b) { return Combine(_mm_add_epi32(Low(a), Low(b)), _mm_add_epi32(High(a), High(b))); }
+			static IntType IntMul(IntType a, IntType b) { return Combine(_mm_mullo_epi32(Low(a), Low(b)), _mm_mullo_epi32(High(a), High(b))); }
+			static Type IntEq(IntType a, IntType b) { return AsFloat(Combine(_mm_cmpeq_epi32(Low(a), Low(b)), _mm_cmpeq_epi32(High(a), High(b)))); }
+			template<int Shift> static IntType IntShiftLeft(IntType value) { return Combine(_mm_slli_epi32(Low(value), Shift), _mm_slli_epi32(High(value), Shift)); }
+			template<int Shift> static IntType IntShiftRight(IntType value) { return Combine(_mm_srli_epi32(Low(value), Shift), _mm_srli_epi32(High(value), Shift)); }
+			#endif
+		};
+		#endif
+
+		// Calls kernel(lane, index) over [0, count) with the widest lane type
+		// available, then narrower ones for the tail. The kernel is typically a
+		// generic lambda taking the lane as auto.
+		template<typename Kernel>
+		inline void SimdForEach(size_t count, const Kernel& kernel)
+		{
+			size_t i = 0;
+			#if RUNDEE_SIMD_AVX
+			for (; i + SimdFloat8::Width <= count; i += SimdFloat8::Width)
+			{
+				kernel(SimdFloat8(), i);
+			}
+			#endif
+
+			#if RUNDEE_SIMD_SSE2
+			for (; i + SimdFloat4::Width <= count; i += SimdFloat4::Width)
+			{
+				kernel(SimdFloat4(), i);
+			}
+			#endif
+
+			for (; i < count; ++i)
+			{
+				kernel(SimdFloat1(), i);
+			}
+		}
+	}
+}
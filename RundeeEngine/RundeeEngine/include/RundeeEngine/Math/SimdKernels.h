@@ -0,0 +1,131 @@
+//Project Name: RundeeEngine
+//File Name: SimdKernels.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Runtime-dispatched SIMD kernel tables header file
+
+#pragma once
+#include "../Common/CPUFeatures.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace RundeeEngine
+{
+	struct NoiseSettings;
+
+	struct SimdVec2In
+	{
+		const float* X;
+		const float* Y;
+	};
+
+	// Structure-of-arrays Vec3 inputs and outputs, e.g. a Vec3Stream's X(), Y(), Z()
+	struct SimdVec3In
+	{
+		const float* X;
+		const float* Y;
+		const float* Z;
+	};
+
+	struct SimdVec3Out
+	{
+		float* X;
+		float* Y;
+		float* Z;
+	};
+
+	// One set of kernels compiled for one instruction set. The engine-facing
+	// wrappers (Vec3Stream, the Bounds batch tests, FastMath's arrays,
+	// Noise's grids, Packing's batches) validate their inputs and call
+	// through SimdKernels::Get(); the tables themselves do no checking.
+	struct SimdKernelTable
+	{
+		// Instruction set the table was compiled for
+		SimdLevel Level;
+		const char* Name;
+
+		// Vec3 math
+		void (*Add)(SimdVec3In a, SimdVec3In b, SimdVec3Out out, size_t count);
+		void (*Subtract)(SimdVec3In a, SimdVec3In b, SimdVec3Out out, size_t count);
+		void (*Scale)(SimdVec3In a, float scalar, SimdVec3Out out, size_t count);
+		// out = a + b * scalar
+		void (*MulAdd)(SimdVec3In a, SimdVec3In b, float scalar, SimdVec3Out out, size_t count);
+		void (*Lerp)(SimdVec3In a, SimdVec3In b, float t, SimdVec3Out out, size_t count);
+		void (*Normalize)(SimdVec3In a, SimdVec3Out out, size_t count);
+		void (*Dot)(SimdVec3In a, SimdVec3In b, float* out, size_t count);
+		void (*Length)(SimdVec3In a, float* out, size_t count);
+		void (*LengthSquared)(SimdVec3In a, float* out, size_t count);
+		void (*Distance)(SimdVec3In a, SimdVec3In b, float* out, size_t count);
+
+		// Culling and overlap tests; out gets 1 per hit, 0 otherwise
+		// planes: six (normal x, y, z, distance) rows; 1 inside, 0 outside
+		void (*FrustumSpheres)(const float* planes, SimdVec3In centers, const float* radius, uint8_t* out, size_t count);
+		void (*FrustumBoxes)(const float* planes, SimdVec3In mins, SimdVec3In maxs, uint8_t* out, size_t count);
+		// query: min x, y, max x, y
+		void (*OverlapRects)(const float* query, SimdVec2In mins, SimdVec2In maxs, uint8_t* out, size_t count);
+		// query: min x, y, z, max x, y, z
+		void (*OverlapBoxes)(const float* query, SimdVec3In mins, SimdVec3In maxs, uint8_t* out, size_t count);
+		// query: center x, y, z, radius
+		void (*OverlapSpheres)(const float* query, SimdVec3In centers, const float* radius, uint8_t* out, size_t count);
+		// ray: origin x, y, z, then 1 / direction x, y, z; outDistances may be nullptr
+		void (*RayBoxes)(const float* ray, SimdVec3In mins, SimdVec3In maxs, float maxDistance, uint8_t* out, float* outDistances, size_t count);
+
+		// FastMath arrays at MathPrecision::Fast
+		void (*Sin)(const float* x, float* out, size_t count);
+		void (*Cos)(const float* x, float* out, size_t count);
+		void (*SinCos)(const float* x, float* outSin, float* outCos, size_t count);
+		void (*Atan2)(const float* y, const float* x, float* out, size_t count);
+		void (*RSqrt)(const float* x, float* out, size_t count);
+		void (*Exp)(const float* x, float* out, size_t count);
+		void (*Log)(const float* x, float* out, size_t count);
+
+		// One row of a Noise grid: out[i] is the sample at (x[i], y) or (x[i], y, z)
+		void (*NoiseRow2D)(const NoiseSettings& settings, const float* x, float y, float* out, size_t count);
+		void (*NoiseRow3D)(const NoiseSettings& settings, const float* x, float y, float z, float* out, size_t count);
+
+		// Packing batches. The AVX2 half conversions use F16C; its NaNs can
+		// carry different payload bits from the software conversion's
+		void (*FloatToHalf)(const float* in, uint16_t* out, size_t count);
+		void (*HalfToFloat)(const uint16_t* in, float* out, size_t count);
+		void (*PackSnorm16)(const float* in, int16_t* out, size_t count);
+		void (*UnpackSnorm16)(const int16_t* in, float* out, size_t count);
+		void (*PackSnorm8)(const float* in, int8_t* out, size_t count);
+		void (*UnpackSnorm8)(const int8_t* in, float* out, size_t count);
+		void (*PackUnorm16)(const float* in, uint16_t* out, size_t count);
+		void (*UnpackUnorm16)(const uint16_t* in, float* out, size_t count);
+		void (*PackUnorm8)(const float* in, uint8_t* out, size_t count);
+		void (*UnpackUnorm8)(const uint8_t* in, float* out, size_t count);
+		void (*PackOctahedral32)(SimdVec3In in, uint32_t* out, size_t count);
+		void (*UnpackOctahedral32)(const uint32_t* in, SimdVec3Out out, size_t count);
+	};
+
+	// Tables exist for scalar, SSE2 and AVX2 + FMA; SSE4.2 CPUs use the SSE2
+	// table and AVX-512 CPUs the AVX2 one. Results agree with the scalar
+	// reference to within FMA rounding, which can flip a test or a noise
+	// cell sitting exactly on a boundary, and the rsqrt estimate in
+	// Normalize and RSqrt.
+	//
+	// Still chosen at compile time, so their AVX paths only run in builds
+	// that target AVX: Vec3Stream::FromAoS and ToAoS, Mat3::TransformVectors,
+	// Mat4::TransformPoints, TransformVectors and Transform,
+	// RandomStream::Fill*, the FixedMath batch functions, and
+	// Curve::Evaluate and Sample. The engine has no audio mixer yet, so
+	// there are no mixing kernels either.
+	class SimdKernels
+	{
+	public:
+		// The bound table; binds to CPUFeatures::GetLevel() on first use
+		static const SimdKernelTable& Get();
+		// Plain C++ versions of every kernel, for verifying the others
+		static const SimdKernelTable& GetReference();
+		// The table used for a level, nullptr if the CPU or this build lacks it
+		static const SimdKernelTable* GetTable(SimdLevel level);
+
+		// Testing override: binds the best table at or below level that the
+		// CPU supports, and returns the level of the table bound. Not
+		// synchronised with kernels running on other threads.
+		static SimdLevel SetLevel(SimdLevel level);
+		// Back to CPUFeatures::GetLevel()
+		static void ResetLevel() { SetLevel(CPUFeatures::GetLevel()); }
+	};
+}
@@ -0,0 +1,54 @@
+//Project Name: RundeeEngine
+//File Name: Transform.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Translation, rotation and scale transform header file
+
+#pragma once
+#include "Mat4.h"
+#include "Quat.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace RundeeEngine
+{
+	// Scale, then rotate, then translate. Composition and inverse are exact
+	// for uniform scale; with non-uniform scale under a rotated parent the
+	// shear cannot be stored in TRS form, so hierarchies that need it should
+	// compose matrices with ComputeWorldMatrices instead.
+	struct alignas(16) Transform
+	{
+		Quat Rotation;
+		Vec3 Translation;
+		Vec3 Scale;
+
+		// Identity
+		Transform() : Rotation(), Translation(), Scale(Vec3::One()) {}
+		Transform(const Vec3& translation, const Quat& rotation = Quat(), const Vec3& scale = Vec3::One())
+			: Rotation(rotation), Translation(translation), Scale(scale) {}
+
+		static Transform Identity() { return Transform(); }
+
+		// this * child: the child's transform expressed in this transform's parent space
+		Transform operator*(const Transform& child) const;
+		Transform& operator*=(const Transform& child) { return *this = *this * child; }
+
+		Vec3 TransformPoint(const Vec3& point) const { return Translation + Rotation.Rotate(point * Scale); }
+		Vec3 TransformVector(const Vec3& vector) const { return Rotation.Rotate(vector * Scale); }
+		// Zero scale axes map to zero, matching the vector divide-by-zero convention
+		Transform Inverse() const;
+
+		Mat4 ToMat4() const;
+
+		// Translation and scale lerp, rotation nlerp
+		static Transform Lerp(const Transform& a, const Transform& b, float t);
+
+		// out may alias the input
+		static void TransformPoints(const Transform& transform, const Vec3* points, Vec3* out, size_t count);
+
+		// Hierarchy update. parents[i] is the index of node i's parent or -1
+		// for a root, and every parent must come before its children.
+		static void ComputeWorld(const Transform* locals, const int32_t* parents, Transform* worlds, size_t count);
+		static void ComputeWorldMatrices(const Transform* locals, const int32_t* parents, Mat4* worlds, size_t count);
+	};
+}
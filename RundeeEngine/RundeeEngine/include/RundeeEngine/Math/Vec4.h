@@ -0,0 +1,281 @@
+//Project Name: RundeeEngine
+//File Name: Vec4.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: 16-byte aligned four component vector header file
+
+#pragma once
+#include "SIMD.h"
+#include "../Common/CommonType.h"
+#include <cmath>
+
+namespace RundeeEngine
+{
+	// Same conventions as Vec2/Vec3 (division by zero yields zero) but laid
+	// out as one SSE register so every operator is a single instruction.
+	struct alignas(16) Vec4
+	{
+		float x, y, z, w;
+		constexpr Vec4(float x = 0.0f, float y = 0.0f, float z = 0.0f, float w = 0.0f) : x(x), y(y), z(z), w(w) {}
+		constexpr Vec4(const Vec3& xyz, float w) : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+
+		static constexpr Vec4 Zero() { return Vec4(0.0f, 0.0f, 0.0f, 0.0f); }
+		static constexpr Vec4 One() { return Vec4(1.0f, 1.0f, 1.0f, 1.0f); }
+		static constexpr Vec4 UnitX() { return Vec4(1.0f, 0.0f, 0.0f, 0.0f); }
+		static constexpr Vec4 UnitY() { return Vec4(0.0f, 1.0f, 0.0f, 0.0f); }
+		static constexpr Vec4 UnitZ() { return Vec4(0.0f, 0.0f, 1.0f, 0.0f); }
+		static constexpr Vec4 UnitW() { return Vec4(0.0f, 0.0f, 0.0f, 1.0f); }
+
+		constexpr Vec3 ToVec3() const { return Vec3(x, y, z); }
+
+		bool operator==(const Vec4& other) const;
+		bool operator!=(const Vec4& other) const;
+
+		Vec4 operator+(const Vec4& other) const;
+		Vec4 operator-(const Vec4& other) const;
+		Vec4 operator*(float scalar) const;
+		Vec4 operator/(float scalar) const;
+		Vec4& operator+=(const Vec4& other);
+		Vec4& operator-=(const Vec4& other);
+		Vec4& operator*=(float scalar);
+		Vec4& operator/=(float scalar);
+		Vec4 operator-() const;
+		Vec4 operator*(const Vec4& other) const;
+		Vec4 operator/(const Vec4& other) const;
+
+		float Length() const;
+		float LengthSquared() const;
+		Vec4 Normalize() const;
+		float Dot(const Vec4& other) const;
+		Vec4 Lerp(const Vec4& other, float t) const;
+		Vec4 Min(const Vec4& other) const;
+		Vec4 Max(const Vec4& other) const;
+
+		bool IsZero() const;
+		bool IsEqual(const Vec4& other, float epsilon = 1e-6f) const;
+
+		#if RUNDEE_SIMD_SSE2
+		explicit Vec4(__m128 value) { _mm_store_ps(&x, value); }
+		__m128 Load() const { return _mm_load_ps(&x); }
+		#endif
+	};
+
+	//----------Vec4 Implementation----------
+
+	#if RUNDEE_SIMD_SSE2
+
+	inline bool Vec4::operator==(const Vec4& other) const
+	{
+		return _mm_movemask_ps(_mm_cmpeq_ps(Load(), other.Load())) == 0xF;
+	}
+
+	inline Vec4 Vec4::operator+(const Vec4& other) const
+	{
+		return Vec4(_mm_add_ps(Load(), other.Load()));
+	}
+
+	inline Vec4 Vec4::operator-(const Vec4& other) const
+	{
+		return Vec4(_mm_sub_ps(Load(), other.Load()));
+	}
+
+	inline Vec4 Vec4::operator*(float scalar) const
+	{
+		return Vec4(_mm_mul_ps(Load(), _mm_set1_ps(scalar)));
+	}
+
+	inline Vec4 Vec4::operator/(float scalar) const
+	{
+		if (scalar != 0.0f)
+		{
+			return Vec4(_mm_div_ps(Load(), _mm_set1_ps(scalar)));
+		}
+		return Vec4();
+	}
+
+	inline Vec4 Vec4::operator-() const
+	{
+		return Vec4(_mm_sub_ps(_mm_setzero_ps(), Load()));
+	}
+
+	inline Vec4 Vec4::operator*(const Vec4& other) const
+	{
+		return Vec4(_mm_mul_ps(Load(), other.Load()));
+	}
+
+	inline Vec4 Vec4::operator/(const Vec4& other) const
+	{
+		// Lanes dividing by zero are masked to zero
+		__m128 divisor = other.Load();
+		__m128 nonZero = _mm_cmpneq_ps(divisor, _mm_setzero_ps());
+		return Vec4(_mm_and_ps(_mm_div_ps(Load(), divisor), nonZero));
+	}
+
+	inline float Vec4::Dot(const Vec4& other) const
+	{
+		return _mm_cvtss_f32(SimdSum(_mm_mul_ps(Load(), other.Load())));
+	}
+
+	inline Vec4 Vec4::Normalize() const
+	{
+		__m128 value = Load();
+		__m128 lengthSquared = SimdSum(_mm_mul_ps(value, value));
+		if (_mm_cvtss_f32(lengthSquared) > 0.0f)
+		{
+			return Vec4(_mm_div_ps(value, _mm_sqrt_ps(lengthSquared)));
+		}
+		return Vec4();
+	}
+
+	inline Vec4 Vec4::Lerp(const Vec4& other, float t) const
+	{
+		__m128 from = Load();
+		return Vec4(SimdMulAdd(_mm_sub_ps(other.Load(), from), _mm_set1_ps(t), from));
+	}
+
+	inline Vec4 Vec4::Min(const Vec4& other) const
+	{
+		return Vec4(_mm_min_ps(Load(), other.Load()));
+	}
+
+	inline Vec4 Vec4::Max(const Vec4& other) const
+	{
+		return Vec4(_mm_max_ps(Load(), other.Load()));
+	}
+
+	inline bool Vec4::IsZero() const
+	{
+		return _mm_movemask_ps(_mm_cmpeq_ps(Load(), _mm_setzero_ps())) == 0xF;
+	}
+
+	inline bool Vec4::IsEqual(const Vec4& other, float epsilon) const
+	{
+		__m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		__m128 difference = _mm_and_ps(_mm_sub_ps(Load(), other.Load()), absMask);
+		return _mm_movemask_ps(_mm_cmplt_ps(difference, _mm_set1_ps(epsilon))) == 0xF;
+	}
+
+	#else
+
+	inline bool Vec4::operator==(const Vec4& other) const
+	{
+		return x == other.x && y == other.y && z == other.z && w == other.w;
+	}
+
+	inline Vec4 Vec4::operator+(const Vec4& other) const
+	{
+		return Vec4(x + other.x, y + other.y, z + other.z, w + other.w);
+	}
+
+	inline Vec4 Vec4::operator-(const Vec4& other) const
+	{
+		return Vec4(x - other.x, y - other.y, z - other.z, w - other.w);
+	}
+
+	inline Vec4 Vec4::operator*(float scalar) const
+	{
+		return Vec4(x * scalar, y * scalar, z * scalar, w * scalar);
+	}
+
+	inline Vec4 Vec4::operator/(float scalar) const
+	{
+		if (scalar != 0.0f)
+		{
+			return Vec4(x / scalar, y / scalar, z / scalar, w / scalar);
+		}
+		return Vec4();
+	}
+
+	inline Vec4 Vec4::operator-() const
+	{
+		return Vec4(-x, -y, -z, -w);
+	}
+
+	inline Vec4 Vec4::operator*(const Vec4& other) const
+	{
+		return Vec4(x * other.x, y * other.y, z * other.z, w * other.w);
+	}
+
+	inline Vec4 Vec4::operator/(const Vec4& other) const
+	{
+		return Vec4((other.x != 0.0f) ? x / other.x : 0.0f, (other.y != 0.0f) ? y / other.y : 0.0f,
+			(other.z != 0.0f) ? z / other.z : 0.0f, (other.w != 0.0f) ? w / other.w : 0.0f);
+	}
+
+	inline float Vec4::Dot(const Vec4& other) const
+	{
+		return x * other.x + y * other.y + z * other.z + w * other.w;
+	}
+
+	inline Vec4 Vec4::Normalize() const
+	{
+		float len = Length();
+		if (len > 0.0f)
+		{
+			return Vec4(x / len, y / len, z / len, w / len);
+		}
+		return Vec4();
+	}
+
+	inline Vec4 Vec4::Lerp(const Vec4& other, float t) const
+	{
+		return Vec4(x + t * (other.x - x), y + t * (other.y - y), z + t * (other.z - z), w + t * (other.w - w));
+	}
+
+	inline Vec4 Vec4::Min(const Vec4& other) const
+	{
+		return Vec4(fminf(x, other.x), fminf(y, other.y), fminf(z, other.z), fminf(w, other.w));
+	}
+
+	inline Vec4 Vec4::Max(const Vec4& other) const
+	{
+		return Vec4(fmaxf(x, other.x), fmaxf(y, other.y), fmaxf(z, other.z), fmaxf(w, other.w));
+	}
+
+	inline bool Vec4::IsZero() const
+	{
+		return x == 0.0f && y == 0.0f && z == 0.0f && w == 0.0f;
+	}
+
+	inline bool Vec4::IsEqual(const Vec4& other, float epsilon) const
+	{
+		return fabsf(x - other.x) < epsilon && fabsf(y - other.y) < epsilon && fabsf(z - other.z) < epsilon && fabsf(w - other.w) < epsilon;
+	}
+
+	#endif
+
+	inline bool Vec4::operator!=(const Vec4& other) const
+	{
+		return !(*this == other);
+	}
+
+	inline Vec4& Vec4::operator+=(const Vec4& other)
+	{
+		return *this = *this + other;
+	}
+
+	inline Vec4& Vec4::operator-=(const Vec4& other)
+	{
+		return *this = *this - other;
+	}
+
+	inline Vec4& Vec4::operator*=(float scalar)
+	{
+		return *this = *this * scalar;
+	}
+
+	inline Vec4& Vec4::operator/=(float scalar)
+	{
+		return *this = *this / scalar;
+	}
+
+	inline float Vec4::Length() const
+	{
+		return sqrtf(Dot(*this));
+	}
+
+	inline float Vec4::LengthSquared() const
+	{
+		return Dot(*this);
+	}
+}
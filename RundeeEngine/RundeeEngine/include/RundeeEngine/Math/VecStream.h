@@ -0,0 +1,79 @@
+//Project Name: RundeeEngine
+//File Name: VecStream.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Structure-of-arrays Vec3 streams and batch kernels header file
+
+#pragma once
+#include "../Common/CommonType.h"
+#include <cstddef>
+#include <memory_resource>
+
+namespace RundeeEngine
+{
+	// Vec3s stored as three separate x, y and z float arrays, cache-line
+	// aligned, so batch kernels load eight components per instruction
+	// instead of shuffling packed triples. Elements are zero-initialised on
+	// growth like std::vector.
+	class Vec3Stream
+	{
+	public:
+		// nullptr uses the Math-tagged heap
+		explicit Vec3Stream(std::pmr::memory_resource* resource = nullptr);
+		explicit Vec3Stream(size_t count, std::pmr::memory_resource* resource = nullptr);
+		~Vec3Stream();
+
+		Vec3Stream(const Vec3Stream& other);
+		Vec3Stream(Vec3Stream&& other) noexcept;
+		Vec3Stream& operator=(const Vec3Stream& other);
+		Vec3Stream& operator=(Vec3Stream&& other) noexcept;
+
+		void Resize(size_t count);
+		void Reserve(size_t capacity);
+		void Clear() { m_Size = 0; }
+		void PushBack(const Vec3& value);
+
+		size_t Size() const { return m_Size; }
+		size_t Capacity() const { return m_Capacity; }
+		bool IsEmpty() const { return m_Size == 0; }
+
+		float* X() { return m_Data; }
+		float* Y() { return m_Data + m_Capacity; }
+		float* Z() { return m_Data + 2 * m_Capacity; }
+		const float* X() const { return m_Data; }
+		const float* Y() const { return m_Data + m_Capacity; }
+		const float* Z() const { return m_Data + 2 * m_Capacity; }
+
+		Vec3 Get(size_t index) const { return Vec3(X()[index], Y()[index], Z()[index]); }
+		void Set(size_t index, const Vec3& value);
+
+		// Conversion from and to packed Vec3 arrays; FromAoS resizes to count
+		void FromAoS(const Vec3* values, size_t count);
+		void ToAoS(Vec3* out) const;
+
+		// Batch kernels. Outputs are resized to the input size and may alias
+		// an input. Streams of different sizes are an error and leave out untouched.
+		static void Add(const Vec3Stream& a, const Vec3Stream& b, Vec3Stream& out);
+		static void Subtract(const Vec3Stream& a, const Vec3Stream& b, Vec3Stream& out);
+		static void Scale(const Vec3Stream& a, float scalar, Vec3Stream& out);
+		// out = a + b * scalar, e.g. position += velocity * dt
+		static void MulAdd(const Vec3Stream& a, const Vec3Stream& b, float scalar, Vec3Stream& out);
+		static void Lerp(const Vec3Stream& a, const Vec3Stream& b, float t, Vec3Stream& out);
+		// Zero-length vectors stay zero; relative error below 1e-6 (rsqrt plus one Newton step)
+		static void Normalize(const Vec3Stream& a, Vec3Stream& out);
+
+		// Scalar results go to out, which must hold a.Size() floats
+		static void Dot(const Vec3Stream& a, const Vec3Stream& b, float* out);
+		static void Length(const Vec3Stream& a, float* out);
+		static void LengthSquared(const Vec3Stream& a, float* out);
+		static void Distance(const Vec3Stream& a, const Vec3Stream& b, float* out);
+
+	private:
+		void Reallocate(size_t capacity);
+
+		float* m_Data;
+		size_t m_Size;
+		size_t m_Capacity;
+		std::pmr::memory_resource* m_Resource;
+	};
+}
@@ -0,0 +1,83 @@
+//Project Name: RundeeEngine
+//File Name: AllocationProfiler.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Sampling allocation profiler header file
+
+#pragma once
+#include "MemoryTracker.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace RundeeEngine
+{
+	// Opt-in profiler fed by the tracked allocation paths. Every Nth
+	// allocation on each thread captures a backtrace and is aggregated by
+	// call site; sampled blocks are remembered so their lifetime can be
+	// measured when they are freed. While disabled each hook is one relaxed load.
+	class AllocationProfiler
+	{
+	public:
+		static void Enable(uint32_t sampleInterval = 1024);
+		static void Disable();
+		static bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+
+		// Logs the heaviest call sites by sampled bytes; counts are scaled by the interval
+		static void Report(size_t maxSites = 16);
+		static void Reset();
+
+		static void OnAllocate(void* memory, size_t size, MemoryTag tag);
+		static void OnFree(void* memory);
+
+	private:
+		static void RecordSample(void* memory, size_t size, MemoryTag tag);
+		static void RecordFree(void* memory);
+		static uint32_t SeedCountdown();
+
+		static std::atomic<bool> s_Enabled;
+		static std::atomic<uint32_t> s_SampleInterval;
+		static std::atomic<uint32_t> s_TrackedBlocks;
+		static thread_local uint32_t t_Countdown;
+	};
+
+	inline void AllocationProfiler::OnAllocate(void* memory, size_t size, MemoryTag tag)
+	{
+		if (!s_Enabled.load(std::memory_order_relaxed) || !memory)
+		{
+			return;
+		}
+
+		if (t_Countdown > 1)
+		{
+			--t_Countdown;
+			return;
+		}
+
+		// A thread's first allocation starts it at a random phase, so
+		// start-up allocations are sampled no more often than any others
+		if (t_Countdown == 0)
+		{
+			t_Countdown = SeedCountdown();
+			if (t_Countdown > 1)
+			{
+				--t_Countdown;
+				return;
+			}
+		}
+
+		t_Countdown = s_SampleInterval.load(std::memory_order_relaxed);
+		RecordSample(memory, size, tag);
+	}
+
+	inline void AllocationProfiler::OnFree(void* memory)
+	{
+		// Frees keep being matched after Disable so in-flight samples still get a lifetime
+		if (s_TrackedBlocks.load(std::memory_order_relaxed) == 0 || !memory)
+		{
+			return;
+		}
+
+		RecordFree(memory);
+	}
+}
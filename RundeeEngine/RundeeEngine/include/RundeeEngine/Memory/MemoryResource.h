@@ -0,0 +1,66 @@
+//Project Name: RundeeEngine
+//File Name: MemoryResource.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: std::pmr adapters for the engine allocators header file
+
+#pragma once
+#include "MemoryTracker.h"
+#include <memory_resource>
+
+namespace RundeeEngine
+{
+	class PoolAllocator;
+	class TLSFAllocator;
+
+	// Forwards to an upstream resource and charges the bytes to a tag
+	class TaggedMemoryResource : public std::pmr::memory_resource
+	{
+	public:
+		explicit TaggedMemoryResource(MemoryTag tag, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+		MemoryTag GetTag() const { return m_Tag; }
+		std::pmr::memory_resource* GetUpstream() const { return m_Upstream; }
+
+	private:
+		void* do_allocate(size_t bytes, size_t alignment) override;
+		void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+		MemoryTag m_Tag;
+		std::pmr::memory_resource* m_Upstream;
+	};
+
+	// Serves requests that fit the pool block from the pool, the rest from upstream
+	class PoolMemoryResource : public std::pmr::memory_resource
+	{
+	public:
+		explicit PoolMemoryResource(PoolAllocator& pool, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+	private:
+		void* do_allocate(size_t bytes, size_t alignment) override;
+		void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+		bool Fits(size_t bytes, size_t alignment) const;
+
+		PoolAllocator* m_Pool;
+		std::pmr::memory_resource* m_Upstream;
+	};
+
+	class TLSFMemoryResource : public std::pmr::memory_resource
+	{
+	public:
+		explicit TLSFMemoryResource(TLSFAllocator& heap);
+
+	private:
+		void* do_allocate(size_t bytes, size_t alignment) override;
+		void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+		TLSFAllocator* m_Heap;
+	};
+
+	// Process-wide heap resource charged to the given tag
+	std::pmr::memory_resource* GetTaggedResource(MemoryTag tag);
+}
@@ -0,0 +1,157 @@
+//Project Name: RundeeEngine
+//File Name: MemoryTracker.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Per-subsystem memory tracking header file
+
+#pragma once
+#include "MemoryUtils.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+// Set to 0 to compile the counters out entirely
+#ifndef RUNDEE_MEMORY_TRACKING
+#define RUNDEE_MEMORY_TRACKING 1
+#endif
+
+namespace RundeeEngine
+{
+	enum class MemoryTag
+	{
+		General = 0,
+		Renderer,
+		Jobs,
+		Logging,
+		Math,
+		Game,
+		Count
+	};
+
+	struct MemoryTagStats
+	{
+		size_t LiveBytes = 0;
+		size_t PeakBytes = 0;
+		size_t Budget = 0;
+		uint64_t TotalAllocations = 0;
+		uint64_t TotalBytes = 0;
+		double AllocationsPerSecond = 0.0;
+		double BytesPerSecond = 0.0;
+	};
+
+	class MemoryTracker
+	{
+	public:
+		static void* Allocate(size_t size, MemoryTag tag, size_t alignment = alignof(std::max_align_t));
+		static void Free(void* memory, size_t size, MemoryTag tag);
+
+		// For allocators that obtain memory elsewhere but still report it
+		static void RecordAllocation(MemoryTag tag, size_t size);
+		static void RecordFree(MemoryTag tag, size_t size);
+
+		// A budget of 0 disables the warning for that tag
+		static void SetBudget(MemoryTag tag, size_t bytes);
+		static MemoryTagStats GetStats(MemoryTag tag);
+		static const char* GetTagName(MemoryTag tag);
+
+		// Samples allocation rates since the previous call; call once per frame
+		static void Update();
+		static void Report();
+
+	private:
+		struct alignas(CacheLineSize) TagCounters
+		{
+			std::atomic<int64_t> LiveBytes;
+			std::atomic<int64_t> PeakBytes;
+			std::atomic<int64_t> Budget;
+			std::atomic<uint64_t> TotalAllocations;
+			std::atomic<uint64_t> TotalBytes;
+			std::atomic<bool> OverBudget;
+		};
+
+		static void OnBudgetExceeded(MemoryTag tag, int64_t liveBytes);
+
+		static TagCounters s_Counters[static_cast<size_t>(MemoryTag::Count)];
+	};
+
+	inline void MemoryTracker::RecordAllocation(MemoryTag tag, size_t size)
+	{
+		#if RUNDEE_MEMORY_TRACKING
+		TagCounters& counters = s_Counters[static_cast<size_t>(tag)];
+		int64_t live = counters.LiveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+		counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+		counters.TotalBytes.fetch_add(size, std::memory_order_relaxed);
+
+		int64_t peak = counters.PeakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+		{
+		}
+
+		int64_t budget = counters.Budget.load(std::memory_order_relaxed);
+		if (budget > 0 && live > budget && !counters.OverBudget.load(std::memory_order_relaxed))
+		{
+			OnBudgetExceeded(tag, live);
+		}
+		#else
+		(void)tag;
+		(void)size;
+		#endif
+	}
+
+	inline void MemoryTracker::RecordFree(MemoryTag tag, size_t size)
+	{
+		#if RUNDEE_MEMORY_TRACKING
+		TagCounters& counters = s_Counters[static_cast<size_t>(tag)];
+		int64_t live = counters.LiveBytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed) - static_cast<int64_t>(size);
+
+		if (counters.OverBudget.load(std::memory_order_relaxed) && live <= counters.Budget.load(std::memory_order_relaxed))
+		{
+			counters.OverBudget.store(false, std::memory_order_relaxed);
+		}
+		#else
+		(void)tag;
+		(void)size;
+		#endif
+	}
+
+	// Standard allocator that charges every allocation to a fixed tag
+	template<typename T, MemoryTag Tag>
+	class TaggedAllocator
+	{
+	public:
+		using value_type = T;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = TaggedAllocator<U, Tag>;
+		};
+
+		TaggedAllocator() noexcept = default;
+
+		template<typename U>
+		TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept {}
+
+		T* allocate(size_t count)
+		{
+			void* memory = MemoryTracker::Allocate(count * sizeof(T), Tag, alignof(T));
+			if (!memory)
+			{
+				throw std::bad_alloc();
+			}
+			return static_cast<T*>(memory);
+		}
+
+		void deallocate(T* pointer, size_t count) noexcept
+		{
+			MemoryTracker::Free(pointer, count * sizeof(T), Tag);
+		}
+
+		template<typename U>
+		bool operator==(const TaggedAllocator<U, Tag>&) const noexcept { return true; }
+
+		template<typename U>
+		bool operator!=(const TaggedAllocator<U, Tag>&) const noexcept { return false; }
+	};
+}
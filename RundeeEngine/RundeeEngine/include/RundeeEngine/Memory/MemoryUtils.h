@@ -0,0 +1,63 @@
+//Project Name: RundeeEngine
+//File Name: MemoryUtils.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Alignment helpers shared by the engine allocators
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace RundeeEngine
+{
+	constexpr size_t CacheLineSize = 64;
+
+	constexpr bool IsPowerOfTwo(size_t value)
+	{
+		return value != 0 && (value & (value - 1)) == 0;
+	}
+
+	constexpr size_t AlignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	inline void* AlignUp(void* pointer, size_t alignment)
+	{
+		return reinterpret_cast<void*>(AlignUp(reinterpret_cast<uintptr_t>(pointer), alignment));
+	}
+
+	// alignment must be a power of two; size is rounded up to a multiple of it
+	inline void* AlignedAlloc(size_t size, size_t alignment)
+	{
+		if (alignment < sizeof(void*))
+		{
+			alignment = sizeof(void*);
+		}
+
+		#ifdef _WIN32
+		return _aligned_malloc(AlignUp(size, alignment), alignment);
+		#else
+		void* memory = nullptr;
+		if (posix_memalign(&memory, alignment, AlignUp(size, alignment)) != 0)
+		{
+			return nullptr;
+		}
+		return memory;
+		#endif
+	}
+
+	inline void AlignedFree(void* memory)
+	{
+		#ifdef _WIN32
+		_aligned_free(memory);
+		#else
+		free(memory);
+		#endif
+	}
+}
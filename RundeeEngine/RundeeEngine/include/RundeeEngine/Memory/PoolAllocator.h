@@ -0,0 +1,247 @@
+//Project Name: RundeeEngine
+//File Name: PoolAllocator.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Fixed-size block pool allocator header file
+
+#pragma once
+#include "MemoryTracker.h"
+#include "MemoryUtils.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace RundeeEngine
+{
+	// Hands out fixed-size blocks carved from cache-line aligned slabs.
+	// Each thread keeps a small private free list, so Allocate/Free only take
+	// the pool mutex when that list runs dry or overflows.
+	// Slabs come from the tagged heap unless an upstream resource is given,
+	// in which case the upstream does its own accounting.
+	class PoolAllocator
+	{
+	public:
+		PoolAllocator(size_t blockSize, size_t blockAlignment = alignof(std::max_align_t), size_t blocksPerSlab = 256,
+			MemoryTag tag = MemoryTag::General, std::pmr::memory_resource* upstream = nullptr);
+		~PoolAllocator();
+
+		PoolAllocator(const PoolAllocator&) = delete;
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+		void* Allocate();
+		void Free(void* block);
+
+		size_t GetBlockSize() const { return m_BlockSize; }
+		size_t GetBlockAlignment() const { return m_BlockAlignment; }
+		size_t GetSlabCount() const;
+		size_t GetCapacity() const;
+		MemoryTag GetTag() const { return m_Tag; }
+
+	private:
+		friend struct ThreadCacheReleaser;
+
+		struct FreeBlock
+		{
+			FreeBlock* Next;
+		};
+
+		struct alignas(CacheLineSize) ThreadCache
+		{
+			FreeBlock* Head = nullptr;
+			uint32_t Count = 0;
+			bool Attached = false;
+			ThreadCache* NextCache = nullptr;
+		};
+
+		struct ThreadCacheSlot
+		{
+			uint64_t Serial;
+			ThreadCache* Cache;
+		};
+
+		static constexpr uint32_t ThreadCacheSetBits = 3;
+		static constexpr uint32_t ThreadCacheSets = 1u << ThreadCacheSetBits;
+		static constexpr uint32_t ThreadCacheWays = 2;
+
+		// Kept trivially destructible so the fast path needs no TLS guard;
+		// slots are flushed on thread exit by a releaser in the .cpp.
+		// Two-way sets, most recently used first, so two pools sharing a
+		// set can alternate without evicting each other.
+		struct ThreadCacheTable
+		{
+			ThreadCacheSlot Slots[ThreadCacheSets][ThreadCacheWays];
+		};
+
+		static constexpr uint32_t ThreadCacheCapacity = 64;
+		static constexpr uint32_t ThreadCacheBatch = ThreadCacheCapacity / 2;
+
+		ThreadCache* GetThreadCache();
+		ThreadCache* FindThreadCache(ThreadCacheSlot* set);
+		void DetachThreadCache(ThreadCache* cache);
+		void Refill(ThreadCache& cache);
+		void Drain(ThreadCache& cache, uint32_t keep);
+		bool AllocateSlab();
+		void* AllocateBacking(size_t size, size_t alignment);
+		void FreeBacking(void* memory, size_t size, size_t alignment);
+
+		static void ReleaseSlot(ThreadCacheSlot& slot);
+		static void ReleaseThreadCaches();
+
+		static thread_local ThreadCacheTable t_CacheTable;
+
+		size_t m_BlockSize;
+		size_t m_BlockAlignment;
+		size_t m_BlockStride;
+		size_t m_BlocksPerSlab;
+		MemoryTag m_Tag;
+		std::pmr::memory_resource* m_Upstream;
+		uint64_t m_Serial;
+		uint32_t m_CacheSet;
+
+		mutable std::mutex m_Mutex;
+		FreeBlock* m_FreeList;
+		ThreadCache* m_Caches;
+		std::vector<void*> m_Slabs;
+	};
+
+	inline PoolAllocator::ThreadCache* PoolAllocator::GetThreadCache()
+	{
+		ThreadCacheSlot* set = t_CacheTable.Slots[m_CacheSet];
+		if (set[0].Serial == m_Serial)
+		{
+			return set[0].Cache;
+		}
+		return FindThreadCache(set);
+	}
+
+	inline void* PoolAllocator::Allocate()
+	{
+		ThreadCache* cache = GetThreadCache();
+		if (!cache->Head)
+		{
+			Refill(*cache);
+			if (!cache->Head)
+			{
+				return nullptr;
+			}
+		}
+
+		FreeBlock* block = cache->Head;
+		cache->Head = block->Next;
+		--cache->Count;
+		return block;
+	}
+
+	inline void PoolAllocator::Free(void* block)
+	{
+		if (!block)
+		{
+			return;
+		}
+
+		ThreadCache* cache = GetThreadCache();
+		FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+		freeBlock->Next = cache->Head;
+		cache->Head = freeBlock;
+		if (++cache->Count > ThreadCacheCapacity)
+		{
+			Drain(*cache, ThreadCacheBatch);
+		}
+	}
+
+	// Typed front end: constructs and destroys T in pool blocks
+	template<typename T>
+	class ObjectPool
+	{
+	public:
+		explicit ObjectPool(size_t objectsPerSlab = 256, MemoryTag tag = MemoryTag::General, std::pmr::memory_resource* upstream = nullptr)
+			: m_Allocator(sizeof(T), alignof(T), objectsPerSlab, tag, upstream)
+		{
+		}
+
+		template<typename... Args>
+		T* Create(Args&&... args)
+		{
+			void* memory = m_Allocator.Allocate();
+			if (!memory)
+			{
+				return nullptr;
+			}
+			return new (memory) T(std::forward<Args>(args)...);
+		}
+
+		void Destroy(T* object)
+		{
+			if (!object)
+			{
+				return;
+			}
+			object->~T();
+			m_Allocator.Free(object);
+		}
+
+		PoolAllocator& GetAllocator() { return m_Allocator; }
+
+	private:
+		PoolAllocator m_Allocator;
+	};
+
+	// Standard allocator over a PoolAllocator for node-based containers.
+	// Single-object requests that fit the pool block come from the pool,
+	// anything else (arrays, rebinds to larger types) goes to the heap.
+	template<typename T>
+	class PoolStdAllocator
+	{
+	public:
+		using value_type = T;
+
+		explicit PoolStdAllocator(PoolAllocator& pool) noexcept : m_Pool(&pool) {}
+
+		template<typename U>
+		PoolStdAllocator(const PoolStdAllocator<U>& other) noexcept : m_Pool(other.GetPool()) {}
+
+		T* allocate(size_t count)
+		{
+			if (UsesPool(count))
+			{
+				void* block = m_Pool->Allocate();
+				if (!block)
+				{
+					throw std::bad_alloc();
+				}
+				return static_cast<T*>(block);
+			}
+			return static_cast<T*>(::operator new(count * sizeof(T)));
+		}
+
+		void deallocate(T* pointer, size_t count) noexcept
+		{
+			if (UsesPool(count))
+			{
+				m_Pool->Free(pointer);
+				return;
+			}
+			::operator delete(pointer);
+		}
+
+		PoolAllocator* GetPool() const noexcept { return m_Pool; }
+
+		template<typename U>
+		bool operator==(const PoolStdAllocator<U>& other) const noexcept { return m_Pool == other.GetPool(); }
+
+		template<typename U>
+		bool operator!=(const PoolStdAllocator<U>& other) const noexcept { return m_Pool != other.GetPool(); }
+
+	private:
+		bool UsesPool(size_t count) const noexcept
+		{
+			return count == 1 && sizeof(T) <= m_Pool->GetBlockSize() && alignof(T) <= m_Pool->GetBlockAlignment();
+		}
+
+		PoolAllocator* m_Pool;
+	};
+}
@@ -0,0 +1,147 @@
+//Project Name: RundeeEngine
+//File Name: StackAllocator.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Double-ended stack allocator with markers header file
+
+#pragma once
+#include "MemoryTracker.h"
+#include "VirtualMemory.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+// Guard bytes after every allocation, checked when the stack is rolled back.
+// On by default in debug builds (MSVC defines _DEBUG, other compilers lack NDEBUG).
+#ifndef RUNDEE_STACK_GUARDS
+#if defined(_DEBUG) || (!defined(_MSC_VER) && !defined(NDEBUG))
+#define RUNDEE_STACK_GUARDS 1
+#else
+#define RUNDEE_STACK_GUARDS 0
+#endif
+#endif
+
+namespace RundeeEngine
+{
+	enum class StackSide
+	{
+		Bottom,
+		Top
+	};
+
+	struct StackMarker
+	{
+		size_t Offset;
+		StackSide Side;
+	};
+
+	// One region with a stack growing up from the bottom and another growing
+	// down from the top, e.g. level data on one end and load temporaries on
+	// the other. Memory is only returned by rolling a side back to a marker,
+	// which is O(1) in release builds. Destructors are never run on rollback.
+	// Not thread safe; give each loader thread its own allocator.
+	// With useHugePages the capacity is rounded up to whole huge pages and
+	// committed up front, which pays off for arenas of hundreds of megabytes.
+	class StackAllocator
+	{
+	public:
+		explicit StackAllocator(size_t capacity, MemoryTag tag = MemoryTag::General, bool useHugePages = false);
+		~StackAllocator();
+
+		StackAllocator(const StackAllocator&) = delete;
+		StackAllocator& operator=(const StackAllocator&) = delete;
+
+		// Returns nullptr when the two ends would cross
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t), StackSide side = StackSide::Bottom);
+
+		template<typename T, typename... Args>
+		T* New(StackSide side, Args&&... args)
+		{
+			void* memory = Allocate(sizeof(T), alignof(T), side);
+			return memory ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+		}
+
+		template<typename T>
+		T* NewArray(size_t count, StackSide side = StackSide::Bottom)
+		{
+			void* memory = Allocate(sizeof(T) * count, alignof(T), side);
+			if (!memory)
+			{
+				return nullptr;
+			}
+
+			T* elements = static_cast<T*>(memory);
+			for (size_t i = 0; i < count; ++i)
+			{
+				new (elements + i) T();
+			}
+			return elements;
+		}
+
+		StackMarker GetMarker(StackSide side = StackSide::Bottom) const;
+		void FreeToMarker(const StackMarker& marker);
+		void Clear(StackSide side);
+		void Clear();
+
+		size_t GetCapacity() const { return m_Capacity; }
+		size_t GetUsedBytes(StackSide side) const { return side == StackSide::Bottom ? m_BottomOffset : m_Capacity - m_TopOffset; }
+		size_t GetFreeBytes() const { return m_TopOffset - m_BottomOffset; }
+		size_t GetPeakBytes() const { return m_PeakBytes; }
+		PageBacking GetPageBacking() const { return m_PageBacking; }
+
+	private:
+		#if RUNDEE_STACK_GUARDS
+		// Precedes every allocation so a rollback can walk back and check guards
+		struct GuardHeader
+		{
+			size_t PreviousHeader;
+			size_t Size;
+		};
+
+		static constexpr size_t GuardSize = 16;
+		static constexpr uint8_t GuardPattern = 0xFD;
+		static constexpr uint8_t FreedPattern = 0xDD;
+		static constexpr size_t NoHeader = ~size_t(0);
+
+		void CheckGuards(StackSide side, size_t offset);
+		#endif
+
+		char* m_Memory;
+		size_t m_Capacity;
+		MemoryTag m_Tag;
+		size_t m_BottomOffset;
+		size_t m_TopOffset;
+		size_t m_PeakBytes;
+		bool m_UsesHugePages;
+		PageBacking m_PageBacking;
+
+		#if RUNDEE_STACK_GUARDS
+		size_t m_LastBottomHeader;
+		size_t m_LastTopHeader;
+		#endif
+	};
+
+	// Rolls its side of the stack back when the scope ends
+	class ScopedStackMarker
+	{
+	public:
+		explicit ScopedStackMarker(StackAllocator& allocator, StackSide side = StackSide::Bottom)
+			: m_Allocator(&allocator)
+			, m_Marker(allocator.GetMarker(side))
+		{
+		}
+
+		~ScopedStackMarker()
+		{
+			m_Allocator->FreeToMarker(m_Marker);
+		}
+
+		ScopedStackMarker(const ScopedStackMarker&) = delete;
+		ScopedStackMarker& operator=(const ScopedStackMarker&) = delete;
+
+	private:
+		StackAllocator* m_Allocator;
+		StackMarker m_Marker;
+	};
+}
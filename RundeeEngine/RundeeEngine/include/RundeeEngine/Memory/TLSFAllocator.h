@@ -0,0 +1,139 @@
+//Project Name: RundeeEngine
+//File Name: TLSFAllocator.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Two-level segregated fit allocator header file
+
+#pragma once
+#include "MemoryTracker.h"
+#include "VirtualMemory.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace RundeeEngine
+{
+	struct TLSFStats
+	{
+		size_t Capacity = 0;
+		size_t UsedBytes = 0;
+		size_t FreeBytes = 0;
+		size_t LargestFreeBlock = 0;
+		size_t UsedBlockCount = 0;
+		size_t FreeBlockCount = 0;
+
+		// 0 when all free memory is one block, approaching 1 as it splinters
+		float Fragmentation = 0.0f;
+	};
+
+	// O(1) variable-size allocator over one region reserved up front.
+	// Free blocks are binned by a first level (power of two) and a second
+	// level (linear subdivision), and neighbours are coalesced on free.
+	// useHugePages rounds the region up to whole huge pages to cut TLB misses.
+	// Capacities above MaxCapacity (1 TiB) are rejected.
+	class TLSFAllocator
+	{
+	public:
+		explicit TLSFAllocator(size_t capacity, MemoryTag tag = MemoryTag::General, bool useHugePages = false);
+		~TLSFAllocator();
+
+		TLSFAllocator(const TLSFAllocator&) = delete;
+		TLSFAllocator& operator=(const TLSFAllocator&) = delete;
+
+		void* Allocate(size_t size, size_t alignment = MinAlignment);
+		void Free(void* memory);
+
+		size_t GetAllocationSize(const void* memory) const;
+		size_t GetCapacity() const { return m_Capacity; }
+		bool Owns(const void* memory) const;
+		PageBacking GetPageBacking() const { return m_PageBacking; }
+
+		// Walks every block; meant for diagnostics, not per-frame use
+		TLSFStats GetStats() const;
+
+		static constexpr size_t MinAlignment = 16;
+		static constexpr uint64_t MaxCapacity = uint64_t(1) << 40;
+
+	private:
+		struct BlockHeader
+		{
+			BlockHeader* PrevPhysical;
+			size_t Size;
+			BlockHeader* NextFree;
+			BlockHeader* PrevFree;
+		};
+
+		static constexpr size_t AlignLog2 = 4;
+		static constexpr size_t SecondLevelLog2 = 4;
+		static constexpr size_t SecondLevelCount = size_t(1) << SecondLevelLog2;
+		static constexpr size_t FirstLevelShift = SecondLevelLog2 + AlignLog2;
+		// Free blocks are always smaller than the region, so the bins reach MaxCapacity
+		static constexpr size_t FirstLevelMax = 40;
+		static constexpr size_t FirstLevelCount = FirstLevelMax - FirstLevelShift + 1;
+		static constexpr size_t SmallBlockSize = size_t(1) << FirstLevelShift;
+		static_assert(MaxCapacity == uint64_t(1) << FirstLevelMax, "first-level bins must cover MaxCapacity");
+
+		static void MappingInsert(size_t size, size_t& firstLevel, size_t& secondLevel);
+		static void MappingSearch(size_t size, size_t& firstLevel, size_t& secondLevel);
+
+		BlockHeader* FindFreeBlock(size_t& firstLevel, size_t& secondLevel) const;
+		void InsertFreeBlock(BlockHeader* block);
+		void RemoveFreeBlock(BlockHeader* block);
+		BlockHeader* SplitBlock(BlockHeader* block, size_t size);
+		BlockHeader* MergeWithPrevious(BlockHeader* block);
+		BlockHeader* MergeWithNext(BlockHeader* block);
+
+		void* m_Memory;
+		size_t m_Capacity;
+		MemoryTag m_Tag;
+		size_t m_UsedBytes;
+		bool m_UsesHugePages;
+		PageBacking m_PageBacking;
+
+		mutable std::mutex m_Mutex;
+		uint64_t m_FirstLevelBitmap;
+		uint32_t m_SecondLevelBitmaps[FirstLevelCount];
+		BlockHeader* m_FreeLists[FirstLevelCount][SecondLevelCount];
+	};
+
+	// Standard allocator so engine containers can live in a TLSF heap
+	template<typename T>
+	class TLSFStdAllocator
+	{
+	public:
+		using value_type = T;
+
+		explicit TLSFStdAllocator(TLSFAllocator& heap) noexcept : m_Heap(&heap) {}
+
+		template<typename U>
+		TLSFStdAllocator(const TLSFStdAllocator<U>& other) noexcept : m_Heap(other.GetHeap()) {}
+
+		T* allocate(size_t count)
+		{
+			size_t alignment = alignof(T) > TLSFAllocator::MinAlignment ? alignof(T) : TLSFAllocator::MinAlignment;
+			void* memory = m_Heap->Allocate(count * sizeof(T), alignment);
+			if (!memory)
+			{
+				throw std::bad_alloc();
+			}
+			return static_cast<T*>(memory);
+		}
+
+		void deallocate(T* pointer, size_t) noexcept
+		{
+			m_Heap->Free(pointer);
+		}
+
+		TLSFAllocator* GetHeap() const noexcept { return m_Heap; }
+
+		template<typename U>
+		bool operator==(const TLSFStdAllocator<U>& other) const noexcept { return m_Heap == other.GetHeap(); }
+
+		template<typename U>
+		bool operator!=(const TLSFStdAllocator<U>& other) const noexcept { return m_Heap != other.GetHeap(); }
+
+	private:
+		TLSFAllocator* m_Heap;
+	};
+}
@@ -0,0 +1,44 @@
+//Project Name: RundeeEngine
+//File Name: VirtualMemory.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Virtual address space reservation header file
+
+#pragma once
+#include <cstddef>
+
+namespace RundeeEngine
+{
+	// What actually backs a range handed out by AllocateHugePages
+	enum class PageBacking
+	{
+		Standard,
+		TransparentHuge,
+		Huge
+	};
+
+	// Thin wrapper over VirtualAlloc / mmap. Reserved ranges have no backing
+	// until committed; addresses and sizes passed to Commit/Decommit must be
+	// page aligned.
+	class VirtualMemory
+	{
+	public:
+		static size_t GetPageSize();
+
+		static void* Reserve(size_t size);
+		static bool Commit(void* address, size_t size);
+		static void Decommit(void* address, size_t size);
+		static void Release(void* address, size_t size);
+
+		// Huge page size of the system (2MB on x64 unless configured otherwise)
+		static size_t GetHugePageSize();
+
+		// Reserves and commits a whole range for a long-lived arena. Tries
+		// explicit huge pages (MAP_HUGETLB / MEM_LARGE_PAGES) first, then a
+		// huge page aligned mapping with MADV_HUGEPAGE, then standard pages;
+		// backing reports which one was obtained. size must be a multiple of
+		// GetHugePageSize() and the range is freed with Release.
+		static void* AllocateHugePages(size_t size, PageBacking& backing);
+		static const char* GetPageBackingName(PageBacking backing);
+	};
+}
@@ -0,0 +1,176 @@
+//Project Name: RundeeEngine
+//File Name: Camera.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: 2D and 3D cameras with cached view and projection matrices header file
+
+#pragma once
+#include "../Math/Bounds.h"
+#include "../Math/Mat4.h"
+#include "../Math/Quat.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace RundeeEngine
+{
+	// Pixel rectangle a camera draws into. Screen coordinates run right and
+	// down from the window's top-left corner, like mouse positions.
+	struct Viewport
+	{
+		float X = 0.0f;
+		float Y = 0.0f;
+		float Width = 1.0f;
+		float Height = 1.0f;
+
+		Viewport() = default;
+		Viewport(float x, float y, float width, float height) : X(x), Y(y), Width(width), Height(height) {}
+
+		float GetAspect() const { return Height > 0.0f ? Width / Height : 1.0f; }
+	};
+
+	// Matrices are rebuilt on the first query after a setter, and only the
+	// parts that changed: moving the camera leaves the projection alone.
+	// Queries refresh the cache, so a camera shared with jobs should be
+	// queried once (GetViewProjection) after its last change, before the jobs start.
+
+	// Orthographic camera looking down -z at the xy plane, y up. Position
+	// is the world point at the viewport's centre; Zoom is pixels per world unit.
+	class Camera2D
+	{
+	public:
+		Camera2D();
+		explicit Camera2D(const Viewport& viewport);
+
+		void SetPosition(const Vec2& position);
+		void SetRotation(float radians);
+		void SetZoom(float zoom);
+		void SetViewport(const Viewport& viewport);
+
+		const Vec2& GetPosition() const { return m_Position; }
+		float GetRotation() const { return m_Rotation; }
+		float GetZoom() const { return m_Zoom; }
+		const Viewport& GetViewport() const { return m_Viewport; }
+
+		const Mat4& GetView() const;
+		const Mat4& GetProjection() const;
+		const Mat4& GetViewProjection() const;
+		// World rectangle containing everything visible, rotation included; the view for Culling::Cull
+		const AABB2& GetVisibleBounds() const;
+
+		Vec2 WorldToScreen(const Vec2& world) const;
+		Vec2 ScreenToWorld(const Vec2& screen) const;
+		// out may alias the input
+		void WorldToScreen(const Vec2* world, Vec2* outScreen, size_t count) const;
+		void ScreenToWorld(const Vec2* screen, Vec2* outWorld, size_t count) const;
+
+	private:
+		// x' = m[0] * x + m[1] * y + m[2], y' = m[3] * x + m[4] * y + m[5]
+		struct Affine2D
+		{
+			float M[6];
+
+			Vec2 Apply(const Vec2& point) const { return Vec2(M[0] * point.x + M[1] * point.y + M[2], M[3] * point.x + M[4] * point.y + M[5]); }
+		};
+
+		void Update() const;
+		static void Apply(const Affine2D& affine, const Vec2* points, Vec2* out, size_t count);
+
+		Vec2 m_Position;
+		float m_Rotation;
+		float m_Zoom;
+		Viewport m_Viewport;
+
+		mutable bool m_Dirty;
+		mutable Mat4 m_View;
+		mutable Mat4 m_Projection;
+		mutable Mat4 m_ViewProjection;
+		mutable Affine2D m_WorldToScreen;
+		mutable Affine2D m_ScreenToWorld;
+		mutable AABB2 m_VisibleBounds;
+	};
+
+	enum class ProjectionType
+	{
+		Perspective,
+		Orthographic
+	};
+
+	// Right-handed, looking down its local -z with +y up, matching Mat4::LookAt.
+	// Depth on screen is 0 at the near plane and 1 at the far plane.
+	class Camera3D
+	{
+	public:
+		Camera3D();
+		explicit Camera3D(const Viewport& viewport);
+
+		void SetPosition(const Vec3& position);
+		void SetRotation(const Quat& rotation);
+		// Turns towards target; fails with an error when up is parallel to the view direction
+		void LookAt(const Vec3& target, const Vec3& up = Vec3::UnitY());
+		void SetPerspective(float fovY, float nearPlane, float farPlane);
+		// height: world units covered vertically
+		void SetOrthographic(float height, float nearPlane, float farPlane);
+		void SetViewport(const Viewport& viewport);
+
+		const Vec3& GetPosition() const { return m_Position; }
+		const Quat& GetRotation() const { return m_Rotation; }
+		ProjectionType GetProjectionType() const { return m_ProjectionType; }
+		float GetFovY() const { return m_FovY; }
+		float GetOrthographicHeight() const { return m_OrthographicHeight; }
+		float GetNearPlane() const { return m_NearPlane; }
+		float GetFarPlane() const { return m_FarPlane; }
+		const Viewport& GetViewport() const { return m_Viewport; }
+
+		Vec3 GetForward() const { return m_Rotation.Rotate(Vec3(0.0f, 0.0f, -1.0f)); }
+		Vec3 GetRight() const { return m_Rotation.Rotate(Vec3::UnitX()); }
+		Vec3 GetUp() const { return m_Rotation.Rotate(Vec3::UnitY()); }
+
+		const Mat4& GetView() const;
+		const Mat4& GetProjection() const;
+		const Mat4& GetViewProjection() const;
+		const Mat4& GetInverseViewProjection() const;
+		const Frustum& GetFrustum() const;
+
+		// Screen x, y in pixels and depth in z. Points at or behind the
+		// camera plane come out as (0, 0, -1).
+		Vec3 WorldToScreen(const Vec3& world) const;
+		// screen.z is the depth to unproject at
+		Vec3 ScreenToWorld(const Vec3& screen) const;
+		// From the near plane through the pixel, unit direction
+		Ray ScreenPointToRay(const Vec2& screen) const;
+		// out may alias the input
+		void WorldToScreen(const Vec3* world, Vec3* outScreen, size_t count) const;
+		void ScreenToWorld(const Vec3* screen, Vec3* outWorld, size_t count) const;
+
+	private:
+		static constexpr uint8_t DirtyView = 1;
+		static constexpr uint8_t DirtyProjection = 2;
+		// Everything derived from the two: view-projection and screen matrices
+		static constexpr uint8_t DirtyCombined = 4;
+		static constexpr uint8_t DirtyInverse = 8;
+		static constexpr uint8_t DirtyFrustum = 16;
+		static constexpr uint8_t DirtyAll = 31;
+
+		void Update() const;
+		void UpdateInverse() const;
+
+		Vec3 m_Position;
+		Quat m_Rotation;
+		ProjectionType m_ProjectionType;
+		float m_FovY;
+		float m_OrthographicHeight;
+		float m_NearPlane;
+		float m_FarPlane;
+		Viewport m_Viewport;
+
+		mutable uint8_t m_Dirty;
+		mutable Mat4 m_View;
+		mutable Mat4 m_Projection;
+		mutable Mat4 m_ViewProjection;
+		mutable Mat4 m_InverseViewProjection;
+		// View-projection followed by the viewport mapping, and its inverse
+		mutable Mat4 m_WorldToScreen;
+		mutable Mat4 m_ScreenToWorld;
+		mutable Frustum m_Frustum;
+	};
+}
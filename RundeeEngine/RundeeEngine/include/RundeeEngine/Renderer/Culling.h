@@ -0,0 +1,30 @@
+//Project Name: RundeeEngine
+//File Name: Culling.h
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Batched visibility culling header file
+
+#pragma once
+#include "../Math/Bounds.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace RundeeEngine
+{
+	// Tests structure-of-arrays bounds in SIMD blocks spread over the JobSystem.
+	// Each call writes the indices of visible objects, ascending, to the front
+	// of outVisible and returns how many there are. outVisible must hold one
+	// entry per object; the tail past the returned count is scratch.
+	class Culling
+	{
+	public:
+		static size_t Cull(const Frustum& frustum, const SphereArrays& spheres, uint32_t* outVisible);
+		static size_t Cull(const Frustum& frustum, const AABB3Arrays& boxes, uint32_t* outVisible);
+		// 2D: rects overlapping the view rectangle
+		static size_t Cull(const AABB2& view, const AABB2Arrays& rects, uint32_t* outVisible);
+
+	private:
+		template<typename BlockTest>
+		static size_t CullBlocks(size_t count, uint32_t* outVisible, const BlockTest& test);
+	};
+}
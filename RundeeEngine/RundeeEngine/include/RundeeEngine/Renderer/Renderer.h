@@ -5,10 +5,14 @@
 //Description: Renderer class header file
 
 #pragma once
+#include <cstddef>
+#include <cstdint>
 
 namespace RundeeEngine {
     struct Vec2;
     struct Vec3;
+    class Camera2D;
+    class Camera3D;
 
     class Renderer {
     public:
@@ -21,8 +25,16 @@ namespace RundeeEngine {
 		static void DrawRect(Vec2 position, float width, float height, float r, float g, float b, float a);
 		static void DrawLine(Vec2 start, Vec2 end, float r, float g, float b, float a);
 		static void DrawCircle(Vec2 center, float radius, int segments, float r, float g, float b, float a);
+		// Filled simple polygon, either winding, triangulated on every call
+		// into buffers the renderer keeps between calls
+		static void DrawPolygon(const Vec2* points, size_t count, float r, float g, float b, float a);
+		// Already triangulated, e.g. by Geometry2D::Triangulate once for a static shape
+		static void DrawPolygon(const Vec2* points, const uint32_t* indices, size_t indexCount, float r, float g, float b, float a);
 		static void DrawText(const char* text, Vec2 position, float size, float r, float g, float b, float a);
 		static void SetViewport(int x, int y, int width, int height);
+		// Sets the viewport and makes the Draw functions take world coordinates
+		static void SetCamera(const Camera2D& camera);
+		static void SetCamera(const Camera3D& camera);
 		static void SetClearColor(float r, float g, float b, float a);
     };
 }
\ No newline at end of file
@@ -5,9 +5,10 @@
 //Description: ThreadPool class header file
 
 #pragma once
+#include "Memory/PoolAllocator.h"
+#include <memory_resource>
 #include <vector>
 #include <thread>
-#include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <functional>
@@ -18,16 +19,32 @@ namespace RundeeEngine
     class ThreadPool 
     {
     public:
-        ThreadPool(size_t numThreads);
+        // Worker bookkeeping and job nodes come from resource; nullptr uses the Jobs-tagged heap
+        ThreadPool(size_t numThreads, std::pmr::memory_resource* resource = nullptr);
         ~ThreadPool();
 
         void Enqueue(const std::function<void()>& job);
+        // Runs one queued job on the calling thread; false when the queue is empty
+        bool RunPendingJob();
+
+        size_t GetThreadCount() const { return m_Threads.size(); }
 
     private:
+        struct Job
+        {
+            std::function<void()> Function;
+            Job* Next = nullptr;
+        };
+
         void WorkerThread();
+        // Caller holds m_QueueMutex and the queue is not empty
+        Job* PopJob();
+        void RunJob(Job* node);
 
-        std::vector<std::thread> m_Threads;
-        std::queue<std::function<void()>> m_Jobs;
+        std::pmr::vector<std::thread> m_Threads;
+        ObjectPool<Job> m_JobPool;
+        Job* m_JobHead;
+        Job* m_JobTail;
         std::mutex m_QueueMutex;
         std::condition_variable m_Condition;
         std::atomic<bool> m_ShouldStop;
@@ -0,0 +1,225 @@
+//Project Name: RundeeEngine
+//File Name: CPUFeatures.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Runtime CPU instruction set detection implementation file
+
+#include "../../include/RundeeEngine/Common/CPUFeatures.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define RUNDEE_CPU_X86 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#else
+#define RUNDEE_CPU_X86 0
+#endif
+
+namespace RundeeEngine
+{
+	#if RUNDEE_CPU_X86
+	// XCR0 state components the OS must save: SSE and AVX registers, then
+	// the AVX-512 mask and upper register halves
+	static constexpr uint64_t XSaveAVX = 0x6;
+	static constexpr uint64_t XSaveAVX512 = 0xE6;
+
+	static void CpuId(uint32_t leaf, uint32_t subleaf, uint32_t (&registers)[4])
+	{
+		#ifdef _MSC_VER
+		int values[4];
+		__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+		for (int i = 0; i < 4; ++i)
+		{
+			registers[i] = static_cast<uint32_t>(values[i]);
+		}
+		#else
+		__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+		#endif
+	}
+
+	static uint64_t ReadXCR0()
+	{
+		#ifdef _MSC_VER
+		return _xgetbv(0);
+		#else
+		uint32_t low, high;
+		__asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+		return (static_cast<uint64_t>(high) << 32) | low;
+		#endif
+	}
+
+	static bool Bit(uint32_t value, int bit)
+	{
+		return (value >> bit) & 1u;
+	}
+	#endif
+
+	static CPUFeatureFlags Detect()
+	{
+		CPUFeatureFlags flags;
+		#if RUNDEE_CPU_X86
+		uint32_t registers[4];
+		CpuId(0, 0, registers);
+		uint32_t maxLeaf = registers[0];
+		if (maxLeaf < 1)
+		{
+			return flags;
+		}
+
+		// eax, ebx, ecx, edx
+		CpuId(1, 0, registers);
+		uint32_t ecx = registers[2];
+		uint32_t edx = registers[3];
+		flags.SSE2 = Bit(edx, 26);
+		flags.SSE3 = Bit(ecx, 0);
+		flags.SSSE3 = Bit(ecx, 9);
+		flags.SSE41 = Bit(ecx, 19);
+		flags.SSE42 = Bit(ecx, 20);
+		flags.POPCNT = Bit(ecx, 23);
+
+		uint64_t xcr0 = Bit(ecx, 27) ? ReadXCR0() : 0;
+		bool avxState = (xcr0 & XSaveAVX) == XSaveAVX;
+		bool avx512State = (xcr0 & XSaveAVX512) == XSaveAVX512;
+		flags.AVX = avxState && Bit(ecx, 28);
+		flags.FMA = flags.AVX && Bit(ecx, 12);
+		flags.F16C = flags.AVX && Bit(ecx, 29);
+
+		if (maxLeaf >= 7)
+		{
+			CpuId(7, 0, registers);
+			uint32_t ebx = registers[1];
+			flags.BMI1 = Bit(ebx, 3);
+			flags.BMI2 = Bit(ebx, 8);
+			flags.AVX2 = flags.AVX && Bit(ebx, 5);
+			flags.AVX512F = avx512State && Bit(ebx, 16);
+			flags.AVX512DQ = flags.AVX512F && Bit(ebx, 17);
+			flags.AVX512BW = flags.AVX512F && Bit(ebx, 30);
+			flags.AVX512VL = flags.AVX512F && Bit(ebx, 31);
+		}
+		#endif
+		return flags;
+	}
+
+	static bool ParseLevel(const char* name, SimdLevel& outLevel)
+	{
+		static constexpr SimdLevel Levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::SSE42, SimdLevel::AVX2, SimdLevel::AVX512 };
+		for (SimdLevel level : Levels)
+		{
+			if (strcmp(name, CPUFeatures::GetLevelName(level)) == 0)
+			{
+				outLevel = level;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static SimdLevel ReadEnvironmentLevel(SimdLevel detected)
+	{
+		std::string value;
+		#ifdef _WIN32
+		char* buffer = nullptr;
+		size_t length = 0;
+		if (_dupenv_s(&buffer, &length, "RUNDEE_SIMD") == 0 && buffer)
+		{
+			value = buffer;
+			free(buffer);
+		}
+		#else
+		if (const char* buffer = getenv("RUNDEE_SIMD"))
+		{
+			value = buffer;
+		}
+		#endif
+
+		if (value.empty())
+		{
+			return detected;
+		}
+
+		SimdLevel requested;
+		if (!ParseLevel(value.c_str(), requested))
+		{
+			Logger::Error("CPUFeatures: unknown RUNDEE_SIMD level \"" + value + "\", using " + CPUFeatures::GetLevelName(detected));
+			return detected;
+		}
+		return requested < detected ? requested : detected;
+	}
+
+	const CPUFeatureFlags& CPUFeatures::Get()
+	{
+		static const CPUFeatureFlags flags = Detect();
+		return flags;
+	}
+
+	SimdLevel CPUFeatures::GetDetectedLevel()
+	{
+		const CPUFeatureFlags& flags = Get();
+		if (flags.AVX2 && flags.FMA && flags.F16C)
+		{
+			if (flags.AVX512F && flags.AVX512BW && flags.AVX512DQ && flags.AVX512VL)
+			{
+				return SimdLevel::AVX512;
+			}
+			return SimdLevel::AVX2;
+		}
+		if (flags.SSE42)
+		{
+			return SimdLevel::SSE42;
+		}
+		return flags.SSE2 ? SimdLevel::SSE2 : SimdLevel::Scalar;
+	}
+
+	SimdLevel CPUFeatures::GetLevel()
+	{
+		static const SimdLevel level = ReadEnvironmentLevel(GetDetectedLevel());
+		return level;
+	}
+
+	const char* CPUFeatures::GetLevelName(SimdLevel level)
+	{
+		switch (level)
+		{
+		case SimdLevel::Scalar: return "scalar";
+		case SimdLevel::SSE2: return "sse2";
+		case SimdLevel::SSE42: return "sse4.2";
+		case SimdLevel::AVX2: return "avx2";
+		case SimdLevel::AVX512: return "avx512";
+		}
+		return "unknown";
+	}
+
+	const char* CPUFeatures::GetBrandString()
+	{
+		static const std::string brand = []()
+		{
+			std::string result;
+			#if RUNDEE_CPU_X86
+			uint32_t registers[4];
+			CpuId(0x80000000u, 0, registers);
+			if (registers[0] >= 0x80000004u)
+			{
+				char text[49] = {};
+				for (uint32_t leaf = 0; leaf < 3; ++leaf)
+				{
+					CpuId(0x80000002u + leaf, 0, registers);
+					memcpy(text + leaf * 16, registers, 16);
+				}
+				result = text;
+				size_t first = result.find_first_not_of(' ');
+				result = first == std::string::npos ? std::string() : result.substr(first, result.find_last_not_of(' ') - first + 1);
+			}
+			#endif
+			return result;
+		}();
+		return brand.c_str();
+	}
+}
@@ -7,12 +7,15 @@
 #include "../include/RundeeEngine/Logger.h"
 #include "../include/RundeeEngine/JobSystem.h"
 #include "../include/RundeeEngine/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
 
 namespace RundeeEngine 
 {
 	std::unique_ptr<ThreadPool> JobSystem::s_ThreadPool;
 
-    void JobSystem::Initialize(size_t threadCount) 
+    void JobSystem::Initialize(size_t threadCount, std::pmr::memory_resource* resource) 
     {
         if (s_ThreadPool) 
         {
@@ -20,7 +23,7 @@ namespace RundeeEngine
             return;
         }
 
-        s_ThreadPool = std::make_unique<ThreadPool>(threadCount);
+        s_ThreadPool = std::make_unique<ThreadPool>(threadCount, resource);
         Logger::Info("JobSystem initialized with " + std::to_string(threadCount) + " threads.");
     }
 
@@ -47,4 +50,65 @@ namespace RundeeEngine
             Logger::Error("Cannot dispatch job: ThreadPool is not initialized.");
         }
     }
+
+    void JobSystem::ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t begin, size_t end)>& job)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        size_t workerCount = s_ThreadPool ? s_ThreadPool->GetThreadCount() : 0;
+        size_t minimumBatch = std::max<size_t>(batchSize, 1);
+        size_t chunkCount = std::min((count + minimumBatch - 1) / minimumBatch, workerCount + 1);
+        if (chunkCount <= 1)
+        {
+            job(0, count);
+            return;
+        }
+
+        size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+        chunkCount = (count + chunkSize - 1) / chunkSize;
+
+        // Not logged per job: this runs every frame on hot paths
+        std::atomic<size_t> remaining(chunkCount - 1);
+        for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+        {
+            size_t begin = chunk * chunkSize;
+            size_t end = std::min(begin + chunkSize, count);
+            s_ThreadPool->Enqueue([&job, &remaining, begin, end]()
+            {
+                struct Completion
+                {
+                    std::atomic<size_t>& Remaining;
+                    ~Completion() { Remaining.fetch_sub(1, std::memory_order_release); }
+                } completion{ remaining };
+                job(begin, end);
+            });
+        }
+
+        // The queued jobs reference job and remaining, so wait even if our own range throws
+        std::exception_ptr exception;
+        try
+        {
+            job(0, chunkSize);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        while (remaining.load(std::memory_order_acquire) > 0)
+        {
+            if (!s_ThreadPool->RunPendingJob())
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
 }
\ No newline at end of file
@@ -5,11 +5,12 @@
 //Description: Logger class implementation file
 
 #include "../include/RundeeEngine/Logger.h"
+#include "../include/RundeeEngine/Memory/MemoryResource.h"
+#include <atomic>
 #include <iostream>
 #include <mutex>
 #include <chrono>
 #include <ctime>
-#include <iomanip>
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -18,6 +19,10 @@
 namespace RundeeEngine 
 {
 	static std::mutex logMutex;
+	static std::atomic<std::pmr::memory_resource*> logResource(nullptr);
+	// Set while this thread formats into logResource, so a resource that
+	// logs from its own allocate does not recurse back into itself.
+	static thread_local bool t_Formatting = false;
 
 	void Logger::Log(const std::string& message, LogLevel level) {
 		switch (level)
@@ -48,6 +53,11 @@ namespace RundeeEngine
 		Print("ERROR", message);
 	}
 
+	void Logger::SetMemoryResource(std::pmr::memory_resource* resource)
+	{
+		logResource.store(resource);
+	}
+
 	void Logger::Print(const std::string& tag, const std::string& message) 
 	{
 		#ifdef _WIN32
@@ -70,15 +80,39 @@ namespace RundeeEngine
 		SetConsoleTextAttribute(hConsole, color);
 		#endif
 
-		std::lock_guard<std::mutex> lock(logMutex);
-
+		// Format before locking: the line buffer is charged to the Logging
+		// tag, and crossing its budget logs a warning from inside the allocation.
 		auto now = std::chrono::system_clock::now();
 		std::time_t t = std::chrono::system_clock::to_time_t(now);
 		std::tm tm;
+		#ifdef _WIN32
 		localtime_s(&tm, &t);
+		#else
+		localtime_r(&t, &tm);
+		#endif
+
+		char timeText[16];
+		std::strftime(timeText, sizeof(timeText), "%H:%M:%S", &tm);
 
-		std::cout << "[" << std::put_time(&tm, "%H:%M:%S") << "] "
-			<< "[" << tag << "] " << message << std::endl;
+		std::pmr::memory_resource* resource = logResource.load();
+		if (!resource)
+		{
+			resource = GetTaggedResource(MemoryTag::Logging);
+		}
+		if (t_Formatting)
+		{
+			resource = std::pmr::new_delete_resource();
+		}
+
+		bool wasFormatting = t_Formatting;
+		t_Formatting = true;
+		std::pmr::string line(resource);
+		line.reserve(tag.size() + message.size() + 16);
+		line.append("[").append(timeText).append("] [").append(tag.c_str()).append("] ").append(message.c_str(), message.size());
+		t_Formatting = wasFormatting;
+
+		std::lock_guard<std::mutex> lock(logMutex);
+		std::cout << line << std::endl;
 		
 		#ifdef _WIN32
 		SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
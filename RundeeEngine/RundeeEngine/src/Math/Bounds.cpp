@@ -0,0 +1,347 @@
+//Project Name: RundeeEngine
+//File Name: Bounds.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Bounding volumes and intersection tests implementation file
+
+#include "../../include/RundeeEngine/Math/Bounds.h"
+#include "../../include/RundeeEngine/Math/SimdKernels.h"
+#include <cmath>
+
+namespace RundeeEngine
+{
+	//----------AABB Implementation----------
+
+	void AABB2::OverlapBatch(const AABB2& query, const AABB2Arrays& boxes, uint8_t* outResults)
+	{
+		float bounds[4] = { query.Min.x, query.Min.y, query.Max.x, query.Max.y };
+		SimdKernels::Get().OverlapRects(bounds, { boxes.MinX, boxes.MinY }, { boxes.MaxX, boxes.MaxY }, outResults, boxes.Count);
+	}
+
+	AABB3 AABB3::Transform(const Mat4& matrix) const
+	{
+		Vec3 extents = Extents();
+		Vec3 newExtents(
+			fabsf(matrix.Columns[0].x) * extents.x + fabsf(matrix.Columns[1].x) * extents.y + fabsf(matrix.Columns[2].x) * extents.z,
+			fabsf(matrix.Columns[0].y) * extents.x + fabsf(matrix.Columns[1].y) * extents.y + fabsf(matrix.Columns[2].y) * extents.z,
+			fabsf(matrix.Columns[0].z) * extents.x + fabsf(matrix.Columns[1].z) * extents.y + fabsf(matrix.Columns[2].z) * extents.z);
+		return FromCenterExtents(matrix.TransformPoint(Center()), newExtents);
+	}
+
+	void AABB3::OverlapBatch(const AABB3& query, const AABB3Arrays& boxes, uint8_t* outResults)
+	{
+		float bounds[6] = { query.Min.x, query.Min.y, query.Min.z, query.Max.x, query.Max.y, query.Max.z };
+		SimdKernels::Get().OverlapBoxes(bounds, { boxes.MinX, boxes.MinY, boxes.MinZ }, { boxes.MaxX, boxes.MaxY, boxes.MaxZ }, outResults, boxes.Count);
+	}
+
+	//----------Sphere Implementation----------
+
+	void Sphere::OverlapBatch(const Sphere& query, const SphereArrays& spheres, uint8_t* outResults)
+	{
+		float sphere[4] = { query.Center.x, query.Center.y, query.Center.z, query.Radius };
+		SimdKernels::Get().OverlapSpheres(sphere, { spheres.CenterX, spheres.CenterY, spheres.CenterZ }, spheres.Radius, outResults, spheres.Count);
+	}
+
+	//----------Plane Implementation----------
+
+	Plane Plane::FromPointNormal(const Vec3& point, const Vec3& normal)
+	{
+		Vec3 n = normal.Normalize();
+		return Plane(n, -n.Dot(point));
+	}
+
+	Plane Plane::FromPoints(const Vec3& a, const Vec3& b, const Vec3& c)
+	{
+		return FromPointNormal(a, (b - a).Cross(c - a));
+	}
+
+	Plane Plane::Normalize() const
+	{
+		float length = Normal.Length();
+		if (length > 0.0f)
+		{
+			float inverseLength = 1.0f / length;
+			return Plane(Normal * inverseLength, Distance * inverseLength);
+		}
+		return *this;
+	}
+
+	//----------Ray Implementation----------
+
+	bool Ray::Intersects(const AABB3& box, float maxDistance, float& outDistance) const
+	{
+		float tNear = 0.0f;
+		float tFar = maxDistance;
+		const float* origin = &Origin.x;
+		const float* direction = &Direction.x;
+		const float* minimum = &box.Min.x;
+		const float* maximum = &box.Max.x;
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			float inverse = 1.0f / direction[axis];
+			float t1 = (minimum[axis] - origin[axis]) * inverse;
+			float t2 = (maximum[axis] - origin[axis]) * inverse;
+			tNear = fmaxf(tNear, fminf(t1, t2));
+			tFar = fminf(tFar, fmaxf(t1, t2));
+		}
+
+		if (tNear > tFar)
+		{
+			return false;
+		}
+		outDistance = tNear;
+		return true;
+	}
+
+	bool Ray::Intersects(const Sphere& sphere, float maxDistance, float& outDistance) const
+	{
+		Vec3 offset = Origin - sphere.Center;
+		float a = Direction.Dot(Direction);
+		float b = offset.Dot(Direction);
+		float c = offset.Dot(offset) - sphere.Radius * sphere.Radius;
+
+		// Outside and pointing away
+		if (a == 0.0f || (c > 0.0f && b > 0.0f))
+		{
+			return false;
+		}
+
+		float discriminant = b * b - a * c;
+		if (discriminant < 0.0f)
+		{
+			return false;
+		}
+
+		float t = fmaxf((-b - sqrtf(discriminant)) / a, 0.0f);
+		if (t > maxDistance)
+		{
+			return false;
+		}
+		outDistance = t;
+		return true;
+	}
+
+	bool Ray::Intersects(const Plane& plane, float maxDistance, float& outDistance) const
+	{
+		float denominator = plane.Normal.Dot(Direction);
+		if (fabsf(denominator) < 1e-8f)
+		{
+			return false;
+		}
+
+		float t = -plane.SignedDistance(Origin) / denominator;
+		if (t < 0.0f || t > maxDistance)
+		{
+			return false;
+		}
+		outDistance = t;
+		return true;
+	}
+
+	void Ray::IntersectBatch(const Ray& ray, const AABB3Arrays& boxes, float maxDistance, uint8_t* outResults, float* outDistances)
+	{
+		float slabs[6] = { ray.Origin.x, ray.Origin.y, ray.Origin.z, 1.0f / ray.Direction.x, 1.0f / ray.Direction.y, 1.0f / ray.Direction.z };
+		SimdKernels::Get().RayBoxes(slabs, { boxes.MinX, boxes.MinY, boxes.MinZ }, { boxes.MaxX, boxes.MaxY, boxes.MaxZ }, maxDistance, outResults, outDistances, boxes.Count);
+	}
+
+	//----------OBB Implementation----------
+
+	OBB OBB::FromAABB(const AABB3& box, const Mat4& matrix)
+	{
+		Vec3 axes[3] = { matrix.Columns[0].ToVec3(), matrix.Columns[1].ToVec3(), matrix.Columns[2].ToVec3() };
+		Vec3 extents = box.Extents();
+		float scales[3] = { axes[0].Length(), axes[1].Length(), axes[2].Length() };
+
+		return OBB(matrix.TransformPoint(box.Center()),
+			Vec3(extents.x * scales[0], extents.y * scales[1], extents.z * scales[2]),
+			Mat3(axes[0].Normalize(), axes[1].Normalize(), axes[2].Normalize()));
+	}
+
+	bool OBB::Contains(const Vec3& point) const
+	{
+		Vec3 offset = point - Center;
+		const float* extents = &Extents.x;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (fabsf(offset.Dot(Rotation.Columns[axis].ToVec3())) > extents[axis])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	Vec3 OBB::ClosestPoint(const Vec3& point) const
+	{
+		Vec3 offset = point - Center;
+		Vec3 result = Center;
+		const float* extents = &Extents.x;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			Vec3 direction = Rotation.Columns[axis].ToVec3();
+			float distance = fmaxf(-extents[axis], fminf(offset.Dot(direction), extents[axis]));
+			result += direction * distance;
+		}
+		return result;
+	}
+
+	// Ericson, Real-Time Collision Detection 4.4.1: the other box is expressed
+	// in this box's frame, then the three face axes of each and the nine edge
+	// cross products are tried as separating axes
+	bool OBB::Intersects(const OBB& other) const
+	{
+		const float epsilon = 1e-6f;
+		const float* a = &Extents.x;
+		const float* b = &other.Extents.x;
+		Vec3 axesA[3] = { Rotation.Columns[0].ToVec3(), Rotation.Columns[1].ToVec3(), Rotation.Columns[2].ToVec3() };
+		Vec3 axesB[3] = { other.Rotation.Columns[0].ToVec3(), other.Rotation.Columns[1].ToVec3(), other.Rotation.Columns[2].ToVec3() };
+
+		float r[3][3];
+		float absR[3][3];
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				r[i][j] = axesA[i].Dot(axesB[j]);
+				// Parallel edges make the cross products near zero; the epsilon keeps that case robust
+				absR[i][j] = fabsf(r[i][j]) + epsilon;
+			}
+		}
+
+		Vec3 offset = other.Center - Center;
+		float t[3] = { offset.Dot(axesA[0]), offset.Dot(axesA[1]), offset.Dot(axesA[2]) };
+
+		for (int i = 0; i < 3; ++i)
+		{
+			float radiusB = b[0] * absR[i][0] + b[1] * absR[i][1] + b[2] * absR[i][2];
+			if (fabsf(t[i]) > a[i] + radiusB)
+			{
+				return false;
+			}
+		}
+
+		for (int j = 0; j < 3; ++j)
+		{
+			float radiusA = a[0] * absR[0][j] + a[1] * absR[1][j] + a[2] * absR[2][j];
+			if (fabsf(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > radiusA + b[j])
+			{
+				return false;
+			}
+		}
+
+		for (int i = 0; i < 3; ++i)
+		{
+			int i1 = (i + 1) % 3;
+			int i2 = (i + 2) % 3;
+			for (int j = 0; j < 3; ++j)
+			{
+				int j1 = (j + 1) % 3;
+				int j2 = (j + 2) % 3;
+				float radiusA = a[i1] * absR[i2][j] + a[i2] * absR[i1][j];
+				float radiusB = b[j1] * absR[i][j2] + b[j2] * absR[i][j1];
+				if (fabsf(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > radiusA + radiusB)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	AABB3 OBB::ToAABB() const
+	{
+		Vec3 extents(
+			fabsf(Rotation.Columns[0].x) * Extents.x + fabsf(Rotation.Columns[1].x) * Extents.y + fabsf(Rotation.Columns[2].x) * Extents.z,
+			fabsf(Rotation.Columns[0].y) * Extents.x + fabsf(Rotation.Columns[1].y) * Extents.y + fabsf(Rotation.Columns[2].y) * Extents.z,
+			fabsf(Rotation.Columns[0].z) * Extents.x + fabsf(Rotation.Columns[1].z) * Extents.y + fabsf(Rotation.Columns[2].z) * Extents.z);
+		return AABB3::FromCenterExtents(Center, extents);
+	}
+
+	//----------Frustum Implementation----------
+
+	Frustum Frustum::FromMatrix(const Mat4& viewProjection)
+	{
+		const Mat4& m = viewProjection;
+		Vec4 row0(m.Columns[0].x, m.Columns[1].x, m.Columns[2].x, m.Columns[3].x);
+		Vec4 row1(m.Columns[0].y, m.Columns[1].y, m.Columns[2].y, m.Columns[3].y);
+		Vec4 row2(m.Columns[0].z, m.Columns[1].z, m.Columns[2].z, m.Columns[3].z);
+		Vec4 row3(m.Columns[0].w, m.Columns[1].w, m.Columns[2].w, m.Columns[3].w);
+
+		Vec4 planes[PlaneCount] = { row3 + row0, row3 - row0, row3 + row1, row3 - row1, row3 + row2, row3 - row2 };
+
+		Frustum frustum;
+		for (int i = 0; i < PlaneCount; ++i)
+		{
+			frustum.Planes[i] = Plane(planes[i].ToVec3(), planes[i].w).Normalize();
+		}
+		return frustum;
+	}
+
+	bool Frustum::Contains(const Vec3& point) const
+	{
+		for (const Plane& plane : Planes)
+		{
+			if (plane.SignedDistance(point) < 0.0f)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool Frustum::Intersects(const Sphere& sphere) const
+	{
+		for (const Plane& plane : Planes)
+		{
+			if (plane.SignedDistance(sphere.Center) < -sphere.Radius)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// The box is outside a plane when even its corner furthest along the normal is behind it
+	bool Frustum::Intersects(const AABB3& box) const
+	{
+		Vec3 center = box.Center();
+		Vec3 extents = box.Extents();
+		for (const Plane& plane : Planes)
+		{
+			float reach = fabsf(plane.Normal.x) * extents.x + fabsf(plane.Normal.y) * extents.y + fabsf(plane.Normal.z) * extents.z;
+			if (plane.SignedDistance(center) + reach < 0.0f)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Kernels take the planes as (normal x, y, z, distance) rows
+	static void PackPlanes(const Frustum& frustum, float* outPlanes)
+	{
+		for (const Plane& plane : frustum.Planes)
+		{
+			*outPlanes++ = plane.Normal.x;
+			*outPlanes++ = plane.Normal.y;
+			*outPlanes++ = plane.Normal.z;
+			*outPlanes++ = plane.Distance;
+		}
+	}
+
+	void Frustum::OverlapBatch(const Frustum& frustum, const SphereArrays& spheres, uint8_t* outResults)
+	{
+		float planes[PlaneCount * 4];
+		PackPlanes(frustum, planes);
+		SimdKernels::Get().FrustumSpheres(planes, { spheres.CenterX, spheres.CenterY, spheres.CenterZ }, spheres.Radius, outResults, spheres.Count);
+	}
+
+	void Frustum::OverlapBatch(const Frustum& frustum, const AABB3Arrays& boxes, uint8_t* outResults)
+	{
+		float planes[PlaneCount * 4];
+		PackPlanes(frustum, planes);
+		SimdKernels::Get().FrustumBoxes(planes, { boxes.MinX, boxes.MinY, boxes.MinZ }, { boxes.MaxX, boxes.MaxY, boxes.MaxZ }, outResults, boxes.Count);
+	}
+}
@@ -0,0 +1,323 @@
+//Project Name: RundeeEngine
+//File Name: Curve.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Piecewise cubic curves with batch and arc-length evaluation implementation file
+
+#include "../../include/RundeeEngine/Math/Curve.h"
+#include "../../include/RundeeEngine/Math/SIMD.h"
+#include "../../include/RundeeEngine/Memory/MemoryResource.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace RundeeEngine
+{
+	// Power basis of each curve type: Bases[type][power][k] is the weight of
+	// the segment's k-th control point in the s^power coefficient
+	static constexpr float Bases[4][4][4] =
+	{
+		// Bezier
+		{ { 1.0f, 0.0f, 0.0f, 0.0f }, { -3.0f, 3.0f, 0.0f, 0.0f }, { 3.0f, -6.0f, 3.0f, 0.0f }, { -1.0f, 3.0f, -3.0f, 1.0f } },
+		// Catmull-Rom
+		{ { 0.0f, 1.0f, 0.0f, 0.0f }, { -0.5f, 0.0f, 0.5f, 0.0f }, { 1.0f, -2.5f, 2.0f, -0.5f }, { -0.5f, 1.5f, -1.5f, 0.5f } },
+		// Hermite: point, tangent, point, tangent
+		{ { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { -3.0f, -2.0f, 3.0f, -1.0f }, { 2.0f, 1.0f, -2.0f, 1.0f } },
+		// B-spline
+		{ { 1.0f / 6.0f, 4.0f / 6.0f, 1.0f / 6.0f, 0.0f }, { -0.5f, 0.0f, 0.5f, 0.0f }, { 0.5f, -1.0f, 0.5f, 0.0f }, { -1.0f / 6.0f, 0.5f, -0.5f, 1.0f / 6.0f } }
+	};
+
+	static constexpr float LaneOffsets[8] = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f };
+
+	static const char* CurveTypeName(CurveType type)
+	{
+		switch (type)
+		{
+		case CurveType::Bezier: return "Bezier";
+		case CurveType::CatmullRom: return "Catmull-Rom";
+		case CurveType::Hermite: return "Hermite";
+		case CurveType::BSpline: return "B-spline";
+		}
+		return "unknown";
+	}
+
+	// Zero when count points do not form a curve of this type
+	static size_t SegmentCountFor(CurveType type, size_t count)
+	{
+		switch (type)
+		{
+		case CurveType::Bezier: return count >= 4 && (count - 1) % 3 == 0 ? (count - 1) / 3 : 0;
+		case CurveType::CatmullRom: return count >= 2 ? count - 1 : 0;
+		case CurveType::Hermite: return count >= 4 && count % 2 == 0 ? count / 2 - 1 : 0;
+		case CurveType::BSpline: return count >= 4 ? count - 3 : 0;
+		}
+		return 0;
+	}
+
+	static size_t ControlIndex(CurveType type, size_t segment, size_t k, size_t count)
+	{
+		switch (type)
+		{
+		case CurveType::Bezier: return 3 * segment + k;
+		case CurveType::CatmullRom: return std::min(segment + k > 0 ? segment + k - 1 : 0, count - 1);
+		case CurveType::Hermite: return 2 * segment + k;
+		case CurveType::BSpline: return segment + k;
+		}
+		return 0;
+	}
+
+	// Splits t into a segment index and the parameter within that segment
+	template<typename L>
+	static typename L::Type Locate(typename L::Type t, float segmentCount, typename L::IntType& outSegment)
+	{
+		using T = typename L::Type;
+		T u = L::Mul(L::Min(L::Max(t, L::Set(0.0f)), L::Set(1.0f)), L::Set(segmentCount));
+		T segment = L::Min(L::IntToFloat(L::FloorToInt(u)), L::Set(segmentCount - 1.0f));
+		outSegment = L::RoundToInt(segment);
+		return L::Sub(u, segment);
+	}
+
+	template<typename L>
+	static typename L::Type Polynomial(typename L::Type c0, typename L::Type c1, typename L::Type c2, typename L::Type c3, typename L::Type s)
+	{
+		return L::MulAdd(L::MulAdd(L::MulAdd(c3, s, c2), s, c1), s, c0);
+	}
+
+	// Each lane may fall in a different segment, so coefficients are gathered
+	template<typename L, size_t Dimension>
+	static void EvaluateLanes(const float* coefficients, size_t segmentCount, typename L::Type t, typename L::Type (&out)[Dimension])
+	{
+		typename L::IntType segment;
+		typename L::Type s = Locate<L>(t, static_cast<float>(segmentCount), segment);
+		typename L::IntType base = L::IntMul(segment, L::IntSet(static_cast<int32_t>(Dimension * 4)));
+		for (size_t component = 0; component < Dimension; ++component)
+		{
+			typename L::IntType index = L::IntAdd(base, L::IntSet(static_cast<int32_t>(component * 4)));
+			out[component] = Polynomial<L>(L::Gather(coefficients, index), L::Gather(coefficients + 1, index),
+				L::Gather(coefficients + 2, index), L::Gather(coefficients + 3, index), s);
+		}
+	}
+
+	// Transposes lanes of x, y(, z) into consecutive vectors
+	template<typename L, size_t Dimension>
+	static void StoreInterleaved(float* out, const typename L::Type (&components)[Dimension])
+	{
+		float lanes[Dimension][L::Width];
+		for (size_t component = 0; component < Dimension; ++component)
+		{
+			L::Store(lanes[component], components[component]);
+		}
+
+		for (size_t lane = 0; lane < L::Width; ++lane)
+		{
+			for (size_t component = 0; component < Dimension; ++component)
+			{
+				out[lane * Dimension + component] = lanes[component][lane];
+			}
+		}
+	}
+
+	// t of a distance that lies between table entries entry and entry + 1
+	static float ParameterInTable(const std::pmr::vector<float>& lengths, size_t entry, float distance)
+	{
+		float span = lengths[entry + 1] - lengths[entry];
+		float fraction = span > 0.0f ? std::min(std::max((distance - lengths[entry]) / span, 0.0f), 1.0f) : 0.0f;
+		return (static_cast<float>(entry) + fraction) / static_cast<float>(lengths.size() - 1);
+	}
+
+	//----------Curve Implementation----------
+
+	template<typename V>
+	Curve<V>::Curve(CurveType type, const V* points, size_t count, size_t arcLengthSamples)
+		: m_Type(type), m_SegmentCount(0), m_Coefficients(GetTaggedResource(MemoryTag::Math)), m_ArcLengths(GetTaggedResource(MemoryTag::Math))
+	{
+		size_t segmentCount = SegmentCountFor(type, count);
+		if (segmentCount == 0)
+		{
+			Logger::Error("Curve: " + std::to_string(count) + " points do not form a " + CurveTypeName(type) + " curve");
+			return;
+		}
+
+		m_SegmentCount = segmentCount;
+		m_Coefficients.resize(segmentCount * SegmentStride);
+		const float (&basis)[4][4] = Bases[static_cast<int>(type)];
+		for (size_t segment = 0; segment < segmentCount; ++segment)
+		{
+			float control[4][Dimension];
+			for (size_t k = 0; k < 4; ++k)
+			{
+				memcpy(control[k], &points[ControlIndex(type, segment, k, count)], sizeof(V));
+			}
+
+			float* coefficients = &m_Coefficients[segment * SegmentStride];
+			for (size_t component = 0; component < Dimension; ++component)
+			{
+				for (size_t power = 0; power < 4; ++power)
+				{
+					float sum = 0.0f;
+					for (size_t k = 0; k < 4; ++k)
+					{
+						sum += basis[power][k] * control[k][component];
+					}
+					coefficients[component * 4 + power] = sum;
+				}
+			}
+		}
+
+		BuildArcLengths(arcLengthSamples);
+	}
+
+	template<typename V>
+	V Curve<V>::Evaluate(float t) const
+	{
+		V result;
+		if (IsEmpty())
+		{
+			return result;
+		}
+
+		float components[Dimension];
+		EvaluateLanes<SimdFloat1>(m_Coefficients.data(), m_SegmentCount, t, components);
+		memcpy(&result, components, sizeof(V));
+		return result;
+	}
+
+	template<typename V>
+	V Curve<V>::Derivative(float t) const
+	{
+		V result;
+		if (IsEmpty())
+		{
+			return result;
+		}
+
+		int32_t segment;
+		float s = Locate<SimdFloat1>(t, static_cast<float>(m_SegmentCount), segment);
+		const float* coefficients = &m_Coefficients[static_cast<size_t>(segment) * SegmentStride];
+		float components[Dimension];
+		for (size_t component = 0; component < Dimension; ++component)
+		{
+			const float* c = coefficients + component * 4;
+			// Chain rule: s advances segmentCount times faster than t
+			components[component] = (c[1] + s * (2.0f * c[2] + 3.0f * c[3] * s)) * static_cast<float>(m_SegmentCount);
+		}
+		memcpy(&result, components, sizeof(V));
+		return result;
+	}
+
+	template<typename V>
+	float Curve<V>::ParameterAtDistance(float distance) const
+	{
+		if (IsEmpty() || distance <= 0.0f)
+		{
+			return 0.0f;
+		}
+		if (distance >= GetLength())
+		{
+			return 1.0f;
+		}
+
+		size_t entry = static_cast<size_t>(std::upper_bound(m_ArcLengths.begin(), m_ArcLengths.end(), distance) - m_ArcLengths.begin()) - 1;
+		return ParameterInTable(m_ArcLengths, entry, distance);
+	}
+
+	template<typename V>
+	void Curve<V>::Evaluate(const float* t, V* out, size_t count) const
+	{
+		if (IsEmpty())
+		{
+			std::fill(out, out + count, V());
+			return;
+		}
+
+		const float* coefficients = m_Coefficients.data();
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			typename L::Type components[Dimension];
+			EvaluateLanes<L>(coefficients, m_SegmentCount, L::Load(t + i), components);
+			StoreInterleaved<L>(reinterpret_cast<float*>(out + i), components);
+		});
+	}
+
+	template<typename V>
+	void Curve<V>::Sample(V* out, size_t count) const
+	{
+		if (IsEmpty() || count < 2)
+		{
+			std::fill(out, out + count, Evaluate(0.0f));
+			return;
+		}
+
+		// Evenly spaced parameters fill each segment in one run, so its
+		// coefficients are broadcast once rather than gathered per point
+		float scale = static_cast<float>(m_SegmentCount) / static_cast<float>(count - 1);
+		size_t begin = 0;
+		for (size_t segment = 0; segment < m_SegmentCount; ++segment)
+		{
+			size_t end = segment + 1 == m_SegmentCount ? count : ((segment + 1) * (count - 1) + m_SegmentCount - 1) / m_SegmentCount;
+			const float* coefficients = &m_Coefficients[segment * SegmentStride];
+			float offset = static_cast<float>(segment);
+			SimdForEach(end - begin, [&](auto lane, size_t i)
+			{
+				using L = decltype(lane);
+				typename L::Type index = L::Add(L::Set(static_cast<float>(begin + i)), L::Load(LaneOffsets));
+				typename L::Type s = L::Sub(L::Mul(index, L::Set(scale)), L::Set(offset));
+				typename L::Type components[Dimension];
+				for (size_t component = 0; component < Dimension; ++component)
+				{
+					const float* c = coefficients + component * 4;
+					components[component] = Polynomial<L>(L::Set(c[0]), L::Set(c[1]), L::Set(c[2]), L::Set(c[3]), s);
+				}
+				StoreInterleaved<L>(reinterpret_cast<float*>(out + begin + i), components);
+			});
+			begin = end;
+		}
+	}
+
+	template<typename V>
+	void Curve<V>::SampleUniform(V* out, size_t count) const
+	{
+		if (IsEmpty() || count < 2)
+		{
+			std::fill(out, out + count, Evaluate(0.0f));
+			return;
+		}
+
+		// Distances rise with i, so the table is walked once instead of searched
+		std::pmr::vector<float> parameters(count, GetTaggedResource(MemoryTag::Math));
+		float step = GetLength() / static_cast<float>(count - 1);
+		size_t lastEntry = m_ArcLengths.size() - 2;
+		size_t entry = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			float distance = static_cast<float>(i) * step;
+			while (entry < lastEntry && m_ArcLengths[entry + 1] < distance)
+			{
+				++entry;
+			}
+			parameters[i] = ParameterInTable(m_ArcLengths, entry, distance);
+		}
+		parameters[count - 1] = 1.0f;
+		Evaluate(parameters.data(), out, count);
+	}
+
+	template<typename V>
+	void Curve<V>::BuildArcLengths(size_t samplesPerSegment)
+	{
+		size_t chordCount = m_SegmentCount * std::max<size_t>(samplesPerSegment, 1);
+		std::pmr::vector<V> points(chordCount + 1, GetTaggedResource(MemoryTag::Math));
+		Sample(points.data(), points.size());
+
+		m_ArcLengths.resize(chordCount + 1);
+		m_ArcLengths[0] = 0.0f;
+		for (size_t i = 1; i <= chordCount; ++i)
+		{
+			m_ArcLengths[i] = m_ArcLengths[i - 1] + (points[i] - points[i - 1]).Length();
+		}
+	}
+
+	template class Curve<Vec2>;
+	template class Curve<Vec3>;
+}
@@ -0,0 +1,111 @@
+//Project Name: RundeeEngine
+//File Name: FastMath.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Polynomial approximations of transcendental functions implementation file
+
+#include "../../include/RundeeEngine/Math/FastMath.h"
+#include "../../include/RundeeEngine/Math/SimdKernels.h"
+
+namespace RundeeEngine
+{
+	void FastMath::Sin(const float* x, float* out, size_t count, MathPrecision precision)
+	{
+		if (precision == MathPrecision::Precise)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				out[i] = sinf(x[i]);
+			}
+			return;
+		}
+
+		SimdKernels::Get().Sin(x, out, count);
+	}
+
+	void FastMath::Cos(const float* x, float* out, size_t count, MathPrecision precision)
+	{
+		if (precision == MathPrecision::Precise)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				out[i] = cosf(x[i]);
+			}
+			return;
+		}
+
+		SimdKernels::Get().Cos(x, out, count);
+	}
+
+	void FastMath::SinCos(const float* x, float* outSin, float* outCos, size_t count, MathPrecision precision)
+	{
+		if (precision == MathPrecision::Precise)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				float value = x[i];
+				outSin[i] = sinf(value);
+				outCos[i] = cosf(value);
+			}
+			return;
+		}
+
+		SimdKernels::Get().SinCos(x, outSin, outCos, count);
+	}
+
+	void FastMath::Atan2(const float* y, const float* x, float* out, size_t count, MathPrecision precision)
+	{
+		if (precision == MathPrecision::Precise)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				out[i] = atan2f(y[i], x[i]);
+			}
+			return;
+		}
+
+		SimdKernels::Get().Atan2(y, x, out, count);
+	}
+
+	void FastMath::RSqrt(const float* x, float* out, size_t count, MathPrecision precision)
+	{
+		if (precision == MathPrecision::Precise)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				out[i] = 1.0f / sqrtf(x[i]);
+			}
+			return;
+		}
+
+		SimdKernels::Get().RSqrt(x, out, count);
+	}
+
+	void FastMath::Exp(const float* x, float* out, size_t count, MathPrecision precision)
+	{
+		if (precision == MathPrecision::Precise)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				out[i] = expf(x[i]);
+			}
+			return;
+		}
+
+		SimdKernels::Get().Exp(x, out, count);
+	}
+
+	void FastMath::Log(const float* x, float* out, size_t count, MathPrecision precision)
+	{
+		if (precision == MathPrecision::Precise)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				out[i] = logf(x[i]);
+			}
+			return;
+		}
+
+		SimdKernels::Get().Log(x, out, count);
+	}
+}
@@ -0,0 +1,289 @@
+//Project Name: RundeeEngine
+//File Name: FixedPoint.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Deterministic fixed-point scalar and vector types implementation file
+
+#include "../../include/RundeeEngine/Math/FixedPoint.h"
+#include "../../include/RundeeEngine/Math/SIMD.h"
+#include <cmath>
+
+namespace RundeeEngine
+{
+	// Raw Q16.16 lanes for the batch operations, mirroring the float lanes in SIMD.h
+	struct FixedLane1
+	{
+		using Type = int32_t;
+		static Type Load(const Fixed16* p) { return p->Raw; }
+		static void Store(Fixed16* p, Type v) { p->Raw = v; }
+		static Type Set(Fixed16 v) { return v.Raw; }
+		static Type Add(Type a, Type b) { return static_cast<Type>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b)); }
+		static Type Sub(Type a, Type b) { return static_cast<Type>(static_cast<uint32_t>(a) - static_cast<uint32_t>(b)); }
+		static Type Mul(Type a, Type b) { return static_cast<Type>((static_cast<int64_t>(a) * b) >> 16); }
+	};
+
+#if RUNDEE_SIMD_SSE2
+	struct FixedLane4
+	{
+		using Type = __m128i;
+		static Type Load(const Fixed16* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+		static void Store(Fixed16* p, Type v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+		static Type Set(Fixed16 v) { return _mm_set1_epi32(v.Raw); }
+		static Type Add(Type a, Type b) { return _mm_add_epi32(a, b); }
+		static Type Sub(Type a, Type b) { return _mm_sub_epi32(a, b); }
+
+		// SSE2 only has the unsigned 32x32 multiply. Bits 16..47 of each product
+		// are kept, and the signed result differs from the unsigned one by the
+		// other operand (shifted up 32) wherever an operand is negative.
+		static Type Mul(Type a, Type b)
+		{
+			__m128i even = _mm_srli_epi64(_mm_mul_epu32(a, b), 16);
+			__m128i odd = _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), 16);
+			__m128i lowMask = _mm_set_epi32(0, -1, 0, -1);
+			__m128i product = _mm_or_si128(_mm_and_si128(even, lowMask), _mm_andnot_si128(lowMask, odd));
+			__m128i correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+			return _mm_sub_epi32(product, _mm_slli_epi32(correction, 16));
+		}
+	};
+#endif
+
+#if RUNDEE_SIMD_AVX2
+	struct FixedLane8
+	{
+		using Type = __m256i;
+		static Type Load(const Fixed16* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+		static void Store(Fixed16* p, Type v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+		static Type Set(Fixed16 v) { return _mm256_set1_epi32(v.Raw); }
+		static Type Add(Type a, Type b) { return _mm256_add_epi32(a, b); }
+		static Type Sub(Type a, Type b) { return _mm256_sub_epi32(a, b); }
+
+		static Type Mul(Type a, Type b)
+		{
+			__m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 16);
+			__m256i odd = _mm256_slli_epi64(_mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)), 16);
+			return _mm256_blend_epi32(even, odd, 0xAA);
+		}
+	};
+#endif
+
+	template<typename Kernel>
+	static void FixedForEach(size_t count, const Kernel& kernel)
+	{
+		size_t i = 0;
+#if RUNDEE_SIMD_AVX2
+		for (; i + 8 <= count; i += 8)
+		{
+			kernel(FixedLane8(), i);
+		}
+#endif
+#if RUNDEE_SIMD_SSE2
+		for (; i + 4 <= count; i += 4)
+		{
+			kernel(FixedLane4(), i);
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			kernel(FixedLane1(), i);
+		}
+	}
+
+	void FixedMath::Add(const Fixed16* a, const Fixed16* b, Fixed16* out, size_t count)
+	{
+		FixedForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, L::Add(L::Load(a + i), L::Load(b + i)));
+		});
+	}
+
+	void FixedMath::Subtract(const Fixed16* a, const Fixed16* b, Fixed16* out, size_t count)
+	{
+		FixedForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, L::Sub(L::Load(a + i), L::Load(b + i)));
+		});
+	}
+
+	void FixedMath::Multiply(const Fixed16* a, const Fixed16* b, Fixed16* out, size_t count)
+	{
+		FixedForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, L::Mul(L::Load(a + i), L::Load(b + i)));
+		});
+	}
+
+	void FixedMath::Scale(const Fixed16* a, Fixed16 scalar, Fixed16* out, size_t count)
+	{
+		FixedForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, L::Mul(L::Load(a + i), L::Set(scalar)));
+		});
+	}
+
+	void FixedMath::MulAdd(const Fixed16* a, Fixed16 scalar, const Fixed16* b, Fixed16* out, size_t count)
+	{
+		FixedForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, L::Add(L::Mul(L::Load(a + i), L::Set(scalar)), L::Load(b + i)));
+		});
+	}
+
+	void FixedMath::Sqrt(const Fixed16* x, Fixed16* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			out[i] = Sqrt(x[i]);
+		}
+	}
+
+	void FixedMath::Length(const Fixed16* x, const Fixed16* y, Fixed16* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			out[i] = Fixed16Vec2(x[i], y[i]).Length();
+		}
+	}
+
+	int64_t FixedMath::DivShift(int64_t a, int64_t b, int shift)
+	{
+		bool negative = (a < 0) != (b < 0);
+		uint64_t magnitudeA = a < 0 ? 0 - static_cast<uint64_t>(a) : static_cast<uint64_t>(a);
+		uint64_t magnitudeB = b < 0 ? 0 - static_cast<uint64_t>(b) : static_cast<uint64_t>(b);
+
+		// The quotient fits in 63 bits exactly when a / 2^(63 - shift) < b
+		if (magnitudeB == 0 || (magnitudeA >> (63 - shift)) >= magnitudeB)
+		{
+			return negative ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max();
+		}
+
+		uint64_t quotient;
+		if (shift == 0)
+		{
+			quotient = magnitudeA / magnitudeB;
+		}
+		else
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			uint64_t remainder;
+			quotient = _udiv128(magnitudeA >> (64 - shift), magnitudeA << shift, magnitudeB, &remainder);
+#else
+			quotient = static_cast<uint64_t>((static_cast<unsigned __int128>(magnitudeA) << shift) / magnitudeB);
+#endif
+		}
+		return negative ? -static_cast<int64_t>(quotient) : static_cast<int64_t>(quotient);
+	}
+
+	uint64_t FixedMath::SqrtShift(uint64_t value, int shift)
+	{
+		// Small inputs go through the double root, which only needs to land
+		// within one of the answer: the integer fix-up makes it exact
+		if (shift <= 52 && value < (static_cast<uint64_t>(1) << (52 - shift)))
+		{
+			uint64_t scaled = value << shift;
+			uint64_t root = static_cast<uint64_t>(sqrt(static_cast<double>(scaled)));
+			while (root * root > scaled)
+			{
+				--root;
+			}
+			while ((root + 1) * (root + 1) <= scaled)
+			{
+				++root;
+			}
+			return root;
+		}
+
+		// Digit by digit over the (64 + shift)-bit number, two bits per step
+		uint64_t remainder = 0;
+		uint64_t root = 0;
+		for (int bit = 64 + shift - 2; bit >= 0; bit -= 2)
+		{
+			uint64_t pair = bit >= shift ? (value >> (bit - shift)) & 3 : 0;
+			remainder = (remainder << 2) | pair;
+			root <<= 1;
+			uint64_t trial = (root << 1) | 1;
+			if (remainder >= trial)
+			{
+				remainder -= trial;
+				root |= 1;
+			}
+		}
+		return root;
+	}
+
+	int64_t FixedMath::SinHalfTurns(int64_t halfTurns)
+	{
+		// Nearest whole half-turn n leaves r in [-0.5, 0.5); odd n flips the sign
+		uint64_t biased = static_cast<uint64_t>(halfTurns) + (static_cast<uint64_t>(1) << 31);
+		bool odd = ((biased >> 32) & 1) != 0;
+		int64_t r = (static_cast<int64_t>(biased & 0xFFFFFFFFu) - (static_cast<int64_t>(1) << 31)) >> 2;
+
+		// sin(pi * r) as r * p(r^2), minimax coefficients in Q30
+		int64_t z = (r * r) >> 30;
+		int64_t p = 82914846;
+		p = ((p * z) >> 30) - 642146331;
+		p = ((p * z) >> 30) + 2738075385;
+		p = ((p * z) >> 30) - 5548783013;
+		p = ((p * z) >> 30) + 3373259347;
+		int64_t s = (r * p) >> 30;
+		return odd ? -s : s;
+	}
+
+	int64_t FixedMath::Atan2Radians(int64_t y, int64_t x)
+	{
+		static constexpr int64_t One = static_cast<int64_t>(1) << 30;
+		static constexpr int64_t QuarterPi = 843314857;
+		static constexpr int64_t HalfPi = 1686629713;
+		static constexpr int64_t Pi = 3373259426;
+		static constexpr int64_t TanEighthPi = 444758426;
+
+		if (x == 0 && y == 0)
+		{
+			return 0;
+		}
+
+		uint64_t magnitudeX = x < 0 ? 0 - static_cast<uint64_t>(x) : static_cast<uint64_t>(x);
+		uint64_t magnitudeY = y < 0 ? 0 - static_cast<uint64_t>(y) : static_cast<uint64_t>(y);
+		bool steep = magnitudeY > magnitudeX;
+		uint64_t numerator = steep ? magnitudeX : magnitudeY;
+		uint64_t denominator = steep ? magnitudeY : magnitudeX;
+		// Only INT64_MIN's magnitude does not fit back into int64_t
+		if (denominator >> 63)
+		{
+			numerator >>= 1;
+			denominator >>= 1;
+		}
+		int64_t t = DivShift(static_cast<int64_t>(numerator), static_cast<int64_t>(denominator), 30);
+
+		// atan(t) = pi / 4 + atan((t - 1) / (t + 1)) folds [tan(pi / 8), 1] down
+		int64_t angle = 0;
+		if (t > TanEighthPi)
+		{
+			t = (t - One) * One / (t + One);
+			angle = QuarterPi;
+		}
+
+		int64_t z = (t * t) >> 30;
+		int64_t p = -62697335;
+		p = ((p * z) >> 30) + 112541497;
+		p = ((p * z) >> 30) - 152731978;
+		p = ((p * z) >> 30) + 214716495;
+		p = ((p * z) >> 30) - 357913276;
+		p = ((p * z) >> 30) + 1073741820;
+		angle += (t * p) >> 30;
+
+		if (steep)
+		{
+			angle = HalfPi - angle;
+		}
+		if (x < 0)
+		{
+			angle = Pi - angle;
+		}
+		return y < 0 ? -angle : angle;
+	}
+}
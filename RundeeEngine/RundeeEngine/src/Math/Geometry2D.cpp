@@ -0,0 +1,1834 @@
+//Project Name: RundeeEngine
+//File Name: Geometry2D.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Convex hulls, triangulation, clipping and offsetting of 2D polygons implementation file
+
+#include "../../include/RundeeEngine/Math/Geometry2D.h"
+#include "../../include/RundeeEngine/Memory/MemoryResource.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace RundeeEngine
+{
+	static constexpr uint32_t NoIndex = 0xFFFFFFFFu;
+
+	// Carves typed arrays out of one scratch block; with no block it only measures
+	class ScratchLayout
+	{
+	public:
+		explicit ScratchLayout(void* base = nullptr) : m_Base(static_cast<uint8_t*>(base)), m_Size(0) {}
+
+		template<typename T>
+		T* Take(size_t count)
+		{
+			m_Size = (m_Size + alignof(T) - 1) / alignof(T) * alignof(T);
+			T* result = m_Base ? reinterpret_cast<T*>(m_Base + m_Size) : nullptr;
+			m_Size += count * sizeof(T);
+			return result;
+		}
+
+		size_t GetSize() const { return m_Size; }
+
+	private:
+		uint8_t* m_Base;
+		size_t m_Size;
+	};
+
+	// Scratch for the vector forms, from the Math heap
+	static std::pmr::vector<uint64_t> AllocateScratch(size_t bytes)
+	{
+		return std::pmr::vector<uint64_t>((bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t), GetTaggedResource(MemoryTag::Math));
+	}
+
+	// Twice the signed area of abc: positive when counter-clockwise
+	static double Orient(double ax, double ay, double bx, double by, double cx, double cy)
+	{
+		return (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+	}
+
+	static double Orient(const Vec2& a, const Vec2& b, const Vec2& c)
+	{
+		return Orient(a.x, a.y, b.x, b.y, c.x, c.y);
+	}
+
+	// Spreads the low 16 bits to the even bit positions
+	static uint32_t SpreadBits(uint32_t value)
+	{
+		value = (value | (value << 8)) & 0x00FF00FFu;
+		value = (value | (value << 4)) & 0x0F0F0F0Fu;
+		value = (value | (value << 2)) & 0x33333333u;
+		value = (value | (value << 1)) & 0x55555555u;
+		return value;
+	}
+
+	//----------Polygon Implementation----------
+
+	float Geometry2D::SignedArea(const Vec2* polygon, size_t count)
+	{
+		double area = 0.0;
+		for (size_t i = 0, j = count - 1; i < count; j = i++)
+		{
+			area += static_cast<double>(polygon[j].x) * polygon[i].y - static_cast<double>(polygon[i].x) * polygon[j].y;
+		}
+		return static_cast<float>(area * 0.5);
+	}
+
+	bool Geometry2D::ContainsPoint(const Vec2* polygon, size_t count, const Vec2& point)
+	{
+		bool inside = false;
+		for (size_t i = 0, j = count - 1; i < count; j = i++)
+		{
+			const Vec2& a = polygon[i];
+			const Vec2& b = polygon[j];
+			if ((a.y > point.y) != (b.y > point.y) && point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x)
+			{
+				inside = !inside;
+			}
+		}
+		return inside;
+	}
+
+	//----------Convex Hull Implementation----------
+
+	static bool LessXY(const Vec2& a, const Vec2& b)
+	{
+		return a.x < b.x || (a.x == b.x && a.y < b.y);
+	}
+
+	size_t Geometry2D::ConvexHull(Vec2* points, size_t count, Vec2* outHull)
+	{
+		std::sort(points, points + count, LessXY);
+		count = static_cast<size_t>(std::unique(points, points + count) - points);
+		if (count < 3)
+		{
+			std::copy(points, points + count, outHull);
+			return count;
+		}
+
+		// Lower hull left to right, then upper hull right to left; the last point repeats the first
+		size_t size = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			while (size >= 2 && Orient(outHull[size - 2], outHull[size - 1], points[i]) <= 0.0)
+			{
+				--size;
+			}
+			outHull[size++] = points[i];
+		}
+		for (size_t i = count - 1, lowerSize = size + 1; i-- > 0;)
+		{
+			while (size >= lowerSize && Orient(outHull[size - 2], outHull[size - 1], points[i]) <= 0.0)
+			{
+				--size;
+			}
+			outHull[size++] = points[i];
+		}
+		return size - 1;
+	}
+
+	void Geometry2D::ConvexHull(const Vec2* points, size_t count, std::pmr::vector<Vec2>& outHull)
+	{
+		std::pmr::vector<Vec2> sorted(points, points + count, GetTaggedResource(MemoryTag::Math));
+		outHull.resize(count + 1);
+		outHull.resize(ConvexHull(sorted.data(), count, outHull.data()));
+	}
+
+	//----------Ear Clipping Implementation----------
+
+	// A port of the earcut algorithm (Mapbox, ISC licence) for a single
+	// outline. Vertices form a circular list, counter-clockwise; a second
+	// list through PrevZ/NextZ orders them along a z-order curve so ear tests
+	// only look at vertices whose curve position falls in the ear's bounds.
+	struct EarNode
+	{
+		double X, Y;
+		uint32_t Index;
+		uint32_t Z;
+		EarNode* Prev;
+		EarNode* Next;
+		EarNode* PrevZ;
+		EarNode* NextZ;
+	};
+
+	class EarClipper
+	{
+	public:
+		// Below this many vertices the plain ear test is faster than hashing
+		static constexpr size_t HashThreshold = 80;
+
+		EarClipper(EarNode* nodes, size_t nodeCapacity, uint32_t* outIndices, size_t triangleCapacity)
+			: m_Nodes(nodes), m_NodeCount(0), m_NodeCapacity(nodeCapacity), m_Out(outIndices), m_TriangleCount(0), m_TriangleCapacity(triangleCapacity),
+			m_MinX(0.0), m_MinY(0.0), m_InverseSize(0.0), m_Overflow(false)
+		{
+		}
+
+		size_t Run(const Vec2* polygon, size_t count)
+		{
+			EarNode* outline = BuildList(polygon, count);
+			if (!outline || outline->Next == outline->Prev)
+			{
+				return 0;
+			}
+
+			if (count > HashThreshold)
+			{
+				double maxX = m_MinX = polygon[0].x;
+				double maxY = m_MinY = polygon[0].y;
+				for (size_t i = 1; i < count; ++i)
+				{
+					m_MinX = std::min(m_MinX, static_cast<double>(polygon[i].x));
+					m_MinY = std::min(m_MinY, static_cast<double>(polygon[i].y));
+					maxX = std::max(maxX, static_cast<double>(polygon[i].x));
+					maxY = std::max(maxY, static_cast<double>(polygon[i].y));
+				}
+				double size = std::max(maxX - m_MinX, maxY - m_MinY);
+				m_InverseSize = size > 0.0 ? 32767.0 / size : 0.0;
+			}
+
+			ClipEars(outline, 0);
+			if (m_Overflow)
+			{
+				Logger::Error("Geometry2D::Triangulate: output or scratch too small for " + std::to_string(count) + " vertices");
+				return 0;
+			}
+			return m_TriangleCount;
+		}
+
+	private:
+		// Twice the area of pqr, negative when counter-clockwise (earcut's sign)
+		static double Area(const EarNode* p, const EarNode* q, const EarNode* r)
+		{
+			return (q->Y - p->Y) * (r->X - q->X) - (q->X - p->X) * (r->Y - q->Y);
+		}
+
+		static bool Equals(const EarNode* a, const EarNode* b)
+		{
+			return a->X == b->X && a->Y == b->Y;
+		}
+
+		static int Sign(double value)
+		{
+			return (value > 0.0) - (value < 0.0);
+		}
+
+		static bool PointInTriangle(double ax, double ay, double bx, double by, double cx, double cy, double px, double py)
+		{
+			return (cx - px) * (ay - py) >= (ax - px) * (cy - py) &&
+				(ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+				(bx - px) * (cy - py) >= (cx - px) * (by - py);
+		}
+
+		static bool OnSegment(const EarNode* p, const EarNode* q, const EarNode* r)
+		{
+			return q->X <= std::max(p->X, r->X) && q->X >= std::min(p->X, r->X) && q->Y <= std::max(p->Y, r->Y) && q->Y >= std::min(p->Y, r->Y);
+		}
+
+		static bool Intersects(const EarNode* p1, const EarNode* q1, const EarNode* p2, const EarNode* q2)
+		{
+			int o1 = Sign(Area(p1, q1, p2));
+			int o2 = Sign(Area(p1, q1, q2));
+			int o3 = Sign(Area(p2, q2, p1));
+			int o4 = Sign(Area(p2, q2, q1));
+			return (o1 != o2 && o3 != o4) ||
+				(o1 == 0 && OnSegment(p1, p2, q1)) || (o2 == 0 && OnSegment(p1, q2, q1)) ||
+				(o3 == 0 && OnSegment(p2, p1, q2)) || (o4 == 0 && OnSegment(p2, q1, q2));
+		}
+
+		static bool IntersectsPolygon(const EarNode* a, const EarNode* b)
+		{
+			const EarNode* p = a;
+			do
+			{
+				if (p->Index != a->Index && p->Next->Index != a->Index && p->Index != b->Index && p->Next->Index != b->Index && Intersects(p, p->Next, a, b))
+				{
+					return true;
+				}
+				p = p->Next;
+			} while (p != a);
+			return false;
+		}
+
+		// Whether the diagonal ab starts into the polygon's interior at a
+		static bool LocallyInside(const EarNode* a, const EarNode* b)
+		{
+			return Area(a->Prev, a, a->Next) < 0.0 ?
+				Area(a, b, a->Next) >= 0.0 && Area(a, a->Prev, b) >= 0.0 :
+				Area(a, b, a->Prev) < 0.0 || Area(a, a->Next, b) < 0.0;
+		}
+
+		static bool MiddleInside(const EarNode* a, const EarNode* b)
+		{
+			const EarNode* p = a;
+			bool inside = false;
+			double px = (a->X + b->X) * 0.5;
+			double py = (a->Y + b->Y) * 0.5;
+			do
+			{
+				if ((p->Y > py) != (p->Next->Y > py) && p->Next->Y != p->Y && px < (p->Next->X - p->X) * (py - p->Y) / (p->Next->Y - p->Y) + p->X)
+				{
+					inside = !inside;
+				}
+				p = p->Next;
+			} while (p != a);
+			return inside;
+		}
+
+		static bool IsValidDiagonal(const EarNode* a, const EarNode* b)
+		{
+			return a->Next->Index != b->Index && a->Prev->Index != b->Index && !IntersectsPolygon(a, b) &&
+				((LocallyInside(a, b) && LocallyInside(b, a) && MiddleInside(a, b) && (Area(a->Prev, a, b->Prev) != 0.0 || Area(a, b->Prev, b) != 0.0)) ||
+				(Equals(a, b) && Area(a->Prev, a, a->Next) > 0.0 && Area(b->Prev, b, b->Next) > 0.0));
+		}
+
+		static void RemoveNode(EarNode* p)
+		{
+			p->Next->Prev = p->Prev;
+			p->Prev->Next = p->Next;
+			if (p->PrevZ)
+			{
+				p->PrevZ->NextZ = p->NextZ;
+			}
+			if (p->NextZ)
+			{
+				p->NextZ->PrevZ = p->PrevZ;
+			}
+		}
+
+		EarNode* NewNode(uint32_t index, double x, double y)
+		{
+			if (m_NodeCount == m_NodeCapacity)
+			{
+				m_Overflow = true;
+				return nullptr;
+			}
+			EarNode* node = &m_Nodes[m_NodeCount++];
+			*node = { x, y, index, 0, nullptr, nullptr, nullptr, nullptr };
+			return node;
+		}
+
+		EarNode* InsertNode(uint32_t index, const Vec2& point, EarNode* last)
+		{
+			EarNode* node = NewNode(index, point.x, point.y);
+			if (!last)
+			{
+				node->Prev = node;
+				node->Next = node;
+			}
+			else
+			{
+				node->Next = last->Next;
+				node->Prev = last;
+				last->Next->Prev = node;
+				last->Next = node;
+			}
+			return node;
+		}
+
+		EarNode* BuildList(const Vec2* polygon, size_t count)
+		{
+			EarNode* last = nullptr;
+			if (Geometry2D::SignedArea(polygon, count) >= 0.0f)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					last = InsertNode(static_cast<uint32_t>(i), polygon[i], last);
+				}
+			}
+			else
+			{
+				for (size_t i = count; i-- > 0;)
+				{
+					last = InsertNode(static_cast<uint32_t>(i), polygon[i], last);
+				}
+			}
+
+			if (last && Equals(last, last->Next))
+			{
+				RemoveNode(last);
+				last = last->Next;
+			}
+			return last;
+		}
+
+		void Emit(const EarNode* a, const EarNode* b, const EarNode* c)
+		{
+			if (m_TriangleCount == m_TriangleCapacity)
+			{
+				m_Overflow = true;
+				return;
+			}
+			uint32_t* out = m_Out + 3 * m_TriangleCount++;
+			out[0] = a->Index;
+			out[1] = b->Index;
+			out[2] = c->Index;
+		}
+
+		// Drops duplicate and collinear vertices
+		static EarNode* FilterPoints(EarNode* start, EarNode* end = nullptr)
+		{
+			if (!start)
+			{
+				return start;
+			}
+			if (!end)
+			{
+				end = start;
+			}
+
+			EarNode* p = start;
+			bool again;
+			do
+			{
+				again = false;
+				if (Equals(p, p->Next) || Area(p->Prev, p, p->Next) == 0.0)
+				{
+					RemoveNode(p);
+					p = end = p->Prev;
+					if (p == p->Next)
+					{
+						break;
+					}
+					again = true;
+				}
+				else
+				{
+					p = p->Next;
+				}
+			} while (again || p != end);
+			return end;
+		}
+
+		uint32_t ZOrder(double x, double y) const
+		{
+			uint32_t qx = static_cast<uint32_t>((x - m_MinX) * m_InverseSize);
+			uint32_t qy = static_cast<uint32_t>((y - m_MinY) * m_InverseSize);
+			return SpreadBits(qx) | (SpreadBits(qy) << 1);
+		}
+
+		// Simon Tatham's linked-list merge sort over the z-order links
+		static void SortByZ(EarNode* list)
+		{
+			size_t inSize = 1;
+			size_t mergeCount;
+			do
+			{
+				EarNode* p = list;
+				EarNode* tail = nullptr;
+				list = nullptr;
+				mergeCount = 0;
+
+				while (p)
+				{
+					++mergeCount;
+					EarNode* q = p;
+					size_t pSize = 0;
+					for (size_t i = 0; i < inSize && q; ++i)
+					{
+						++pSize;
+						q = q->NextZ;
+					}
+					size_t qSize = inSize;
+
+					while (pSize > 0 || (qSize > 0 && q))
+					{
+						EarNode* e;
+						if (pSize != 0 && (qSize == 0 || !q || p->Z <= q->Z))
+						{
+							e = p;
+							p = p->NextZ;
+							--pSize;
+						}
+						else
+						{
+							e = q;
+							q = q->NextZ;
+							--qSize;
+						}
+
+						if (tail)
+						{
+							tail->NextZ = e;
+						}
+						else
+						{
+							list = e;
+						}
+						e->PrevZ = tail;
+						tail = e;
+					}
+					p = q;
+				}
+				tail->NextZ = nullptr;
+				inSize *= 2;
+			} while (mergeCount > 1);
+		}
+
+		void IndexCurve(EarNode* start)
+		{
+			EarNode* p = start;
+			do
+			{
+				p->Z = ZOrder(p->X, p->Y);
+				p->PrevZ = p->Prev;
+				p->NextZ = p->Next;
+				p = p->Next;
+			} while (p != start);
+
+			p->PrevZ->NextZ = nullptr;
+			p->PrevZ = nullptr;
+			SortByZ(p);
+		}
+
+		static bool BlocksEar(const EarNode* p, const EarNode* a, const EarNode* b, const EarNode* c, double x0, double y0, double x1, double y1)
+		{
+			return p != a && p != c && p->X >= x0 && p->X <= x1 && p->Y >= y0 && p->Y <= y1 &&
+				PointInTriangle(a->X, a->Y, b->X, b->Y, c->X, c->Y, p->X, p->Y) && Area(p->Prev, p, p->Next) >= 0.0;
+		}
+
+		static bool IsEar(const EarNode* ear)
+		{
+			const EarNode* a = ear->Prev;
+			const EarNode* c = ear->Next;
+			if (Area(a, ear, c) >= 0.0)
+			{
+				return false;
+			}
+
+			double x0 = std::min({ a->X, ear->X, c->X }), y0 = std::min({ a->Y, ear->Y, c->Y });
+			double x1 = std::max({ a->X, ear->X, c->X }), y1 = std::max({ a->Y, ear->Y, c->Y });
+			for (const EarNode* p = c->Next; p != a; p = p->Next)
+			{
+				if (BlocksEar(p, a, ear, c, x0, y0, x1, y1))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool IsEarHashed(const EarNode* ear) const
+		{
+			const EarNode* a = ear->Prev;
+			const EarNode* c = ear->Next;
+			if (Area(a, ear, c) >= 0.0)
+			{
+				return false;
+			}
+
+			double x0 = std::min({ a->X, ear->X, c->X }), y0 = std::min({ a->Y, ear->Y, c->Y });
+			double x1 = std::max({ a->X, ear->X, c->X }), y1 = std::max({ a->Y, ear->Y, c->Y });
+			uint32_t minZ = ZOrder(x0, y0);
+			uint32_t maxZ = ZOrder(x1, y1);
+
+			// Both directions from the ear at once, then whichever is left
+			const EarNode* p = ear->PrevZ;
+			const EarNode* n = ear->NextZ;
+			while (p && p->Z >= minZ && n && n->Z <= maxZ)
+			{
+				if (BlocksEar(p, a, ear, c, x0, y0, x1, y1) || BlocksEar(n, a, ear, c, x0, y0, x1, y1))
+				{
+					return false;
+				}
+				p = p->PrevZ;
+				n = n->NextZ;
+			}
+			for (; p && p->Z >= minZ; p = p->PrevZ)
+			{
+				if (BlocksEar(p, a, ear, c, x0, y0, x1, y1))
+				{
+					return false;
+				}
+			}
+			for (; n && n->Z <= maxZ; n = n->NextZ)
+			{
+				if (BlocksEar(n, a, ear, c, x0, y0, x1, y1))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Pass 0 clips ears; when none is left, pass 1 filters degenerate
+		// vertices, pass 2 cuts off self-intersections and pass 3 splits the
+		// polygon along a valid diagonal
+		void ClipEars(EarNode* ear, int pass)
+		{
+			if (!ear || m_Overflow)
+			{
+				return;
+			}
+			if (pass == 0 && m_InverseSize > 0.0)
+			{
+				IndexCurve(ear);
+			}
+
+			EarNode* stop = ear;
+			while (ear->Prev != ear->Next)
+			{
+				EarNode* prev = ear->Prev;
+				EarNode* next = ear->Next;
+
+				if (m_InverseSize > 0.0 ? IsEarHashed(ear) : IsEar(ear))
+				{
+					Emit(prev, ear, next);
+					RemoveNode(ear);
+					// Skipping the next vertex avoids a fan of slivers
+					ear = next->Next;
+					stop = next->Next;
+					continue;
+				}
+
+				ear = next;
+				if (ear == stop)
+				{
+					if (pass == 0)
+					{
+						ClipEars(FilterPoints(ear), 1);
+					}
+					else if (pass == 1)
+					{
+						ClipEars(CureLocalIntersections(FilterPoints(ear)), 2);
+					}
+					else
+					{
+						Split(ear);
+					}
+					break;
+				}
+			}
+		}
+
+		EarNode* CureLocalIntersections(EarNode* start)
+		{
+			EarNode* p = start;
+			do
+			{
+				EarNode* a = p->Prev;
+				EarNode* b = p->Next->Next;
+				if (!Equals(a, b) && Intersects(a, p, p->Next, b) && LocallyInside(a, b) && LocallyInside(b, a))
+				{
+					Emit(a, p, b);
+					RemoveNode(p);
+					RemoveNode(p->Next);
+					p = start = b;
+				}
+				p = p->Next;
+			} while (p != start);
+			return FilterPoints(p);
+		}
+
+		// Links a to b with two new nodes, making two polygons; returns the second
+		EarNode* SplitPolygon(EarNode* a, EarNode* b)
+		{
+			EarNode* a2 = NewNode(a->Index, a->X, a->Y);
+			EarNode* b2 = NewNode(b->Index, b->X, b->Y);
+			if (!a2 || !b2)
+			{
+				return nullptr;
+			}
+
+			EarNode* an = a->Next;
+			EarNode* bp = b->Prev;
+			a->Next = b;
+			b->Prev = a;
+			a2->Next = an;
+			an->Prev = a2;
+			b2->Next = a2;
+			a2->Prev = b2;
+			bp->Next = b2;
+			b2->Prev = bp;
+			return b2;
+		}
+
+		void Split(EarNode* start)
+		{
+			EarNode* a = start;
+			do
+			{
+				for (EarNode* b = a->Next->Next; b != a->Prev; b = b->Next)
+				{
+					if (a->Index != b->Index && IsValidDiagonal(a, b))
+					{
+						EarNode* c = SplitPolygon(a, b);
+						if (!c)
+						{
+							return;
+						}
+						a = FilterPoints(a, a->Next);
+						c = FilterPoints(c, c->Next);
+						ClipEars(a, 0);
+						ClipEars(c, 0);
+						return;
+					}
+				}
+				a = a->Next;
+			} while (a != start);
+		}
+
+		EarNode* m_Nodes;
+		size_t m_NodeCount;
+		size_t m_NodeCapacity;
+		uint32_t* m_Out;
+		size_t m_TriangleCount;
+		size_t m_TriangleCapacity;
+		double m_MinX;
+		double m_MinY;
+		// Maps the bounds onto 15-bit z-order coordinates; 0 disables hashing
+		double m_InverseSize;
+		bool m_Overflow;
+	};
+
+	// Splits add two nodes each and there are fewer splits than vertices
+	static size_t EarNodeCapacity(size_t count)
+	{
+		return 3 * count;
+	}
+
+	size_t Geometry2D::GetTriangulateScratchSize(size_t count)
+	{
+		ScratchLayout layout;
+		layout.Take<EarNode>(EarNodeCapacity(count));
+		return layout.GetSize();
+	}
+
+	size_t Geometry2D::Triangulate(const Vec2* polygon, size_t count, uint32_t* outIndices, void* scratch)
+	{
+		if (count < 3)
+		{
+			return 0;
+		}
+
+		ScratchLayout layout(scratch);
+		EarNode* nodes = layout.Take<EarNode>(EarNodeCapacity(count));
+		EarClipper clipper(nodes, EarNodeCapacity(count), outIndices, count - 2);
+		return clipper.Run(polygon, count);
+	}
+
+	void Geometry2D::Triangulate(const Vec2* polygon, size_t count, std::pmr::vector<uint32_t>& outIndices)
+	{
+		if (count < 3)
+		{
+			outIndices.clear();
+			return;
+		}
+
+		std::pmr::vector<uint64_t> scratch = AllocateScratch(GetTriangulateScratchSize(count));
+		outIndices.resize(3 * (count - 2));
+		outIndices.resize(3 * Triangulate(polygon, count, outIndices.data(), scratch.data()));
+	}
+
+	//----------Delaunay Implementation----------
+
+	// Triangles are counter-clockwise; Adjacent[i] is the triangle across
+	// the edge opposite V[i], and bit i of the edge flags marks that edge as
+	// a constraint. Three extra vertices past the input form a super
+	// triangle enclosing everything, removed from the output.
+	struct DelaunayTriangle
+	{
+		uint32_t V[3];
+		uint32_t Adjacent[3];
+	};
+
+	struct DelaunayEdge
+	{
+		uint32_t A, B;
+	};
+
+	struct MortonEntry
+	{
+		uint32_t Key;
+		uint32_t Index;
+
+		bool operator<(const MortonEntry& other) const { return Key < other.Key || (Key == other.Key && Index < other.Index); }
+	};
+
+	class DelaunayBuilder
+	{
+	public:
+		// The super triangle spans this many times the input's size around its centre
+		static constexpr double SuperScale = 8.0;
+		// Points in the first insertion round, where a walk is short anyway
+		static constexpr uint32_t FirstRoundSize = 64;
+		// Flip passes per constraint before it is abandoned as degenerate
+		static constexpr size_t MaxFlipPasses = 64;
+
+		static void Layout(ScratchLayout& layout, size_t pointCount, DelaunayBuilder* builder)
+		{
+			size_t vertexCount = pointCount + 3;
+			size_t triangleCapacity = 2 * vertexCount - 5;
+			size_t edgeCapacity = 3 * vertexCount;
+
+			double* x = layout.Take<double>(vertexCount);
+			double* y = layout.Take<double>(vertexCount);
+			DelaunayTriangle* triangles = layout.Take<DelaunayTriangle>(triangleCapacity);
+			uint8_t* flags = layout.Take<uint8_t>(triangleCapacity);
+			uint32_t* vertexTriangle = layout.Take<uint32_t>(vertexCount);
+			uint32_t* remap = layout.Take<uint32_t>(pointCount);
+			MortonEntry* order = layout.Take<MortonEntry>(pointCount);
+			uint32_t* hull = layout.Take<uint32_t>(pointCount + 1);
+			uint32_t* stack = layout.Take<uint32_t>(triangleCapacity);
+			uint32_t* nextStack = layout.Take<uint32_t>(3 * triangleCapacity);
+			int32_t* depth = layout.Take<int32_t>(triangleCapacity);
+			DelaunayEdge* queue = layout.Take<DelaunayEdge>(edgeCapacity);
+			DelaunayEdge* newEdges = layout.Take<DelaunayEdge>(edgeCapacity);
+
+			if (builder)
+			{
+				*builder = DelaunayBuilder();
+				builder->m_PointCount = static_cast<uint32_t>(pointCount);
+				builder->m_X = x;
+				builder->m_Y = y;
+				builder->m_Triangles = triangles;
+				builder->m_Flags = flags;
+				builder->m_TriangleCapacity = triangleCapacity;
+				builder->m_VertexTriangle = vertexTriangle;
+				builder->m_Remap = remap;
+				builder->m_Order = order;
+				builder->m_Hull = hull;
+				builder->m_Stack = stack;
+				builder->m_NextStack = nextStack;
+				builder->m_Depth = depth;
+				builder->m_Queue = queue;
+				builder->m_NewEdges = newEdges;
+				builder->m_EdgeCapacity = edgeCapacity;
+			}
+		}
+
+		bool Build(const Vec2* points)
+		{
+			double minX = points[0].x, minY = points[0].y;
+			double maxX = minX, maxY = minY;
+			for (uint32_t i = 0; i < m_PointCount; ++i)
+			{
+				m_X[i] = points[i].x;
+				m_Y[i] = points[i].y;
+				minX = std::min(minX, m_X[i]);
+				minY = std::min(minY, m_Y[i]);
+				maxX = std::max(maxX, m_X[i]);
+				maxY = std::max(maxY, m_Y[i]);
+			}
+
+			double size = std::max(maxX - minX, maxY - minY);
+			if (!(size > 0.0) || !std::isfinite(size))
+			{
+				return false;
+			}
+
+			double centerX = (minX + maxX) * 0.5;
+			double centerY = (minY + maxY) * 0.5;
+			uint32_t a = m_PointCount, b = m_PointCount + 1, c = m_PointCount + 2;
+			m_X[a] = centerX - SuperScale * size;
+			m_Y[a] = centerY - SuperScale * size;
+			m_X[b] = centerX + SuperScale * size;
+			m_Y[b] = centerY - SuperScale * size;
+			m_X[c] = centerX;
+			m_Y[c] = centerY + SuperScale * size;
+			m_TriangleCount = 0;
+			uint32_t first = NewTriangle();
+			SetTriangle(first, a, b, c, NoIndex, NoIndex, NoIndex, 0);
+
+			// Biased randomised insertion order: a shuffle split into rounds
+			// of doubling size, each sorted along a z-order curve. The shuffle
+			// keeps near-cocircular input (rings, arcs) from flipping whole
+			// regions at every insertion; the curve keeps each walk short.
+			double scale = 65535.0 / size;
+			for (uint32_t i = 0; i < m_PointCount; ++i)
+			{
+				uint32_t qx = static_cast<uint32_t>((m_X[i] - minX) * scale);
+				uint32_t qy = static_cast<uint32_t>((m_Y[i] - minY) * scale);
+				m_Order[i] = { SpreadBits(qx) | (SpreadBits(qy) << 1), i };
+				m_Remap[i] = i;
+			}
+			for (uint32_t i = m_PointCount - 1; i > 0; --i)
+			{
+				std::swap(m_Order[i], m_Order[NextRandom() % (i + 1)]);
+			}
+			for (uint32_t end = m_PointCount; end > 0;)
+			{
+				uint32_t begin = end > FirstRoundSize ? end / 2 : 0;
+				std::sort(m_Order + begin, m_Order + end);
+				end = begin;
+			}
+
+			uint32_t last = first;
+			for (uint32_t i = 0; i < m_PointCount; ++i)
+			{
+				uint32_t point = m_Order[i].Index;
+				uint32_t triangle = Locate(point, last);
+				if (triangle == NoIndex)
+				{
+					Logger::Error("Geometry2D::TriangulateDelaunay: point location failed (non-finite input?)");
+					return false;
+				}
+				last = Insert(point, triangle);
+			}
+			return true;
+		}
+
+		bool InsertConstraint(uint32_t a, uint32_t b)
+		{
+			a = m_Remap[a];
+			b = m_Remap[b];
+
+			while (a != b)
+			{
+				uint32_t end = NoIndex;
+				if (!CollectCrossings(a, b, end))
+				{
+					return false;
+				}
+				if (!FlipIntoPlace(a, end))
+				{
+					Logger::Error("Geometry2D::TriangulateDelaunay: could not recover constraint " + std::to_string(a) + "-" + std::to_string(end));
+					return false;
+				}
+				a = end;
+			}
+			return true;
+		}
+
+		// Constrains the convex hull, so a super vertex cannot have pulled any hull edge inwards
+		void ConstrainHull()
+		{
+			uint32_t* sorted = reinterpret_cast<uint32_t*>(m_Order);
+			uint32_t count = 0;
+			for (uint32_t i = 0; i < m_PointCount; ++i)
+			{
+				if (m_Remap[i] == i)
+				{
+					sorted[count++] = i;
+				}
+			}
+			std::sort(sorted, sorted + count, [&](uint32_t p, uint32_t q)
+			{
+				return m_X[p] < m_X[q] || (m_X[p] == m_X[q] && m_Y[p] < m_Y[q]);
+			});
+
+			uint32_t size = 0;
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				while (size >= 2 && OrientVertices(m_Hull[size - 2], m_Hull[size - 1], sorted[i]) <= 0.0)
+				{
+					--size;
+				}
+				m_Hull[size++] = sorted[i];
+			}
+			for (uint32_t i = count - 1, lowerSize = size + 1; i-- > 0;)
+			{
+				while (size >= lowerSize && OrientVertices(m_Hull[size - 2], m_Hull[size - 1], sorted[i]) <= 0.0)
+				{
+					--size;
+				}
+				m_Hull[size++] = sorted[i];
+			}
+
+			for (uint32_t i = 0; i + 1 < size; ++i)
+			{
+				InsertConstraint(m_Hull[i], m_Hull[i + 1]);
+			}
+		}
+
+		size_t Output(DelaunayFill fill, uint32_t* outIndices)
+		{
+			if (fill == DelaunayFill::EvenOdd)
+			{
+				FloodDepths();
+			}
+
+			size_t count = 0;
+			for (uint32_t t = 0; t < m_TriangleCount; ++t)
+			{
+				const DelaunayTriangle& triangle = m_Triangles[t];
+				if (IsSuper(triangle.V[0]) || IsSuper(triangle.V[1]) || IsSuper(triangle.V[2]))
+				{
+					continue;
+				}
+				if (fill == DelaunayFill::EvenOdd && (m_Depth[t] & 1) == 0)
+				{
+					continue;
+				}
+				outIndices[3 * count] = triangle.V[0];
+				outIndices[3 * count + 1] = triangle.V[1];
+				outIndices[3 * count + 2] = triangle.V[2];
+				++count;
+			}
+			return count;
+		}
+
+	private:
+		static uint32_t Next(uint32_t i) { return i == 2 ? 0 : i + 1; }
+		static uint32_t Prev(uint32_t i) { return i == 0 ? 2 : i - 1; }
+
+		bool IsSuper(uint32_t v) const { return v >= m_PointCount; }
+
+		double OrientVertices(uint32_t a, uint32_t b, uint32_t c) const
+		{
+			return Orient(m_X[a], m_Y[a], m_X[b], m_Y[b], m_X[c], m_Y[c]);
+		}
+
+		// Positive when d is inside the circumcircle of counter-clockwise abc
+		double InCircle(uint32_t a, uint32_t b, uint32_t c, uint32_t d) const
+		{
+			double adx = m_X[a] - m_X[d], ady = m_Y[a] - m_Y[d];
+			double bdx = m_X[b] - m_X[d], bdy = m_Y[b] - m_Y[d];
+			double cdx = m_X[c] - m_X[d], cdy = m_Y[c] - m_Y[d];
+			double aLift = adx * adx + ady * ady;
+			double bLift = bdx * bdx + bdy * bdy;
+			double cLift = cdx * cdx + cdy * cdy;
+			return adx * (bdy * cLift - bLift * cdy) - ady * (bdx * cLift - bLift * cdx) + aLift * (bdx * cdy - bdy * cdx);
+		}
+
+		uint32_t NextRandom()
+		{
+			m_RandomState = m_RandomState * 1103515245u + 12345u;
+			return m_RandomState >> 8;
+		}
+
+		uint32_t NewTriangle()
+		{
+			return m_TriangleCount++;
+		}
+
+		void SetTriangle(uint32_t t, uint32_t a, uint32_t b, uint32_t c, uint32_t acrossA, uint32_t acrossB, uint32_t acrossC, uint8_t flags)
+		{
+			m_Triangles[t] = { { a, b, c }, { acrossA, acrossB, acrossC } };
+			m_Flags[t] = flags;
+			m_VertexTriangle[a] = t;
+			m_VertexTriangle[b] = t;
+			m_VertexTriangle[c] = t;
+		}
+
+		void ReplaceAdjacent(uint32_t t, uint32_t from, uint32_t to)
+		{
+			if (t == NoIndex)
+			{
+				return;
+			}
+			uint32_t* adjacent = m_Triangles[t].Adjacent;
+			for (int i = 0; i < 3; ++i)
+			{
+				if (adjacent[i] == from)
+				{
+					adjacent[i] = to;
+					return;
+				}
+			}
+		}
+
+		uint32_t IndexOf(uint32_t t, uint32_t v) const
+		{
+			const uint32_t* vertices = m_Triangles[t].V;
+			return vertices[0] == v ? 0 : vertices[1] == v ? 1 : 2;
+		}
+
+		uint32_t AdjacentIndex(uint32_t t, uint32_t neighbour) const
+		{
+			const uint32_t* adjacent = m_Triangles[t].Adjacent;
+			return adjacent[0] == neighbour ? 0 : adjacent[1] == neighbour ? 1 : 2;
+		}
+
+		bool IsConstrained(uint32_t t, uint32_t edge) const
+		{
+			return (m_Flags[t] >> edge) & 1;
+		}
+
+		uint8_t EdgeFlag(uint32_t t, uint32_t edge, uint32_t to) const
+		{
+			return static_cast<uint8_t>(((m_Flags[t] >> edge) & 1) << to);
+		}
+
+		// Renumbers t so the old corner k becomes corner 0
+		void Rotate(uint32_t t, uint32_t k)
+		{
+			if (k == 0)
+			{
+				return;
+			}
+			DelaunayTriangle old = m_Triangles[t];
+			uint8_t oldFlags = m_Flags[t];
+			uint8_t flags = 0;
+			for (uint32_t i = 0; i < 3; ++i)
+			{
+				uint32_t from = (i + k) % 3;
+				m_Triangles[t].V[i] = old.V[from];
+				m_Triangles[t].Adjacent[i] = old.Adjacent[from];
+				flags |= static_cast<uint8_t>(((oldFlags >> from) & 1) << i);
+			}
+			m_Flags[t] = flags;
+		}
+
+		// Visibility walk, starting each step from a varying edge so it cannot cycle
+		uint32_t Locate(uint32_t point, uint32_t t)
+		{
+			double px = m_X[point], py = m_Y[point];
+			size_t maxSteps = 4 * static_cast<size_t>(m_TriangleCount) + 64;
+			for (size_t step = 0; step < maxSteps; ++step)
+			{
+				const DelaunayTriangle& triangle = m_Triangles[t];
+				uint32_t start = NextRandom() % 3;
+				uint32_t next = NoIndex;
+				for (uint32_t k = 0; k < 3; ++k)
+				{
+					uint32_t edge = (start + k) % 3;
+					uint32_t from = triangle.V[Next(edge)], to = triangle.V[Prev(edge)];
+					if (Orient(m_X[from], m_Y[from], m_X[to], m_Y[to], px, py) < 0.0)
+					{
+						next = triangle.Adjacent[edge];
+						break;
+					}
+				}
+				if (next == NoIndex)
+				{
+					return t;
+				}
+				t = next;
+			}
+			return NoIndex;
+		}
+
+		// Returns a triangle touching the point (or the vertex it duplicates)
+		uint32_t Insert(uint32_t point, uint32_t t)
+		{
+			const DelaunayTriangle& triangle = m_Triangles[t];
+			double px = m_X[point], py = m_Y[point];
+			uint32_t zeroEdge = NoIndex;
+			int zeroCount = 0;
+			for (uint32_t i = 0; i < 3; ++i)
+			{
+				uint32_t v = triangle.V[i];
+				if (m_X[v] == px && m_Y[v] == py)
+				{
+					m_Remap[point] = v;
+					return t;
+				}
+				uint32_t from = triangle.V[Next(i)], to = triangle.V[Prev(i)];
+				if (Orient(m_X[from], m_Y[from], m_X[to], m_Y[to], px, py) == 0.0)
+				{
+					zeroEdge = i;
+					++zeroCount;
+				}
+			}
+
+			if (zeroCount > 1)
+			{
+				// On two edges but not equal to their vertex: rounding; take the nearest corner
+				uint32_t nearest = triangle.V[0];
+				double best = INFINITY;
+				for (uint32_t v : triangle.V)
+				{
+					double dx = m_X[v] - px, dy = m_Y[v] - py;
+					if (dx * dx + dy * dy < best)
+					{
+						best = dx * dx + dy * dy;
+						nearest = v;
+					}
+				}
+				m_Remap[point] = nearest;
+				return t;
+			}
+
+			if (zeroCount == 1)
+			{
+				SplitEdge(t, zeroEdge, point);
+			}
+			else
+			{
+				SplitTriangle(t, point);
+			}
+			Legalize();
+			return m_VertexTriangle[point];
+		}
+
+		void SplitTriangle(uint32_t t, uint32_t p)
+		{
+			DelaunayTriangle old = m_Triangles[t];
+			uint8_t flags = m_Flags[t];
+			uint32_t a = old.V[0], b = old.V[1], c = old.V[2];
+			uint32_t t1 = NewTriangle();
+			uint32_t t2 = NewTriangle();
+
+			SetTriangle(t, p, b, c, old.Adjacent[0], t1, t2, EdgeFlag(t, 0, 0));
+			SetTriangle(t1, p, c, a, old.Adjacent[1], t2, t, static_cast<uint8_t>((flags >> 1) & 1));
+			SetTriangle(t2, p, a, b, old.Adjacent[2], t, t1, static_cast<uint8_t>((flags >> 2) & 1));
+			ReplaceAdjacent(old.Adjacent[1], t, t1);
+			ReplaceAdjacent(old.Adjacent[2], t, t2);
+
+			m_StackSize = 0;
+			m_Stack[m_StackSize++] = t;
+			m_Stack[m_StackSize++] = t1;
+			m_Stack[m_StackSize++] = t2;
+		}
+
+		void SplitEdge(uint32_t t, uint32_t edge, uint32_t p)
+		{
+			Rotate(t, edge);
+			DelaunayTriangle old = m_Triangles[t];
+			uint8_t flags = m_Flags[t];
+			uint32_t a = old.V[0], b = old.V[1], c = old.V[2];
+			uint32_t o = old.Adjacent[0];
+
+			uint32_t j = AdjacentIndex(o, t);
+			Rotate(o, j);
+			DelaunayTriangle opposite = m_Triangles[o];
+			uint8_t oppositeFlags = m_Flags[o];
+			uint32_t d = opposite.V[0];
+			// opposite is (d, c, b): across b-d is Adjacent[1], across d-c is Adjacent[2]
+			uint32_t tca = NewTriangle();
+			uint32_t odc = NewTriangle();
+
+			SetTriangle(t, p, a, b, old.Adjacent[2], o, tca, static_cast<uint8_t>((flags >> 2) & 1));
+			SetTriangle(tca, p, c, a, old.Adjacent[1], t, odc, static_cast<uint8_t>((flags >> 1) & 1));
+			SetTriangle(o, p, b, d, opposite.Adjacent[1], odc, t, static_cast<uint8_t>((oppositeFlags >> 1) & 1));
+			SetTriangle(odc, p, d, c, opposite.Adjacent[2], tca, o, static_cast<uint8_t>((oppositeFlags >> 2) & 1));
+			ReplaceAdjacent(old.Adjacent[1], t, tca);
+			ReplaceAdjacent(opposite.Adjacent[2], o, odc);
+
+			m_StackSize = 0;
+			m_Stack[m_StackSize++] = t;
+			m_Stack[m_StackSize++] = tca;
+			m_Stack[m_StackSize++] = o;
+			m_Stack[m_StackSize++] = odc;
+		}
+
+		// t = (p, b, c) and o across bc with o's corner j opposite. Afterwards
+		// t = (p, b, d) and o = (p, d, c), both with p still at corner 0.
+		void Flip(uint32_t t, uint32_t o, uint32_t j)
+		{
+			Rotate(o, j);
+			DelaunayTriangle old = m_Triangles[t];
+			DelaunayTriangle opposite = m_Triangles[o];
+			uint8_t flags = m_Flags[t];
+			uint8_t oppositeFlags = m_Flags[o];
+			uint32_t p = old.V[0], b = old.V[1], c = old.V[2], d = opposite.V[0];
+
+			SetTriangle(t, p, b, d, opposite.Adjacent[1], o, old.Adjacent[2],
+				static_cast<uint8_t>(((oppositeFlags >> 1) & 1) | (((flags >> 2) & 1) << 2)));
+			SetTriangle(o, p, d, c, opposite.Adjacent[2], old.Adjacent[1], t,
+				static_cast<uint8_t>(((oppositeFlags >> 2) & 1) | (((flags >> 1) & 1) << 1)));
+			ReplaceAdjacent(opposite.Adjacent[1], o, t);
+			ReplaceAdjacent(old.Adjacent[1], t, o);
+		}
+
+		// Lawson flips around the newly inserted point, which is corner 0 of every stacked triangle
+		void Legalize()
+		{
+			while (m_StackSize > 0)
+			{
+				uint32_t t = m_Stack[--m_StackSize];
+				uint32_t o = m_Triangles[t].Adjacent[0];
+				if (o == NoIndex || IsConstrained(t, 0))
+				{
+					continue;
+				}
+				uint32_t j = AdjacentIndex(o, t);
+				const DelaunayTriangle& triangle = m_Triangles[t];
+				if (InCircle(triangle.V[0], triangle.V[1], triangle.V[2], m_Triangles[o].V[j]) > 0.0 && m_StackSize + 2 <= m_TriangleCapacity)
+				{
+					Flip(t, o, j);
+					m_Stack[m_StackSize++] = t;
+					m_Stack[m_StackSize++] = o;
+				}
+			}
+		}
+
+		// A triangle with edge ab, rotated so the edge is opposite corner 0
+		uint32_t FindEdge(uint32_t a, uint32_t b)
+		{
+			// Only input vertices have a closed fan of triangles around them
+			if (IsSuper(a))
+			{
+				std::swap(a, b);
+			}
+			uint32_t start = m_VertexTriangle[a];
+			uint32_t t = start;
+			do
+			{
+				uint32_t i = IndexOf(t, a);
+				const uint32_t* v = m_Triangles[t].V;
+				if (v[Next(i)] == b)
+				{
+					Rotate(t, Prev(i));
+					return t;
+				}
+				if (v[Prev(i)] == b)
+				{
+					Rotate(t, Next(i));
+					return t;
+				}
+				t = m_Triangles[t].Adjacent[Prev(i)];
+			} while (t != start && t != NoIndex);
+			return NoIndex;
+		}
+
+		void MarkConstrained(uint32_t a, uint32_t b)
+		{
+			uint32_t t = FindEdge(a, b);
+			if (t == NoIndex)
+			{
+				return;
+			}
+			m_Flags[t] |= 1;
+			uint32_t o = m_Triangles[t].Adjacent[0];
+			if (o != NoIndex)
+			{
+				m_Flags[o] |= static_cast<uint8_t>(1u << AdjacentIndex(o, t));
+			}
+		}
+
+		bool PushCrossing(uint32_t t, uint32_t edge, uint32_t u, uint32_t w)
+		{
+			if (IsConstrained(t, edge))
+			{
+				Logger::Error("Geometry2D::TriangulateDelaunay: constraint edges cross; skipping the later one");
+				return false;
+			}
+			if (m_QueueSize == m_EdgeCapacity)
+			{
+				return false;
+			}
+			m_Queue[(m_QueueHead + m_QueueSize++) % m_EdgeCapacity] = { u, w };
+			return true;
+		}
+
+		// Queues the edges crossed by a-b up to its first vertex, which goes to end
+		bool CollectCrossings(uint32_t a, uint32_t b, uint32_t& end)
+		{
+			m_QueueHead = 0;
+			m_QueueSize = 0;
+
+			if (FindEdge(a, b) != NoIndex)
+			{
+				end = b;
+				return true;
+			}
+
+			double ax = m_X[a], ay = m_Y[a], bx = m_X[b], by = m_Y[b];
+			uint32_t start = m_VertexTriangle[a];
+			uint32_t t = start;
+			do
+			{
+				uint32_t i = IndexOf(t, a);
+				uint32_t u = m_Triangles[t].V[Next(i)];
+				uint32_t w = m_Triangles[t].V[Prev(i)];
+				double orientU = Orient(ax, ay, bx, by, m_X[u], m_Y[u]);
+				double orientW = Orient(ax, ay, bx, by, m_X[w], m_Y[w]);
+
+				// A vertex on the segment ends this piece of it
+				for (uint32_t v : { u, w })
+				{
+					if (!IsSuper(v) && (v == u ? orientU : orientW) == 0.0 && (m_X[v] - ax) * (bx - ax) + (m_Y[v] - ay) * (by - ay) > 0.0)
+					{
+						end = v;
+						return true;
+					}
+				}
+
+				if (orientU < 0.0 && orientW > 0.0)
+				{
+					return WalkCrossings(a, b, t, i, end);
+				}
+				t = m_Triangles[t].Adjacent[Prev(i)];
+			} while (t != start && t != NoIndex);
+
+			Logger::Error("Geometry2D::TriangulateDelaunay: no triangle around a constraint's start");
+			return false;
+		}
+
+		bool WalkCrossings(uint32_t a, uint32_t b, uint32_t t, uint32_t corner, uint32_t& end)
+		{
+			double ax = m_X[a], ay = m_Y[a], bx = m_X[b], by = m_Y[b];
+			uint32_t u = m_Triangles[t].V[Next(corner)];
+			uint32_t w = m_Triangles[t].V[Prev(corner)];
+			uint32_t edge = corner;
+
+			for (;;)
+			{
+				if (!PushCrossing(t, edge, u, w))
+				{
+					return false;
+				}
+				uint32_t o = m_Triangles[t].Adjacent[edge];
+				uint32_t j = AdjacentIndex(o, t);
+				uint32_t x = m_Triangles[o].V[j];
+				if (x == b)
+				{
+					end = b;
+					return true;
+				}
+
+				double orientX = Orient(ax, ay, bx, by, m_X[x], m_Y[x]);
+				if (orientX == 0.0)
+				{
+					end = x;
+					return true;
+				}
+
+				// Crossed edges keep u on the right of a-b and w on the left
+				if (orientX < 0.0)
+				{
+					u = x;
+				}
+				else
+				{
+					w = x;
+				}
+				// The next edge is the one of o not containing the vertex left behind
+				edge = 3 - IndexOf(o, u) - IndexOf(o, w);
+				t = o;
+			}
+		}
+
+		bool Crosses(uint32_t a, uint32_t b, uint32_t p, uint32_t q) const
+		{
+			double orientP = OrientVertices(a, b, p);
+			double orientQ = OrientVertices(a, b, q);
+			return (orientP < 0.0 && orientQ > 0.0) || (orientP > 0.0 && orientQ < 0.0);
+		}
+
+		bool SameEdge(const DelaunayEdge& edge, uint32_t a, uint32_t b) const
+		{
+			return (edge.A == a && edge.B == b) || (edge.A == b && edge.B == a);
+		}
+
+		// Sloan's method: flip crossed edges until none is left, then restore
+		// the Delaunay property among the edges that were created
+		bool FlipIntoPlace(uint32_t a, uint32_t b)
+		{
+			m_NewEdgeCount = 0;
+			size_t budget = MaxFlipPasses * (m_QueueSize + 1);
+			while (m_QueueSize > 0)
+			{
+				if (budget-- == 0)
+				{
+					return false;
+				}
+
+				DelaunayEdge edge = m_Queue[m_QueueHead];
+				m_QueueHead = (m_QueueHead + 1) % m_EdgeCapacity;
+				--m_QueueSize;
+
+				uint32_t t = FindEdge(edge.A, edge.B);
+				uint32_t o = m_Triangles[t].Adjacent[0];
+				uint32_t j = AdjacentIndex(o, t);
+				uint32_t x = m_Triangles[t].V[0];
+				uint32_t y = m_Triangles[o].V[j];
+
+				if (!Crosses(x, y, edge.A, edge.B))
+				{
+					// Not a convex quad yet; retry after its neighbours have moved
+					m_Queue[(m_QueueHead + m_QueueSize++) % m_EdgeCapacity] = edge;
+					continue;
+				}
+
+				Flip(t, o, j);
+				if (Crosses(a, b, x, y))
+				{
+					m_Queue[(m_QueueHead + m_QueueSize++) % m_EdgeCapacity] = { x, y };
+				}
+				else if (!SameEdge({ x, y }, a, b))
+				{
+					m_NewEdges[m_NewEdgeCount++] = { x, y };
+				}
+			}
+
+			MarkConstrained(a, b);
+
+			for (size_t pass = 0; pass < MaxFlipPasses; ++pass)
+			{
+				bool flipped = false;
+				for (size_t i = 0; i < m_NewEdgeCount; ++i)
+				{
+					DelaunayEdge& edge = m_NewEdges[i];
+					uint32_t t = FindEdge(edge.A, edge.B);
+					if (t == NoIndex || IsConstrained(t, 0))
+					{
+						continue;
+					}
+					uint32_t o = m_Triangles[t].Adjacent[0];
+					uint32_t j = AdjacentIndex(o, t);
+					const DelaunayTriangle& triangle = m_Triangles[t];
+					uint32_t y = m_Triangles[o].V[j];
+					if (InCircle(triangle.V[0], triangle.V[1], triangle.V[2], y) > 0.0 && Crosses(triangle.V[0], y, edge.A, edge.B))
+					{
+						uint32_t x = triangle.V[0];
+						Flip(t, o, j);
+						edge = { x, y };
+						flipped = true;
+					}
+				}
+				if (!flipped)
+				{
+					break;
+				}
+			}
+			return true;
+		}
+
+		// Even-odd depth: regions one constraint apart differ by one
+		void FloodDepths()
+		{
+			std::fill(m_Depth, m_Depth + m_TriangleCount, -1);
+			size_t nextSize = 0;
+			uint32_t start = m_VertexTriangle[m_PointCount];
+			m_NextStack[nextSize++] = start;
+
+			for (int32_t depth = 0; nextSize > 0; ++depth)
+			{
+				m_StackSize = 0;
+				for (size_t i = 0; i < nextSize; ++i)
+				{
+					uint32_t t = m_NextStack[i];
+					if (m_Depth[t] < 0)
+					{
+						m_Depth[t] = depth;
+						m_Stack[m_StackSize++] = t;
+					}
+				}
+				nextSize = 0;
+
+				while (m_StackSize > 0)
+				{
+					uint32_t t = m_Stack[--m_StackSize];
+					for (uint32_t edge = 0; edge < 3; ++edge)
+					{
+						uint32_t neighbour = m_Triangles[t].Adjacent[edge];
+						if (neighbour == NoIndex || m_Depth[neighbour] >= 0)
+						{
+							continue;
+						}
+						if (IsConstrained(t, edge))
+						{
+							m_NextStack[nextSize++] = neighbour;
+						}
+						else
+						{
+							m_Depth[neighbour] = depth;
+							m_Stack[m_StackSize++] = neighbour;
+						}
+					}
+				}
+			}
+		}
+
+		uint32_t m_PointCount = 0;
+		double* m_X = nullptr;
+		double* m_Y = nullptr;
+		DelaunayTriangle* m_Triangles = nullptr;
+		uint8_t* m_Flags = nullptr;
+		uint32_t m_TriangleCount = 0;
+		size_t m_TriangleCapacity = 0;
+		uint32_t* m_VertexTriangle = nullptr;
+		// Each input point's vertex in the triangulation: itself, or the point it duplicates
+		uint32_t* m_Remap = nullptr;
+		MortonEntry* m_Order = nullptr;
+		uint32_t* m_Hull = nullptr;
+		uint32_t* m_Stack = nullptr;
+		size_t m_StackSize = 0;
+		uint32_t* m_NextStack = nullptr;
+		int32_t* m_Depth = nullptr;
+		DelaunayEdge* m_Queue = nullptr;
+		size_t m_QueueHead = 0;
+		size_t m_QueueSize = 0;
+		DelaunayEdge* m_NewEdges = nullptr;
+		size_t m_NewEdgeCount = 0;
+		size_t m_EdgeCapacity = 0;
+		// Fixed seed, so the same input always gives the same triangles
+		uint32_t m_RandomState = 1;
+	};
+
+	size_t Geometry2D::GetDelaunayScratchSize(size_t pointCount, size_t edgeCount)
+	{
+		(void)edgeCount;
+		ScratchLayout layout;
+		DelaunayBuilder::Layout(layout, pointCount, nullptr);
+		return layout.GetSize();
+	}
+
+	size_t Geometry2D::TriangulateDelaunay(const Vec2* points, size_t pointCount, const uint32_t* edges, size_t edgeCount, DelaunayFill fill, uint32_t* outIndices, void* scratch)
+	{
+		if (pointCount < 3)
+		{
+			return 0;
+		}
+		if (pointCount > (NoIndex - 3) / 2)
+		{
+			Logger::Error("Geometry2D::TriangulateDelaunay: too many points (" + std::to_string(pointCount) + ")");
+			return 0;
+		}
+		for (size_t i = 0; i < 2 * edgeCount; ++i)
+		{
+			if (edges[i] >= pointCount)
+			{
+				Logger::Error("Geometry2D::TriangulateDelaunay: edge index " + std::to_string(edges[i]) + " out of range");
+				return 0;
+			}
+		}
+
+		ScratchLayout layout(scratch);
+		DelaunayBuilder builder;
+		DelaunayBuilder::Layout(layout, pointCount, &builder);
+		if (!builder.Build(points))
+		{
+			return 0;
+		}
+
+		for (size_t i = 0; i < edgeCount; ++i)
+		{
+			builder.InsertConstraint(edges[2 * i], edges[2 * i + 1]);
+		}
+		if (fill == DelaunayFill::All)
+		{
+			builder.ConstrainHull();
+		}
+		return builder.Output(fill, outIndices);
+	}
+
+	void Geometry2D::TriangulateDelaunay(const Vec2* points, size_t pointCount, const uint32_t* edges, size_t edgeCount, DelaunayFill fill, std::pmr::vector<uint32_t>& outIndices)
+	{
+		if (pointCount < 3)
+		{
+			outIndices.clear();
+			return;
+		}
+
+		std::pmr::vector<uint64_t> scratch = AllocateScratch(GetDelaunayScratchSize(pointCount, edgeCount));
+		outIndices.resize(3 * GetDelaunayMaxTriangles(pointCount));
+		outIndices.resize(3 * TriangulateDelaunay(points, pointCount, edges, edgeCount, fill, outIndices.data(), scratch.data()));
+	}
+
+	//----------Clipping Implementation----------
+
+	// Appends to a fixed buffer, remembering whether anything was dropped
+	class PointWriter
+	{
+	public:
+		PointWriter(Vec2* buffer, size_t capacity) : m_Buffer(buffer), m_Capacity(capacity), m_Size(0) {}
+
+		void Add(const Vec2& point)
+		{
+			if (m_Size < m_Capacity)
+			{
+				m_Buffer[m_Size] = point;
+			}
+			++m_Size;
+		}
+
+		size_t GetSize() const { return m_Size; }
+		bool Overflowed() const { return m_Size > m_Capacity; }
+
+	private:
+		Vec2* m_Buffer;
+		size_t m_Capacity;
+		size_t m_Size;
+	};
+
+	// One Sutherland-Hodgman stage: keeps the side of from-to that side points to
+	template<typename Writer>
+	static void ClipAgainstEdge(const Vec2* input, size_t count, const Vec2& from, const Vec2& to, double side, Writer& writer)
+	{
+		const Vec2* previous = &input[count - 1];
+		double previousDistance = Orient(from, to, *previous) * side;
+		for (size_t i = 0; i < count; ++i)
+		{
+			const Vec2& current = input[i];
+			double distance = Orient(from, to, current) * side;
+			if ((distance >= 0.0) != (previousDistance >= 0.0))
+			{
+				float t = static_cast<float>(previousDistance / (previousDistance - distance));
+				writer.Add(*previous + (current - *previous) * t);
+			}
+			if (distance >= 0.0)
+			{
+				writer.Add(current);
+			}
+			previous = &current;
+			previousDistance = distance;
+		}
+	}
+
+	size_t Geometry2D::ClipPolygon(const Vec2* subject, size_t subjectCount, const Vec2* clip, size_t clipCount, Vec2* outPolygon, Vec2* scratch, size_t capacity)
+	{
+		if (clipCount < 3)
+		{
+			Logger::Error("Geometry2D::ClipPolygon: the clip polygon needs 3 or more points");
+			return 0;
+		}
+		if (subjectCount < 3)
+		{
+			return 0;
+		}
+
+		double side = SignedArea(clip, clipCount) >= 0.0f ? 1.0 : -1.0;
+		// Stages alternate buffers; start where the last stage lands in outPolygon
+		Vec2* buffers[2] = { clipCount % 2 == 1 ? outPolygon : scratch, clipCount % 2 == 1 ? scratch : outPolygon };
+		const Vec2* input = subject;
+		size_t count = subjectCount;
+		for (size_t i = 0; i < clipCount && count > 0; ++i)
+		{
+			PointWriter writer(buffers[i % 2], capacity);
+			ClipAgainstEdge(input, count, clip[i], clip[(i + 1) % clipCount], side, writer);
+			if (writer.Overflowed())
+			{
+				Logger::Error("Geometry2D::ClipPolygon: result exceeds capacity " + std::to_string(capacity));
+				return 0;
+			}
+			input = buffers[i % 2];
+			count = writer.GetSize();
+		}
+		// Fewer than three points is an empty intersection
+		return count >= 3 ? count : 0;
+	}
+
+	// Appends to a vector
+	class VectorWriter
+	{
+	public:
+		explicit VectorWriter(std::pmr::vector<Vec2>& points) : m_Points(points) {}
+		void Add(const Vec2& point) { m_Points.push_back(point); }
+
+	private:
+		std::pmr::vector<Vec2>& m_Points;
+	};
+
+	void Geometry2D::ClipPolygon(const Vec2* subject, size_t subjectCount, const Vec2* clip, size_t clipCount, std::pmr::vector<Vec2>& outPolygon)
+	{
+		outPolygon.clear();
+		if (clipCount < 3)
+		{
+			Logger::Error("Geometry2D::ClipPolygon: the clip polygon needs 3 or more points");
+			return;
+		}
+		if (subjectCount < 3)
+		{
+			return;
+		}
+
+		double side = SignedArea(clip, clipCount) >= 0.0f ? 1.0 : -1.0;
+		std::pmr::vector<Vec2> input(subject, subject + subjectCount, GetTaggedResource(MemoryTag::Math));
+		for (size_t i = 0; i < clipCount && !input.empty(); ++i)
+		{
+			outPolygon.clear();
+			VectorWriter writer(outPolygon);
+			ClipAgainstEdge(input.data(), input.size(), clip[i], clip[(i + 1) % clipCount], side, writer);
+			input.assign(outPolygon.begin(), outPolygon.end());
+		}
+		if (outPolygon.size() < 3)
+		{
+			outPolygon.clear();
+		}
+	}
+
+	//----------Offset Implementation----------
+
+	template<typename Writer>
+	static void OffsetInto(const Vec2* polygon, size_t count, float distance, const OffsetSettings& settings, Writer& writer)
+	{
+		// Outwards is to the right of each edge when counter-clockwise
+		float outwards = Geometry2D::SignedArea(polygon, count) >= 0.0f ? distance : -distance;
+		float absDistance = fabsf(distance);
+		float cosLimit = 2.0f / (settings.MiterLimit * settings.MiterLimit) - 1.0f;
+		float tolerance = std::min(std::max(settings.ArcTolerance, absDistance * 1e-4f), absDistance);
+		float arcStep = absDistance > 0.0f ? 2.0f * acosf(1.0f - tolerance / absDistance) : 0.0f;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const Vec2& point = polygon[i];
+			// Neighbours skipping repeated points; a repeat of the previous point is dropped
+			size_t previous = (i + count - 1) % count;
+			if (polygon[previous] == point)
+			{
+				continue;
+			}
+			size_t next = (i + 1) % count;
+			while (next != i && polygon[next] == point)
+			{
+				next = (next + 1) % count;
+			}
+			if (next == i)
+			{
+				return;
+			}
+
+			Vec2 incoming = (point - polygon[previous]).Normalize();
+			Vec2 outgoing = (polygon[next] - point).Normalize();
+			Vec2 normalIn(incoming.y, -incoming.x);
+			Vec2 normalOut(outgoing.y, -outgoing.x);
+			Vec2 a = point + normalIn * outwards;
+			Vec2 b = point + normalOut * outwards;
+
+			float cosine = normalIn.Dot(normalOut);
+			float turn = incoming.Cross(outgoing);
+			// The side the edges spread apart on needs a join; the other side meets at the miter point
+			bool opening = turn * outwards > 0.0f;
+			if (cosine > 0.9999f)
+			{
+				writer.Add(a);
+				continue;
+			}
+
+			bool miterFits = cosine >= cosLimit;
+			if (!opening || settings.Join == JoinType::Miter)
+			{
+				if (miterFits)
+				{
+					writer.Add(point + (normalIn + normalOut) * (outwards / (1.0f + cosine)));
+				}
+				else
+				{
+					writer.Add(a);
+					writer.Add(b);
+				}
+				continue;
+			}
+
+			writer.Add(a);
+			if (settings.Join == JoinType::Round && arcStep > 0.0f)
+			{
+				float angle = acosf(std::max(-1.0f, std::min(1.0f, cosine)));
+				int steps = static_cast<int>(ceilf(angle / arcStep));
+				float step = (turn > 0.0f ? angle : -angle) / static_cast<float>(steps);
+				float cosStep = cosf(step), sinStep = sinf(step);
+				Vec2 offset = a - point;
+				for (int s = 1; s < steps; ++s)
+				{
+					offset = Vec2(offset.x * cosStep - offset.y * sinStep, offset.x * sinStep + offset.y * cosStep);
+					writer.Add(point + offset);
+				}
+			}
+			writer.Add(b);
+		}
+	}
+
+	size_t Geometry2D::OffsetPolygon(const Vec2* polygon, size_t count, float distance, const OffsetSettings& settings, Vec2* outPolygon, size_t capacity)
+	{
+		if (count < 3)
+		{
+			return 0;
+		}
+
+		PointWriter writer(outPolygon, capacity);
+		OffsetInto(polygon, count, distance, settings, writer);
+		if (writer.Overflowed())
+		{
+			Logger::Error("Geometry2D::OffsetPolygon: result exceeds capacity " + std::to_string(capacity));
+			return 0;
+		}
+		return writer.GetSize();
+	}
+
+	void Geometry2D::OffsetPolygon(const Vec2* polygon, size_t count, float distance, const OffsetSettings& settings, std::pmr::vector<Vec2>& outPolygon)
+	{
+		outPolygon.clear();
+		if (count < 3)
+		{
+			return;
+		}
+
+		VectorWriter writer(outPolygon);
+		OffsetInto(polygon, count, distance, settings, writer);
+	}
+}
@@ -0,0 +1,151 @@
+//Project Name: RundeeEngine
+//File Name: Mat3.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: 3x3 matrix implementation file
+
+#include "../../include/RundeeEngine/Math/Mat3.h"
+#include <cmath>
+
+namespace RundeeEngine
+{
+	Mat3 Mat3::Scale(const Vec3& scale)
+	{
+		return Mat3(Vec3(scale.x, 0.0f, 0.0f), Vec3(0.0f, scale.y, 0.0f), Vec3(0.0f, 0.0f, scale.z));
+	}
+
+	Mat3 Mat3::RotationX(float radians)
+	{
+		float cosA = cosf(radians);
+		float sinA = sinf(radians);
+		return Mat3(Vec3(1.0f, 0.0f, 0.0f), Vec3(0.0f, cosA, sinA), Vec3(0.0f, -sinA, cosA));
+	}
+
+	Mat3 Mat3::RotationY(float radians)
+	{
+		float cosA = cosf(radians);
+		float sinA = sinf(radians);
+		return Mat3(Vec3(cosA, 0.0f, -sinA), Vec3(0.0f, 1.0f, 0.0f), Vec3(sinA, 0.0f, cosA));
+	}
+
+	Mat3 Mat3::RotationZ(float radians)
+	{
+		float cosA = cosf(radians);
+		float sinA = sinf(radians);
+		return Mat3(Vec3(cosA, sinA, 0.0f), Vec3(-sinA, cosA, 0.0f), Vec3(0.0f, 0.0f, 1.0f));
+	}
+
+	Mat3 Mat3::RotationAxis(const Vec3& axis, float radians)
+	{
+		Vec3 n = axis.Normalize();
+		float cosA = cosf(radians);
+		float sinA = sinf(radians);
+		float t = 1.0f - cosA;
+
+		return Mat3(
+			Vec3(t * n.x * n.x + cosA, t * n.x * n.y + sinA * n.z, t * n.x * n.z - sinA * n.y),
+			Vec3(t * n.x * n.y - sinA * n.z, t * n.y * n.y + cosA, t * n.y * n.z + sinA * n.x),
+			Vec3(t * n.x * n.z + sinA * n.y, t * n.y * n.z - sinA * n.x, t * n.z * n.z + cosA));
+	}
+
+	float Mat3::Determinant() const
+	{
+		return Columns[0].ToVec3().Dot(Columns[1].ToVec3().Cross(Columns[2].ToVec3()));
+	}
+
+	// The rows of the inverse are the cross products of column pairs over the determinant
+	Mat3 Mat3::Inverse() const
+	{
+		#if RUNDEE_SIMD_SSE2
+		__m128 c0 = Columns[0].Load();
+		__m128 c1 = Columns[1].Load();
+		__m128 c2 = Columns[2].Load();
+
+		__m128 r0 = SimdCross3(c1, c2);
+		__m128 r1 = SimdCross3(c2, c0);
+		__m128 r2 = SimdCross3(c0, c1);
+
+		float determinant = _mm_cvtss_f32(SimdSum(_mm_mul_ps(c0, r0)));
+		if (determinant == 0.0f)
+		{
+			return Zero();
+		}
+
+		__m128 inverseDeterminant = _mm_set1_ps(1.0f / determinant);
+		r0 = _mm_mul_ps(r0, inverseDeterminant);
+		r1 = _mm_mul_ps(r1, inverseDeterminant);
+		r2 = _mm_mul_ps(r2, inverseDeterminant);
+		__m128 r3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+		Mat3 result;
+		result.Columns[0] = Vec4(r0);
+		result.Columns[1] = Vec4(r1);
+		result.Columns[2] = Vec4(r2);
+		return result;
+		#else
+		Vec3 a = Columns[0].ToVec3();
+		Vec3 b = Columns[1].ToVec3();
+		Vec3 c = Columns[2].ToVec3();
+
+		Vec3 r0 = b.Cross(c);
+		Vec3 r1 = c.Cross(a);
+		Vec3 r2 = a.Cross(b);
+
+		float determinant = a.Dot(r0);
+		if (determinant == 0.0f)
+		{
+			return Zero();
+		}
+
+		float inverseDeterminant = 1.0f / determinant;
+		return Mat3(r0 * inverseDeterminant, r1 * inverseDeterminant, r2 * inverseDeterminant).Transpose();
+		#endif
+	}
+
+	void Mat3::TransformVectors(const Mat3& matrix, const Vec3* vectors, Vec3* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_SSE2
+		const float* source = &vectors[0].x;
+		float* destination = &out[0].x;
+		#endif
+
+		#if RUNDEE_SIMD_AVX
+		__m256 m00 = _mm256_set1_ps(matrix.Columns[0].x), m10 = _mm256_set1_ps(matrix.Columns[0].y), m20 = _mm256_set1_ps(matrix.Columns[0].z);
+		__m256 m01 = _mm256_set1_ps(matrix.Columns[1].x), m11 = _mm256_set1_ps(matrix.Columns[1].y), m21 = _mm256_set1_ps(matrix.Columns[1].z);
+		__m256 m02 = _mm256_set1_ps(matrix.Columns[2].x), m12 = _mm256_set1_ps(matrix.Columns[2].y), m22 = _mm256_set1_ps(matrix.Columns[2].z);
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 x, y, z;
+			SimdLoadXYZ8(source + i * 3, x, y, z);
+			__m256 rx = SimdMulAdd(m02, z, SimdMulAdd(m01, y, _mm256_mul_ps(m00, x)));
+			__m256 ry = SimdMulAdd(m12, z, SimdMulAdd(m11, y, _mm256_mul_ps(m10, x)));
+			__m256 rz = SimdMulAdd(m22, z, SimdMulAdd(m21, y, _mm256_mul_ps(m20, x)));
+			SimdStoreXYZ8(destination + i * 3, rx, ry, rz);
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		__m128 n00 = _mm_set1_ps(matrix.Columns[0].x), n10 = _mm_set1_ps(matrix.Columns[0].y), n20 = _mm_set1_ps(matrix.Columns[0].z);
+		__m128 n01 = _mm_set1_ps(matrix.Columns[1].x), n11 = _mm_set1_ps(matrix.Columns[1].y), n21 = _mm_set1_ps(matrix.Columns[1].z);
+		__m128 n02 = _mm_set1_ps(matrix.Columns[2].x), n12 = _mm_set1_ps(matrix.Columns[2].y), n22 = _mm_set1_ps(matrix.Columns[2].z);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x, y, z;
+			SimdLoadXYZ4(source + i * 3, x, y, z);
+			__m128 rx = SimdMulAdd(n02, z, SimdMulAdd(n01, y, _mm_mul_ps(n00, x)));
+			__m128 ry = SimdMulAdd(n12, z, SimdMulAdd(n11, y, _mm_mul_ps(n10, x)));
+			__m128 rz = SimdMulAdd(n22, z, SimdMulAdd(n21, y, _mm_mul_ps(n20, x)));
+			SimdStoreXYZ4(destination + i * 3, rx, ry, rz);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = matrix * vectors[i];
+		}
+	}
+}
@@ -0,0 +1,386 @@
+//Project Name: RundeeEngine
+//File Name: Mat4.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: 4x4 matrix implementation file
+
+#include "../../include/RundeeEngine/Math/Mat4.h"
+#include <cmath>
+
+namespace RundeeEngine
+{
+	#if RUNDEE_SIMD_SSE2
+	// Lanes listed in result order: (a[X], a[Y], b[Z], b[W])
+	template<int X, int Y, int Z, int W>
+	static __m128 Shuffle(__m128 a, __m128 b)
+	{
+		return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+	}
+
+	template<int X, int Y, int Z, int W>
+	static __m128 Swizzle(__m128 a)
+	{
+		return _mm_shuffle_ps(a, a, _MM_SHUFFLE(W, Z, Y, X));
+	}
+
+	// 2x2 helpers for the block inverse; each register holds a 2x2 matrix as (m00, m01, m10, m11)
+	static __m128 Mat2Mul(__m128 a, __m128 b)
+	{
+		return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+	}
+
+	// adj(a) * b
+	static __m128 Mat2AdjMul(__m128 a, __m128 b)
+	{
+		return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+	}
+
+	// a * adj(b)
+	static __m128 Mat2MulAdj(__m128 a, __m128 b)
+	{
+		return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+	}
+	#endif
+
+	// 2x2 sub-determinants of the top two and bottom two rows of the transposed
+	// view; shared by Determinant and the scalar Inverse
+	struct SubDeterminants
+	{
+		float S[6];
+		float C[6];
+	};
+
+	static SubDeterminants ComputeSubDeterminants(const float (&m)[4][4])
+	{
+		SubDeterminants d;
+		d.S[0] = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+		d.S[1] = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+		d.S[2] = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+		d.S[3] = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+		d.S[4] = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+		d.S[5] = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+		d.C[5] = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+		d.C[4] = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+		d.C[3] = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+		d.C[2] = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+		d.C[1] = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+		d.C[0] = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+		return d;
+	}
+
+	static float DeterminantFrom(const SubDeterminants& d)
+	{
+		return d.S[0] * d.C[5] - d.S[1] * d.C[4] + d.S[2] * d.C[3] + d.S[3] * d.C[2] - d.S[4] * d.C[1] + d.S[5] * d.C[0];
+	}
+
+	static void CopyToArray(const Mat4& matrix, float (&m)[4][4])
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			m[i][0] = matrix.Columns[i].x;
+			m[i][1] = matrix.Columns[i].y;
+			m[i][2] = matrix.Columns[i].z;
+			m[i][3] = matrix.Columns[i].w;
+		}
+	}
+
+	Mat4 Mat4::Translation(const Vec3& translation)
+	{
+		return Mat4(Vec4::UnitX(), Vec4::UnitY(), Vec4::UnitZ(), Vec4(translation, 1.0f));
+	}
+
+	Mat4 Mat4::Scale(const Vec3& scale)
+	{
+		return Mat4(Vec4(scale.x, 0.0f, 0.0f, 0.0f), Vec4(0.0f, scale.y, 0.0f, 0.0f), Vec4(0.0f, 0.0f, scale.z, 0.0f), Vec4::UnitW());
+	}
+
+	Mat4 Mat4::RotationX(float radians)
+	{
+		return Mat4(Mat3::RotationX(radians));
+	}
+
+	Mat4 Mat4::RotationY(float radians)
+	{
+		return Mat4(Mat3::RotationY(radians));
+	}
+
+	Mat4 Mat4::RotationZ(float radians)
+	{
+		return Mat4(Mat3::RotationZ(radians));
+	}
+
+	Mat4 Mat4::RotationAxis(const Vec3& axis, float radians)
+	{
+		return Mat4(Mat3::RotationAxis(axis, radians));
+	}
+
+	Mat4 Mat4::Orthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane)
+	{
+		float width = right - left;
+		float height = top - bottom;
+		float depth = farPlane - nearPlane;
+		if (width == 0.0f || height == 0.0f || depth == 0.0f)
+		{
+			return Zero();
+		}
+
+		return Mat4(
+			Vec4(2.0f / width, 0.0f, 0.0f, 0.0f),
+			Vec4(0.0f, 2.0f / height, 0.0f, 0.0f),
+			Vec4(0.0f, 0.0f, -2.0f / depth, 0.0f),
+			Vec4(-(right + left) / width, -(top + bottom) / height, -(farPlane + nearPlane) / depth, 1.0f));
+	}
+
+	Mat4 Mat4::Perspective(float fovY, float aspect, float nearPlane, float farPlane)
+	{
+		float tanHalfFov = tanf(fovY * 0.5f);
+		if (tanHalfFov == 0.0f || aspect == 0.0f || nearPlane == farPlane)
+		{
+			return Zero();
+		}
+
+		float focal = 1.0f / tanHalfFov;
+		float rangeInverse = 1.0f / (nearPlane - farPlane);
+		return Mat4(
+			Vec4(focal / aspect, 0.0f, 0.0f, 0.0f),
+			Vec4(0.0f, focal, 0.0f, 0.0f),
+			Vec4(0.0f, 0.0f, (farPlane + nearPlane) * rangeInverse, -1.0f),
+			Vec4(0.0f, 0.0f, 2.0f * farPlane * nearPlane * rangeInverse, 0.0f));
+	}
+
+	Mat4 Mat4::LookAt(const Vec3& eye, const Vec3& target, const Vec3& up)
+	{
+		Vec3 forward = (target - eye).Normalize();
+		Vec3 side = forward.Cross(up).Normalize();
+		Vec3 cameraUp = side.Cross(forward);
+
+		return Mat4(
+			Vec4(side.x, cameraUp.x, -forward.x, 0.0f),
+			Vec4(side.y, cameraUp.y, -forward.y, 0.0f),
+			Vec4(side.z, cameraUp.z, -forward.z, 0.0f),
+			Vec4(-side.Dot(eye), -cameraUp.Dot(eye), forward.Dot(eye), 1.0f));
+	}
+
+	float Mat4::Determinant() const
+	{
+		float m[4][4];
+		CopyToArray(*this, m);
+		return DeterminantFrom(ComputeSubDeterminants(m));
+	}
+
+	Mat4 Mat4::Inverse() const
+	{
+		#if RUNDEE_SIMD_SSE2
+		// Block inverse over 2x2 sub-matrices. It is written for rows, but
+		// inverse(transpose(M)) == transpose(inverse(M)), so feeding columns
+		// in yields columns out.
+		__m128 c0 = Columns[0].Load();
+		__m128 c1 = Columns[1].Load();
+		__m128 c2 = Columns[2].Load();
+		__m128 c3 = Columns[3].Load();
+
+		__m128 a = _mm_movelh_ps(c0, c1);
+		__m128 b = _mm_movehl_ps(c1, c0);
+		__m128 c = _mm_movelh_ps(c2, c3);
+		__m128 d = _mm_movehl_ps(c3, c2);
+
+		// (|A|, |B|, |C|, |D|)
+		__m128 subDeterminants = _mm_sub_ps(
+			_mm_mul_ps(Shuffle<0, 2, 0, 2>(c0, c2), Shuffle<1, 3, 1, 3>(c1, c3)),
+			_mm_mul_ps(Shuffle<1, 3, 1, 3>(c0, c2), Shuffle<0, 2, 0, 2>(c1, c3)));
+		__m128 determinantA = SimdSplat<0>(subDeterminants);
+		__m128 determinantB = SimdSplat<1>(subDeterminants);
+		__m128 determinantC = SimdSplat<2>(subDeterminants);
+		__m128 determinantD = SimdSplat<3>(subDeterminants);
+
+		__m128 adjDC = Mat2AdjMul(d, c);
+		__m128 adjAB = Mat2AdjMul(a, b);
+		__m128 x = _mm_sub_ps(_mm_mul_ps(determinantD, a), Mat2Mul(b, adjDC));
+		__m128 w = _mm_sub_ps(_mm_mul_ps(determinantA, d), Mat2Mul(c, adjAB));
+		__m128 y = _mm_sub_ps(_mm_mul_ps(determinantB, c), Mat2MulAdj(d, adjAB));
+		__m128 z = _mm_sub_ps(_mm_mul_ps(determinantC, b), Mat2MulAdj(a, adjDC));
+
+		// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+		__m128 trace = SimdSum(_mm_mul_ps(adjAB, Swizzle<0, 2, 1, 3>(adjDC)));
+		__m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC)), trace);
+		if (_mm_cvtss_f32(determinant) == 0.0f)
+		{
+			return Zero();
+		}
+
+		__m128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+		x = _mm_mul_ps(x, inverseDeterminant);
+		y = _mm_mul_ps(y, inverseDeterminant);
+		z = _mm_mul_ps(z, inverseDeterminant);
+		w = _mm_mul_ps(w, inverseDeterminant);
+
+		return Mat4(
+			Vec4(Shuffle<3, 1, 3, 1>(x, y)),
+			Vec4(Shuffle<2, 0, 2, 0>(x, y)),
+			Vec4(Shuffle<3, 1, 3, 1>(z, w)),
+			Vec4(Shuffle<2, 0, 2, 0>(z, w)));
+		#else
+		float m[4][4];
+		CopyToArray(*this, m);
+		SubDeterminants sub = ComputeSubDeterminants(m);
+		const float* s = sub.S;
+		const float* c = sub.C;
+
+		float determinant = DeterminantFrom(sub);
+		if (determinant == 0.0f)
+		{
+			return Zero();
+		}
+		float invDet = 1.0f / determinant;
+
+		return Mat4(
+			Vec4((m[1][1] * c[5] - m[1][2] * c[4] + m[1][3] * c[3]) * invDet,
+				(-m[0][1] * c[5] + m[0][2] * c[4] - m[0][3] * c[3]) * invDet,
+				(m[3][1] * s[5] - m[3][2] * s[4] + m[3][3] * s[3]) * invDet,
+				(-m[2][1] * s[5] + m[2][2] * s[4] - m[2][3] * s[3]) * invDet),
+			Vec4((-m[1][0] * c[5] + m[1][2] * c[2] - m[1][3] * c[1]) * invDet,
+				(m[0][0] * c[5] - m[0][2] * c[2] + m[0][3] * c[1]) * invDet,
+				(-m[3][0] * s[5] + m[3][2] * s[2] - m[3][3] * s[1]) * invDet,
+				(m[2][0] * s[5] - m[2][2] * s[2] + m[2][3] * s[1]) * invDet),
+			Vec4((m[1][0] * c[4] - m[1][1] * c[2] + m[1][3] * c[0]) * invDet,
+				(-m[0][0] * c[4] + m[0][1] * c[2] - m[0][3] * c[0]) * invDet,
+				(m[3][0] * s[4] - m[3][1] * s[2] + m[3][3] * s[0]) * invDet,
+				(-m[2][0] * s[4] + m[2][1] * s[2] - m[2][3] * s[0]) * invDet),
+			Vec4((-m[1][0] * c[3] + m[1][1] * c[1] - m[1][2] * c[0]) * invDet,
+				(m[0][0] * c[3] - m[0][1] * c[1] + m[0][2] * c[0]) * invDet,
+				(-m[3][0] * s[3] + m[3][1] * s[1] - m[3][2] * s[0]) * invDet,
+				(m[2][0] * s[3] - m[2][1] * s[1] + m[2][2] * s[0]) * invDet));
+		#endif
+	}
+
+	Mat4 Mat4::InverseAffine() const
+	{
+		Mat3 inverse = ToMat3().Inverse();
+		return Mat4(inverse, -(inverse * Columns[3].ToVec3()));
+	}
+
+	void Mat4::TransformPoints(const Mat4& matrix, const Vec3* points, Vec3* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_SSE2
+		const float* source = &points[0].x;
+		float* destination = &out[0].x;
+		#endif
+
+		// Four (or eight) points at a time as x, y and z registers, so each
+		// output component is three multiply-adds for the whole group
+		#if RUNDEE_SIMD_AVX
+		__m256 m00 = _mm256_set1_ps(matrix.Columns[0].x), m10 = _mm256_set1_ps(matrix.Columns[0].y), m20 = _mm256_set1_ps(matrix.Columns[0].z);
+		__m256 m01 = _mm256_set1_ps(matrix.Columns[1].x), m11 = _mm256_set1_ps(matrix.Columns[1].y), m21 = _mm256_set1_ps(matrix.Columns[1].z);
+		__m256 m02 = _mm256_set1_ps(matrix.Columns[2].x), m12 = _mm256_set1_ps(matrix.Columns[2].y), m22 = _mm256_set1_ps(matrix.Columns[2].z);
+		__m256 m03 = _mm256_set1_ps(matrix.Columns[3].x), m13 = _mm256_set1_ps(matrix.Columns[3].y), m23 = _mm256_set1_ps(matrix.Columns[3].z);
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 x, y, z;
+			SimdLoadXYZ8(source + i * 3, x, y, z);
+			__m256 rx = SimdMulAdd(m02, z, SimdMulAdd(m01, y, SimdMulAdd(m00, x, m03)));
+			__m256 ry = SimdMulAdd(m12, z, SimdMulAdd(m11, y, SimdMulAdd(m10, x, m13)));
+			__m256 rz = SimdMulAdd(m22, z, SimdMulAdd(m21, y, SimdMulAdd(m20, x, m23)));
+			SimdStoreXYZ8(destination + i * 3, rx, ry, rz);
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		__m128 n00 = _mm_set1_ps(matrix.Columns[0].x), n10 = _mm_set1_ps(matrix.Columns[0].y), n20 = _mm_set1_ps(matrix.Columns[0].z);
+		__m128 n01 = _mm_set1_ps(matrix.Columns[1].x), n11 = _mm_set1_ps(matrix.Columns[1].y), n21 = _mm_set1_ps(matrix.Columns[1].z);
+		__m128 n02 = _mm_set1_ps(matrix.Columns[2].x), n12 = _mm_set1_ps(matrix.Columns[2].y), n22 = _mm_set1_ps(matrix.Columns[2].z);
+		__m128 n03 = _mm_set1_ps(matrix.Columns[3].x), n13 = _mm_set1_ps(matrix.Columns[3].y), n23 = _mm_set1_ps(matrix.Columns[3].z);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x, y, z;
+			SimdLoadXYZ4(source + i * 3, x, y, z);
+			__m128 rx = SimdMulAdd(n02, z, SimdMulAdd(n01, y, SimdMulAdd(n00, x, n03)));
+			__m128 ry = SimdMulAdd(n12, z, SimdMulAdd(n11, y, SimdMulAdd(n10, x, n13)));
+			__m128 rz = SimdMulAdd(n22, z, SimdMulAdd(n21, y, SimdMulAdd(n20, x, n23)));
+			SimdStoreXYZ4(destination + i * 3, rx, ry, rz);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = matrix.TransformPoint(points[i]);
+		}
+	}
+
+	void Mat4::TransformVectors(const Mat4& matrix, const Vec3* vectors, Vec3* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_SSE2
+		const float* source = &vectors[0].x;
+		float* destination = &out[0].x;
+		#endif
+
+		// TransformPoints without the translation column
+		#if RUNDEE_SIMD_AVX
+		__m256 m00 = _mm256_set1_ps(matrix.Columns[0].x), m10 = _mm256_set1_ps(matrix.Columns[0].y), m20 = _mm256_set1_ps(matrix.Columns[0].z);
+		__m256 m01 = _mm256_set1_ps(matrix.Columns[1].x), m11 = _mm256_set1_ps(matrix.Columns[1].y), m21 = _mm256_set1_ps(matrix.Columns[1].z);
+		__m256 m02 = _mm256_set1_ps(matrix.Columns[2].x), m12 = _mm256_set1_ps(matrix.Columns[2].y), m22 = _mm256_set1_ps(matrix.Columns[2].z);
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 x, y, z;
+			SimdLoadXYZ8(source + i * 3, x, y, z);
+			__m256 rx = SimdMulAdd(m02, z, SimdMulAdd(m01, y, _mm256_mul_ps(m00, x)));
+			__m256 ry = SimdMulAdd(m12, z, SimdMulAdd(m11, y, _mm256_mul_ps(m10, x)));
+			__m256 rz = SimdMulAdd(m22, z, SimdMulAdd(m21, y, _mm256_mul_ps(m20, x)));
+			SimdStoreXYZ8(destination + i * 3, rx, ry, rz);
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		__m128 n00 = _mm_set1_ps(matrix.Columns[0].x), n10 = _mm_set1_ps(matrix.Columns[0].y), n20 = _mm_set1_ps(matrix.Columns[0].z);
+		__m128 n01 = _mm_set1_ps(matrix.Columns[1].x), n11 = _mm_set1_ps(matrix.Columns[1].y), n21 = _mm_set1_ps(matrix.Columns[1].z);
+		__m128 n02 = _mm_set1_ps(matrix.Columns[2].x), n12 = _mm_set1_ps(matrix.Columns[2].y), n22 = _mm_set1_ps(matrix.Columns[2].z);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x, y, z;
+			SimdLoadXYZ4(source + i * 3, x, y, z);
+			__m128 rx = SimdMulAdd(n02, z, SimdMulAdd(n01, y, _mm_mul_ps(n00, x)));
+			__m128 ry = SimdMulAdd(n12, z, SimdMulAdd(n11, y, _mm_mul_ps(n10, x)));
+			__m128 rz = SimdMulAdd(n22, z, SimdMulAdd(n21, y, _mm_mul_ps(n20, x)));
+			SimdStoreXYZ4(destination + i * 3, rx, ry, rz);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = matrix.TransformVector(vectors[i]);
+		}
+	}
+
+	void Mat4::Transform(const Mat4& matrix, const Vec4* vectors, Vec4* out, size_t count)
+	{
+		size_t i = 0;
+
+		#if RUNDEE_SIMD_AVX
+		__m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix.Columns[0]));
+		__m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix.Columns[1]));
+		__m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix.Columns[2]));
+		__m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix.Columns[3]));
+
+		for (; i + 2 <= count; i += 2)
+		{
+			__m256 v = _mm256_loadu_ps(&vectors[i].x);
+			__m256 value = _mm256_mul_ps(c0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+			value = SimdMulAdd(c1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), value);
+			value = SimdMulAdd(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), value);
+			value = SimdMulAdd(c3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), value);
+			_mm256_storeu_ps(&out[i].x, value);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = matrix * vectors[i];
+		}
+	}
+}
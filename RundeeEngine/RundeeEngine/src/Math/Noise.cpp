@@ -0,0 +1,72 @@
+//Project Name: RundeeEngine
+//File Name: Noise.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Procedural noise generation implementation file
+
+#include "../../include/RundeeEngine/Math/Noise.h"
+#include "../../include/RundeeEngine/Math/SIMD.h"
+#include "../../include/RundeeEngine/Math/SimdKernels.h"
+#include "../../include/RundeeEngine/JobSystem.h"
+#include "../../include/RundeeEngine/Memory/MemoryResource.h"
+#include "NoiseLanes.inl"
+#include <memory_resource>
+#include <vector>
+
+namespace RundeeEngine
+{
+	static constexpr size_t NoiseRowsPerJob = 16;
+
+	//----------Noise Implementation----------
+
+	float Noise::Sample2D(const NoiseSettings& settings, float x, float y)
+	{
+		return Sample2DLanes<SimdFloat1>(settings, x, y);
+	}
+
+	float Noise::Sample3D(const NoiseSettings& settings, float x, float y, float z)
+	{
+		return Sample3DLanes<SimdFloat1>(settings, x, y, z);
+	}
+
+	void Noise::Grid2D(const NoiseSettings& settings, float* out, size_t width, size_t height, float originX, float originY, float step)
+	{
+		std::pmr::vector<float> xs(width, GetTaggedResource(MemoryTag::Math));
+		for (size_t i = 0; i < width; ++i)
+		{
+			xs[i] = originX + static_cast<float>(i) * step;
+		}
+
+		const SimdKernelTable& kernels = SimdKernels::Get();
+		JobSystem::ParallelFor(height, NoiseRowsPerJob, [&](size_t begin, size_t end)
+		{
+			for (size_t row = begin; row < end; ++row)
+			{
+				float y = originY + static_cast<float>(row) * step;
+				kernels.NoiseRow2D(settings, xs.data(), y, out + row * width, width);
+			}
+		});
+	}
+
+	void Noise::Grid3D(const NoiseSettings& settings, float* out, size_t width, size_t height, size_t depth,
+		float originX, float originY, float originZ, float step)
+	{
+		std::pmr::vector<float> xs(width, GetTaggedResource(MemoryTag::Math));
+		for (size_t i = 0; i < width; ++i)
+		{
+			xs[i] = originX + static_cast<float>(i) * step;
+		}
+
+		// Rows of every slice form one range so thin volumes still split
+		const SimdKernelTable& kernels = SimdKernels::Get();
+		JobSystem::ParallelFor(height * depth, NoiseRowsPerJob, [&](size_t begin, size_t end)
+		{
+			for (size_t row = begin; row < end; ++row)
+			{
+				float y = originY + static_cast<float>(row % height) * step;
+				float z = originZ + static_cast<float>(row / height) * step;
+				kernels.NoiseRow3D(settings, xs.data(), y, z, out + row * width, width);
+			}
+		});
+	}
+}
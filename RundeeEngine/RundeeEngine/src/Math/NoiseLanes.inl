@@ -0,0 +1,320 @@
+//Project Name: RundeeEngine
+//File Name: NoiseLanes.inl
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Noise evaluation over SIMD lanes, shared by Noise and the SIMD kernels
+
+// Included after SIMD.h and Noise.h by Noise.cpp, for single samples, and
+// by SimdKernels.inl, for the dispatched grid rows. Everything here has
+// internal linkage, so each including file compiles its own copy for its
+// instruction set.
+
+namespace RundeeEngine
+{
+	static constexpr int32_t PrimeX = 501125321;
+	static constexpr int32_t PrimeY = 1136930381;
+	static constexpr int32_t PrimeZ = 1720413743;
+
+	// Bring the corner sums to roughly [-1, 1]
+	static constexpr float SimplexScale2D = 88.0f;
+	static constexpr float SimplexScale3D = 32.0f;
+
+	// Lattice coordinates arrive pre-multiplied by their primes
+	template<typename L>
+	static typename L::IntType HashLattice(typename L::IntType seed, typename L::IntType x, typename L::IntType y)
+	{
+		typename L::IntType hash = L::IntMul(L::IntXor(seed, L::IntXor(x, y)), L::IntSet(0x27D4EB2D));
+		return L::IntXor(hash, L::template IntShiftRight<15>(hash));
+	}
+
+	template<typename L>
+	static typename L::IntType HashLattice(typename L::IntType seed, typename L::IntType x, typename L::IntType y, typename L::IntType z)
+	{
+		return HashLattice<L>(seed, L::IntXor(x, y), z);
+	}
+
+	// Flips the sign of value where the given hash bit is set
+	template<typename L, int Bit>
+	static typename L::Type FlipSign(typename L::IntType hash, typename L::Type value)
+	{
+		return L::Xor(value, L::AsFloat(L::template IntShiftLeft<31 - Bit>(L::IntAnd(hash, L::IntSet(1 << Bit)))));
+	}
+
+	// Eight directions (+-1, +-0.5) and their transposes
+	template<typename L>
+	static typename L::Type Gradient(typename L::IntType hash, typename L::Type x, typename L::Type y)
+	{
+		typename L::Type swap = L::IntEq(L::IntAnd(hash, L::IntSet(1)), L::IntSet(1));
+		typename L::Type u = L::Select(swap, y, x);
+		typename L::Type v = L::Select(swap, x, y);
+		return L::MulAdd(FlipSign<L, 2>(hash, v), L::Set(0.5f), FlipSign<L, 1>(hash, u));
+	}
+
+	// Perlin's twelve cube-edge directions
+	template<typename L>
+	static typename L::Type Gradient(typename L::IntType hash, typename L::Type x, typename L::Type y, typename L::Type z)
+	{
+		typename L::IntType zero = L::IntSet(0);
+		typename L::Type low8 = L::IntEq(L::IntAnd(hash, L::IntSet(8)), zero);
+		typename L::Type low4 = L::IntEq(L::IntAnd(hash, L::IntSet(12)), zero);
+		typename L::Type twelveOrFourteen = L::IntEq(L::IntAnd(hash, L::IntSet(13)), L::IntSet(12));
+		typename L::Type u = L::Select(low8, x, y);
+		typename L::Type v = L::Select(low4, y, L::Select(twelveOrFourteen, x, z));
+		return L::Add(FlipSign<L, 0>(hash, u), FlipSign<L, 1>(hash, v));
+	}
+
+	template<typename L>
+	static typename L::Type Quintic(typename L::Type t)
+	{
+		typename L::Type inner = L::MulAdd(t, L::MulAdd(t, L::Set(6.0f), L::Set(-15.0f)), L::Set(10.0f));
+		return L::Mul(L::Mul(L::Mul(t, t), t), inner);
+	}
+
+	template<typename L>
+	static typename L::Type HashToUnit(typename L::IntType hash)
+	{
+		return L::Mul(L::IntToFloat(hash), L::Set(1.0f / 2147483648.0f));
+	}
+
+	template<typename L>
+	static typename L::Type Lerp(typename L::Type a, typename L::Type b, typename L::Type t)
+	{
+		return L::MulAdd(L::Sub(b, a), t, a);
+	}
+
+	//----------Simplex Implementation----------
+
+	template<typename L>
+	static typename L::Type SimplexCorner(typename L::IntType hash, typename L::Type x, typename L::Type y)
+	{
+		typename L::Type t = L::Max(L::Sub(L::Set(0.5f), L::MulAdd(x, x, L::Mul(y, y))), L::Set(0.0f));
+		t = L::Mul(t, t);
+		return L::Mul(L::Mul(t, t), Gradient<L>(hash, x, y));
+	}
+
+	template<typename L>
+	static typename L::Type Simplex2D(typename L::IntType seed, typename L::Type x, typename L::Type y)
+	{
+		using T = typename L::Type;
+		using I = typename L::IntType;
+		const float F2 = 0.366025403784438647f;
+		const float G2 = 0.211324865405187118f;
+
+		// Skew to the square lattice, find the cell, unskew back
+		T skew = L::Mul(L::Add(x, y), L::Set(F2));
+		I i = L::FloorToInt(L::Add(x, skew));
+		I j = L::FloorToInt(L::Add(y, skew));
+		T fi = L::IntToFloat(i);
+		T fj = L::IntToFloat(j);
+		T unskew = L::Mul(L::Add(fi, fj), L::Set(G2));
+		T x0 = L::Sub(x, L::Sub(fi, unskew));
+		T y0 = L::Sub(y, L::Sub(fj, unskew));
+
+		// Lower or upper triangle decides the middle corner
+		T zero = L::Set(0.0f);
+		T one = L::Set(1.0f);
+		T lower = L::CmpGt(x0, y0);
+		T upper = L::Xor(lower, L::CmpEq(zero, zero));
+		T x1 = L::Add(L::Sub(x0, L::And(lower, one)), L::Set(G2));
+		T y1 = L::Add(L::Sub(y0, L::And(upper, one)), L::Set(G2));
+		T x2 = L::Add(x0, L::Set(2.0f * G2 - 1.0f));
+		T y2 = L::Add(y0, L::Set(2.0f * G2 - 1.0f));
+
+		I primeX = L::IntSet(PrimeX);
+		I primeY = L::IntSet(PrimeY);
+		I xPrimed = L::IntMul(i, primeX);
+		I yPrimed = L::IntMul(j, primeY);
+		I xPrimed1 = L::IntAdd(xPrimed, L::IntAnd(L::AsInt(lower), primeX));
+		I yPrimed1 = L::IntAdd(yPrimed, L::IntAnd(L::AsInt(upper), primeY));
+
+		T n = SimplexCorner<L>(HashLattice<L>(seed, xPrimed, yPrimed), x0, y0);
+		n = L::Add(n, SimplexCorner<L>(HashLattice<L>(seed, xPrimed1, yPrimed1), x1, y1));
+		n = L::Add(n, SimplexCorner<L>(HashLattice<L>(seed, L::IntAdd(xPrimed, primeX), L::IntAdd(yPrimed, primeY)), x2, y2));
+		return L::Mul(n, L::Set(SimplexScale2D));
+	}
+
+	template<typename L>
+	static typename L::Type SimplexCorner(typename L::IntType hash, typename L::Type x, typename L::Type y, typename L::Type z)
+	{
+		typename L::Type distanceSquared = L::MulAdd(x, x, L::MulAdd(y, y, L::Mul(z, z)));
+		typename L::Type t = L::Max(L::Sub(L::Set(0.6f), distanceSquared), L::Set(0.0f));
+		t = L::Mul(t, t);
+		return L::Mul(L::Mul(t, t), Gradient<L>(hash, x, y, z));
+	}
+
+	template<typename L>
+	static typename L::Type Simplex3D(typename L::IntType seed, typename L::Type x, typename L::Type y, typename L::Type z)
+	{
+		using T = typename L::Type;
+		using I = typename L::IntType;
+		const float F3 = 1.0f / 3.0f;
+		const float G3 = 1.0f / 6.0f;
+
+		T skew = L::Mul(L::Add(L::Add(x, y), z), L::Set(F3));
+		I i = L::FloorToInt(L::Add(x, skew));
+		I j = L::FloorToInt(L::Add(y, skew));
+		I k = L::FloorToInt(L::Add(z, skew));
+		T fi = L::IntToFloat(i);
+		T fj = L::IntToFloat(j);
+		T fk = L::IntToFloat(k);
+		T unskew = L::Mul(L::Add(L::Add(fi, fj), fk), L::Set(G3));
+		T x0 = L::Sub(x, L::Sub(fi, unskew));
+		T y0 = L::Sub(y, L::Sub(fj, unskew));
+		T z0 = L::Sub(z, L::Sub(fk, unskew));
+
+		// Rank the offsets to pick which of the six tetrahedra holds the point
+		T zero = L::Set(0.0f);
+		T allOnes = L::CmpEq(zero, zero);
+		T xGreaterY = L::Xor(L::CmpLt(x0, y0), allOnes);
+		T yGreaterZ = L::Xor(L::CmpLt(y0, z0), allOnes);
+		T xGreaterZ = L::Xor(L::CmpLt(x0, z0), allOnes);
+		T i1 = L::And(xGreaterY, xGreaterZ);
+		T j1 = L::And(L::Xor(xGreaterY, allOnes), yGreaterZ);
+		T k1 = L::Xor(L::Or(xGreaterZ, yGreaterZ), allOnes);
+		T i2 = L::Or(xGreaterY, xGreaterZ);
+		T j2 = L::Or(L::Xor(xGreaterY, allOnes), yGreaterZ);
+		T k2 = L::Xor(L::And(xGreaterZ, yGreaterZ), allOnes);
+
+		T one = L::Set(1.0f);
+		T x1 = L::Add(L::Sub(x0, L::And(i1, one)), L::Set(G3));
+		T y1 = L::Add(L::Sub(y0, L::And(j1, one)), L::Set(G3));
+		T z1 = L::Add(L::Sub(z0, L::And(k1, one)), L::Set(G3));
+		T x2 = L::Add(L::Sub(x0, L::And(i2, one)), L::Set(2.0f * G3));
+		T y2 = L::Add(L::Sub(y0, L::And(j2, one)), L::Set(2.0f * G3));
+		T z2 = L::Add(L::Sub(z0, L::And(k2, one)), L::Set(2.0f * G3));
+		T x3 = L::Add(x0, L::Set(3.0f * G3 - 1.0f));
+		T y3 = L::Add(y0, L::Set(3.0f * G3 - 1.0f));
+		T z3 = L::Add(z0, L::Set(3.0f * G3 - 1.0f));
+
+		I primeX = L::IntSet(PrimeX);
+		I primeY = L::IntSet(PrimeY);
+		I primeZ = L::IntSet(PrimeZ);
+		I xPrimed = L::IntMul(i, primeX);
+		I yPrimed = L::IntMul(j, primeY);
+		I zPrimed = L::IntMul(k, primeZ);
+
+		T n = SimplexCorner<L>(HashLattice<L>(seed, xPrimed, yPrimed, zPrimed), x0, y0, z0);
+		n = L::Add(n, SimplexCorner<L>(HashLattice<L>(seed,
+			L::IntAdd(xPrimed, L::IntAnd(L::AsInt(i1), primeX)),
+			L::IntAdd(yPrimed, L::IntAnd(L::AsInt(j1), primeY)),
+			L::IntAdd(zPrimed, L::IntAnd(L::AsInt(k1), primeZ))), x1, y1, z1));
+		n = L::Add(n, SimplexCorner<L>(HashLattice<L>(seed,
+			L::IntAdd(xPrimed, L::IntAnd(L::AsInt(i2), primeX)),
+			L::IntAdd(yPrimed, L::IntAnd(L::AsInt(j2), primeY)),
+			L::IntAdd(zPrimed, L::IntAnd(L::AsInt(k2), primeZ))), x2, y2, z2));
+		n = L::Add(n, SimplexCorner<L>(HashLattice<L>(seed, L::IntAdd(xPrimed, primeX), L::IntAdd(yPrimed, primeY), L::IntAdd(zPrimed, primeZ)), x3, y3, z3));
+		return L::Mul(n, L::Set(SimplexScale3D));
+	}
+
+	//----------Value Implementation----------
+
+	template<typename L>
+	static typename L::Type Value2D(typename L::IntType seed, typename L::Type x, typename L::Type y)
+	{
+		using T = typename L::Type;
+		using I = typename L::IntType;
+		I i = L::FloorToInt(x);
+		I j = L::FloorToInt(y);
+		T u = Quintic<L>(L::Sub(x, L::IntToFloat(i)));
+		T v = Quintic<L>(L::Sub(y, L::IntToFloat(j)));
+
+		I x0 = L::IntMul(i, L::IntSet(PrimeX));
+		I y0 = L::IntMul(j, L::IntSet(PrimeY));
+		I x1 = L::IntAdd(x0, L::IntSet(PrimeX));
+		I y1 = L::IntAdd(y0, L::IntSet(PrimeY));
+
+		T bottom = Lerp<L>(HashToUnit<L>(HashLattice<L>(seed, x0, y0)), HashToUnit<L>(HashLattice<L>(seed, x1, y0)), u);
+		T top = Lerp<L>(HashToUnit<L>(HashLattice<L>(seed, x0, y1)), HashToUnit<L>(HashLattice<L>(seed, x1, y1)), u);
+		return Lerp<L>(bottom, top, v);
+	}
+
+	template<typename L>
+	static typename L::Type Value3D(typename L::IntType seed, typename L::Type x, typename L::Type y, typename L::Type z)
+	{
+		using T = typename L::Type;
+		using I = typename L::IntType;
+		I i = L::FloorToInt(x);
+		I j = L::FloorToInt(y);
+		I k = L::FloorToInt(z);
+		T u = Quintic<L>(L::Sub(x, L::IntToFloat(i)));
+		T v = Quintic<L>(L::Sub(y, L::IntToFloat(j)));
+		T w = Quintic<L>(L::Sub(z, L::IntToFloat(k)));
+
+		I x0 = L::IntMul(i, L::IntSet(PrimeX));
+		I y0 = L::IntMul(j, L::IntSet(PrimeY));
+		I z0 = L::IntMul(k, L::IntSet(PrimeZ));
+		I x1 = L::IntAdd(x0, L::IntSet(PrimeX));
+		I y1 = L::IntAdd(y0, L::IntSet(PrimeY));
+		I z1 = L::IntAdd(z0, L::IntSet(PrimeZ));
+
+		T near0 = Lerp<L>(HashToUnit<L>(HashLattice<L>(seed, x0, y0, z0)), HashToUnit<L>(HashLattice<L>(seed, x1, y0, z0)), u);
+		T near1 = Lerp<L>(HashToUnit<L>(HashLattice<L>(seed, x0, y1, z0)), HashToUnit<L>(HashLattice<L>(seed, x1, y1, z0)), u);
+		T far0 = Lerp<L>(HashToUnit<L>(HashLattice<L>(seed, x0, y0, z1)), HashToUnit<L>(HashLattice<L>(seed, x1, y0, z1)), u);
+		T far1 = Lerp<L>(HashToUnit<L>(HashLattice<L>(seed, x0, y1, z1)), HashToUnit<L>(HashLattice<L>(seed, x1, y1, z1)), u);
+		return Lerp<L>(Lerp<L>(near0, near1, v), Lerp<L>(far0, far1, v), w);
+	}
+
+	//----------Fractal Implementation----------
+
+	// Each octave gets its own seed so octaves do not line up at the origin
+	template<typename L, typename Single, typename... Coordinates>
+	static typename L::Type Fractal(const NoiseSettings& settings, const Single& single, Coordinates... coordinates)
+	{
+		using T = typename L::Type;
+		typename L::IntType seed = L::IntSet(settings.Seed);
+		T frequency = L::Set(settings.Frequency);
+
+		if (settings.Fractal == FractalType::None || settings.Octaves <= 1)
+		{
+			T n = single(seed, L::Mul(coordinates, frequency)...);
+			if (settings.Fractal == FractalType::Ridged)
+			{
+				T ridge = L::Sub(L::Set(1.0f), L::Abs(n));
+				n = L::MulAdd(L::Mul(ridge, ridge), L::Set(2.0f), L::Set(-1.0f));
+			}
+			return n;
+		}
+
+		T sum = L::Set(0.0f);
+		float amplitude = 1.0f;
+		float totalAmplitude = 0.0f;
+		for (int octave = 0; octave < settings.Octaves; ++octave)
+		{
+			T n = single(seed, L::Mul(coordinates, frequency)...);
+			if (settings.Fractal == FractalType::Ridged)
+			{
+				T ridge = L::Sub(L::Set(1.0f), L::Abs(n));
+				n = L::Mul(ridge, ridge);
+			}
+			sum = L::MulAdd(n, L::Set(amplitude), sum);
+			totalAmplitude += amplitude;
+			amplitude *= settings.Gain;
+			frequency = L::Mul(frequency, L::Set(settings.Lacunarity));
+			seed = L::IntAdd(seed, L::IntSet(1));
+		}
+
+		T normalized = L::Mul(sum, L::Set(1.0f / totalAmplitude));
+		// Ridged octaves are in [0, 1]; stretch to match the others
+		return settings.Fractal == FractalType::Ridged ? L::MulAdd(normalized, L::Set(2.0f), L::Set(-1.0f)) : normalized;
+	}
+
+	template<typename L>
+	static typename L::Type Sample2DLanes(const NoiseSettings& settings, typename L::Type x, typename L::Type y)
+	{
+		if (settings.Type == NoiseType::Value)
+		{
+			return Fractal<L>(settings, [](auto seed, auto sx, auto sy) { return Value2D<L>(seed, sx, sy); }, x, y);
+		}
+		return Fractal<L>(settings, [](auto seed, auto sx, auto sy) { return Simplex2D<L>(seed, sx, sy); }, x, y);
+	}
+
+	template<typename L>
+	static typename L::Type Sample3DLanes(const NoiseSettings& settings, typename L::Type x, typename L::Type y, typename L::Type z)
+	{
+		if (settings.Type == NoiseType::Value)
+		{
+			return Fractal<L>(settings, [](auto seed, auto sx, auto sy, auto sz) { return Value3D<L>(seed, sx, sy, sz); }, x, y, z);
+		}
+		return Fractal<L>(settings, [](auto seed, auto sx, auto sy, auto sz) { return Simplex3D<L>(seed, sx, sy, sz); }, x, y, z);
+	}
+}
@@ -0,0 +1,178 @@
+//Project Name: RundeeEngine
+//File Name: Packing.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Half-precision, normalized integer and unit vector packing implementation file
+
+#include "../../include/RundeeEngine/Math/Packing.h"
+#include "../../include/RundeeEngine/Math/SIMD.h"
+#include "../../include/RundeeEngine/Math/SimdKernels.h"
+#include "PackingLanes.inl"
+
+namespace RundeeEngine
+{
+	#if !RUNDEE_SIMD_F16C
+	static uint32_t FloatBits(float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	static float BitsToFloat(uint32_t bits)
+	{
+		float value;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+	#endif
+
+	//----------Octahedral Implementation----------
+
+	uint32_t Packing::PackOctahedral32(const Vec3& unit)
+	{
+		return static_cast<uint32_t>(OctahedralPack32<SimdFloat1>(unit.x, unit.y, unit.z));
+	}
+
+	Vec3 Packing::UnpackOctahedral32(uint32_t packed)
+	{
+		Vec3 result;
+		OctahedralUnpack32<SimdFloat1>(static_cast<int32_t>(packed), result.x, result.y, result.z);
+		return result;
+	}
+
+	uint16_t Packing::PackOctahedral16(const Vec3& unit)
+	{
+		float u, v;
+		OctahedralEncode<SimdFloat1>(unit.x, unit.y, unit.z, u, v);
+		return static_cast<uint16_t>(static_cast<uint8_t>(PackSnorm8(u)) | (static_cast<uint8_t>(PackSnorm8(v)) << 8));
+	}
+
+	Vec3 Packing::UnpackOctahedral16(uint16_t packed)
+	{
+		Vec3 result;
+		OctahedralDecode<SimdFloat1>(UnpackSnorm8(static_cast<int8_t>(packed & 0xFF)), UnpackSnorm8(static_cast<int8_t>(packed >> 8)),
+			result.x, result.y, result.z);
+		return result;
+	}
+
+	void Packing::PackOctahedral32(const float* x, const float* y, const float* z, uint32_t* out, size_t count)
+	{
+		SimdKernels::Get().PackOctahedral32({ x, y, z }, out, count);
+	}
+
+	void Packing::UnpackOctahedral32(const uint32_t* in, float* outX, float* outY, float* outZ, size_t count)
+	{
+		SimdKernels::Get().UnpackOctahedral32(in, { outX, outY, outZ }, count);
+	}
+
+	//----------Half Implementation----------
+
+	// Fabian Giesen's branch-light conversions: the rounding is done by the
+	// FPU (denormals) or by an integer add with a round-to-even bias
+	uint16_t Packing::FloatToHalf(float value)
+	{
+		#if RUNDEE_SIMD_F16C
+		return static_cast<uint16_t>(_mm_extract_epi16(_mm_cvtps_ph(_mm_set_ss(value), _MM_FROUND_TO_NEAREST_INT), 0));
+		#else
+		static constexpr uint32_t Infinity = 255u << 23;
+		static constexpr uint32_t HalfOverflow = (127u + 16u) << 23;
+		static constexpr uint32_t DenormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+		uint32_t bits = FloatBits(value);
+		uint32_t sign = bits & 0x80000000u;
+		bits ^= sign;
+
+		uint32_t result;
+		if (bits >= HalfOverflow)
+		{
+			result = bits > Infinity ? 0x7E00u : 0x7C00u;
+		}
+		else if (bits < (113u << 23))
+		{
+			result = FloatBits(BitsToFloat(bits) + BitsToFloat(DenormalMagic)) - DenormalMagic;
+		}
+		else
+		{
+			uint32_t mantissaOdd = (bits >> 13) & 1u;
+			bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFFu + mantissaOdd;
+			result = bits >> 13;
+		}
+		return static_cast<uint16_t>(result | (sign >> 16));
+		#endif
+	}
+
+	float Packing::HalfToFloat(uint16_t value)
+	{
+		#if RUNDEE_SIMD_F16C
+		return _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(value)));
+		#else
+		static constexpr uint32_t ShiftedExponent = 0x7C00u << 13;
+
+		uint32_t bits = (value & 0x7FFFu) << 13;
+		uint32_t exponent = bits & ShiftedExponent;
+		bits += (127u - 15u) << 23;
+		if (exponent == ShiftedExponent)
+		{
+			bits += (128u - 16u) << 23;
+		}
+		else if (exponent == 0)
+		{
+			bits = FloatBits(BitsToFloat(bits + (1u << 23)) - BitsToFloat(113u << 23));
+		}
+		return BitsToFloat(bits | (static_cast<uint32_t>(value & 0x8000u) << 16));
+		#endif
+	}
+
+	void Packing::FloatToHalf(const float* in, uint16_t* out, size_t count)
+	{
+		SimdKernels::Get().FloatToHalf(in, out, count);
+	}
+
+	void Packing::HalfToFloat(const uint16_t* in, float* out, size_t count)
+	{
+		SimdKernels::Get().HalfToFloat(in, out, count);
+	}
+
+	//----------Normalized Implementation----------
+
+	void Packing::PackSnorm16(const float* in, int16_t* out, size_t count)
+	{
+		SimdKernels::Get().PackSnorm16(in, out, count);
+	}
+
+	void Packing::UnpackSnorm16(const int16_t* in, float* out, size_t count)
+	{
+		SimdKernels::Get().UnpackSnorm16(in, out, count);
+	}
+
+	void Packing::PackSnorm8(const float* in, int8_t* out, size_t count)
+	{
+		SimdKernels::Get().PackSnorm8(in, out, count);
+	}
+
+	void Packing::UnpackSnorm8(const int8_t* in, float* out, size_t count)
+	{
+		SimdKernels::Get().UnpackSnorm8(in, out, count);
+	}
+
+	void Packing::PackUnorm16(const float* in, uint16_t* out, size_t count)
+	{
+		SimdKernels::Get().PackUnorm16(in, out, count);
+	}
+
+	void Packing::UnpackUnorm16(const uint16_t* in, float* out, size_t count)
+	{
+		SimdKernels::Get().UnpackUnorm16(in, out, count);
+	}
+
+	void Packing::PackUnorm8(const float* in, uint8_t* out, size_t count)
+	{
+		SimdKernels::Get().PackUnorm8(in, out, count);
+	}
+
+	void Packing::UnpackUnorm8(const uint8_t* in, float* out, size_t count)
+	{
+		SimdKernels::Get().UnpackUnorm8(in, out, count);
+	}
+}
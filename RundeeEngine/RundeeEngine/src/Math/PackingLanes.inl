@@ -0,0 +1,75 @@
+//Project Name: RundeeEngine
+//File Name: PackingLanes.inl
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Octahedral unit vector encoding over SIMD lanes, shared by Packing and the SIMD kernels
+
+// Included after SIMD.h by Packing.cpp, for single vectors, and by
+// SimdKernels.inl, for the dispatched batches. Internal linkage keeps one
+// copy per including file and instruction set.
+
+namespace RundeeEngine
+{
+	// +-1 with the sign of value, never zero
+	template<typename L>
+	static typename L::Type SignNotZero(typename L::Type value)
+	{
+		return L::Or(L::And(value, L::Set(-0.0f)), L::Set(1.0f));
+	}
+
+	// Projects onto the octahedron |x| + |y| + |z| = 1 and unfolds the lower
+	// half over the diagonals, giving u, v in [-1, 1]
+	template<typename L>
+	static void OctahedralEncode(typename L::Type x, typename L::Type y, typename L::Type z, typename L::Type& outU, typename L::Type& outV)
+	{
+		using T = typename L::Type;
+		T l1 = L::Add(L::Add(L::Abs(x), L::Abs(y)), L::Abs(z));
+		T inverse = L::Div(L::Set(1.0f), L::Max(l1, L::Set(1e-30f)));
+		T u = L::Mul(x, inverse);
+		T v = L::Mul(y, inverse);
+		T lower = L::CmpLt(z, L::Set(0.0f));
+		T foldedU = L::Mul(L::Sub(L::Set(1.0f), L::Abs(v)), SignNotZero<L>(u));
+		T foldedV = L::Mul(L::Sub(L::Set(1.0f), L::Abs(u)), SignNotZero<L>(v));
+		outU = L::Select(lower, foldedU, u);
+		outV = L::Select(lower, foldedV, v);
+	}
+
+	template<typename L>
+	static void OctahedralDecode(typename L::Type u, typename L::Type v, typename L::Type& outX, typename L::Type& outY, typename L::Type& outZ)
+	{
+		using T = typename L::Type;
+		T z = L::Sub(L::Sub(L::Set(1.0f), L::Abs(u)), L::Abs(v));
+		T fold = L::Max(L::Sub(L::Set(0.0f), z), L::Set(0.0f));
+		// Move toward the axis by the folded amount, keeping each sign
+		T x = L::Sub(u, L::Xor(fold, L::And(u, L::Set(-0.0f))));
+		T y = L::Sub(v, L::Xor(fold, L::And(v, L::Set(-0.0f))));
+		T inverseLength = L::Div(L::Set(1.0f), L::Sqrt(L::Add(L::Add(L::Mul(x, x), L::Mul(y, y)), L::Mul(z, z))));
+		outX = L::Mul(x, inverseLength);
+		outY = L::Mul(y, inverseLength);
+		outZ = L::Mul(z, inverseLength);
+	}
+
+	// Two snorm16s in one 32-bit lane, u in the low half
+	template<typename L>
+	static typename L::IntType OctahedralPack32(typename L::Type x, typename L::Type y, typename L::Type z)
+	{
+		using T = typename L::Type;
+		T u, v;
+		OctahedralEncode<L>(x, y, z, u, v);
+		T scale = L::Set(32767.0f);
+		typename L::IntType packedU = L::RoundToInt(L::Mul(L::Min(L::Max(u, L::Set(-1.0f)), L::Set(1.0f)), scale));
+		typename L::IntType packedV = L::RoundToInt(L::Mul(L::Min(L::Max(v, L::Set(-1.0f)), L::Set(1.0f)), scale));
+		return L::AsInt(L::Or(L::AsFloat(L::IntAnd(packedU, L::IntSet(0xFFFF))), L::AsFloat(L::template IntShiftLeft<16>(packedV))));
+	}
+
+	// Each half is sign-extended by converting it from the top 16 bits
+	template<typename L>
+	static void OctahedralUnpack32(typename L::IntType packed, typename L::Type& outX, typename L::Type& outY, typename L::Type& outZ)
+	{
+		using T = typename L::Type;
+		T scale = L::Set(1.0f / (32767.0f * 65536.0f));
+		T u = L::Max(L::Mul(L::IntToFloat(L::template IntShiftLeft<16>(packed)), scale), L::Set(-1.0f));
+		T v = L::Max(L::Mul(L::IntToFloat(L::IntAnd(packed, L::IntSet(static_cast<int32_t>(0xFFFF0000u)))), scale), L::Set(-1.0f));
+		OctahedralDecode<L>(u, v, outX, outY, outZ);
+	}
+}
@@ -0,0 +1,166 @@
+//Project Name: RundeeEngine
+//File Name: Quat.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Rotation quaternion implementation file
+
+#include "../../include/RundeeEngine/Math/Quat.h"
+#include <cmath>
+
+namespace RundeeEngine
+{
+	Quat Quat::FromAxisAngle(const Vec3& axis, float radians)
+	{
+		Vec3 n = axis.Normalize();
+		float halfAngle = radians * 0.5f;
+		float sinHalf = sinf(halfAngle);
+		return Quat(n.x * sinHalf, n.y * sinHalf, n.z * sinHalf, cosf(halfAngle));
+	}
+
+	Quat Quat::FromEuler(const Vec3& radians)
+	{
+		float cx = cosf(radians.x * 0.5f), sx = sinf(radians.x * 0.5f);
+		float cy = cosf(radians.y * 0.5f), sy = sinf(radians.y * 0.5f);
+		float cz = cosf(radians.z * 0.5f), sz = sinf(radians.z * 0.5f);
+
+		// Expanded Z * Y * X
+		return Quat(
+			sx * cy * cz - cx * sy * sz,
+			cx * sy * cz + sx * cy * sz,
+			cx * cy * sz - sx * sy * cz,
+			cx * cy * cz + sx * sy * sz);
+	}
+
+	// Shepperd's method: branch on the largest diagonal term to keep the square root well conditioned
+	Quat Quat::FromMat3(const Mat3& rotation)
+	{
+		float m00 = rotation.Columns[0].x, m10 = rotation.Columns[0].y, m20 = rotation.Columns[0].z;
+		float m01 = rotation.Columns[1].x, m11 = rotation.Columns[1].y, m21 = rotation.Columns[1].z;
+		float m02 = rotation.Columns[2].x, m12 = rotation.Columns[2].y, m22 = rotation.Columns[2].z;
+
+		float trace = m00 + m11 + m22;
+		if (trace > 0.0f)
+		{
+			float s = sqrtf(trace + 1.0f) * 2.0f;
+			return Quat((m21 - m12) / s, (m02 - m20) / s, (m10 - m01) / s, 0.25f * s);
+		}
+		else if (m00 > m11 && m00 > m22)
+		{
+			float s = sqrtf(1.0f + m00 - m11 - m22) * 2.0f;
+			return Quat(0.25f * s, (m01 + m10) / s, (m02 + m20) / s, (m21 - m12) / s);
+		}
+		else if (m11 > m22)
+		{
+			float s = sqrtf(1.0f + m11 - m00 - m22) * 2.0f;
+			return Quat((m01 + m10) / s, 0.25f * s, (m12 + m21) / s, (m02 - m20) / s);
+		}
+		else
+		{
+			float s = sqrtf(1.0f + m22 - m00 - m11) * 2.0f;
+			return Quat((m02 + m20) / s, (m12 + m21) / s, 0.25f * s, (m10 - m01) / s);
+		}
+	}
+
+	Quat Quat::FromTo(const Vec3& from, const Vec3& to)
+	{
+		Vec3 a = from.Normalize();
+		Vec3 b = to.Normalize();
+		float dot = a.Dot(b);
+
+		// Opposite directions: any perpendicular axis works
+		if (dot < -1.0f + 1e-6f)
+		{
+			Vec3 axis = a.Perpendicular();
+			return Quat(axis.x, axis.y, axis.z, 0.0f);
+		}
+
+		// Half-angle trick: (a x b, 1 + a.b) normalized avoids acos and sin
+		Vec3 axis = a.Cross(b);
+		return Quat(axis.x, axis.y, axis.z, 1.0f + dot).Normalize();
+	}
+
+	Mat3 Quat::ToMat3() const
+	{
+		float xx = x * x, yy = y * y, zz = z * z;
+		float xy = x * y, xz = x * z, yz = y * z;
+		float wx = w * x, wy = w * y, wz = w * z;
+
+		return Mat3(
+			Vec3(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy)),
+			Vec3(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)),
+			Vec3(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy)));
+	}
+
+	void Quat::ToAxisAngle(Vec3& axis, float& radians) const
+	{
+		Quat q = w < 0.0f ? Quat(-x, -y, -z, -w) : *this;
+		float sinHalf = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z);
+		if (sinHalf > 0.0f)
+		{
+			axis = Vec3(q.x / sinHalf, q.y / sinHalf, q.z / sinHalf);
+			radians = 2.0f * atan2f(sinHalf, q.w);
+		}
+		else
+		{
+			axis = Vec3::UnitX();
+			radians = 0.0f;
+		}
+	}
+
+	Quat Quat::Slerp(const Quat& a, const Quat& b, float t)
+	{
+		float cosAngle = a.Dot(b);
+		Quat target = b;
+		if (cosAngle < 0.0f)
+		{
+			cosAngle = -cosAngle;
+			target = Quat(-b.x, -b.y, -b.z, -b.w);
+		}
+
+		// Nearly parallel: sin(angle) vanishes and nlerp is indistinguishable
+		if (cosAngle > 0.9995f)
+		{
+			return Nlerp(a, target, t);
+		}
+
+		float angle = acosf(cosAngle);
+		float inverseSin = 1.0f / sinf(angle);
+		float weightA = sinf((1.0f - t) * angle) * inverseSin;
+		float weightB = sinf(t * angle) * inverseSin;
+
+		#if RUNDEE_SIMD_SSE2
+		return Quat(SimdMulAdd(a.Load(), _mm_set1_ps(weightA), _mm_mul_ps(target.Load(), _mm_set1_ps(weightB))));
+		#else
+		return Quat(
+			a.x * weightA + target.x * weightB,
+			a.y * weightA + target.y * weightB,
+			a.z * weightA + target.z * weightB,
+			a.w * weightA + target.w * weightB);
+		#endif
+	}
+
+	Quat Quat::Nlerp(const Quat& a, const Quat& b, float t)
+	{
+		#if RUNDEE_SIMD_SSE2
+		__m128 from = a.Load();
+		__m128 to = b.Load();
+		// Flip b onto a's hemisphere by xoring in the sign bit of the dot product
+		__m128 sign = _mm_and_ps(SimdSum(_mm_mul_ps(from, to)), _mm_set1_ps(-0.0f));
+		to = _mm_xor_ps(to, sign);
+		return Quat(SimdMulAdd(_mm_sub_ps(to, from), _mm_set1_ps(t), from)).Normalize();
+		#else
+		float sign = a.Dot(b) < 0.0f ? -1.0f : 1.0f;
+		return Quat(
+			a.x + t * (b.x * sign - a.x),
+			a.y + t * (b.y * sign - a.y),
+			a.z + t * (b.z * sign - a.z),
+			a.w + t * (b.w * sign - a.w)).Normalize();
+		#endif
+	}
+
+	// Converting once to a matrix makes each vector nine multiply-adds
+	void Quat::RotateVectors(const Quat& rotation, const Vec3* vectors, Vec3* out, size_t count)
+	{
+		Mat3::TransformVectors(rotation.ToMat3(), vectors, out, count);
+	}
+}
@@ -0,0 +1,366 @@
+//Project Name: RundeeEngine
+//File Name: Random.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Pseudo-random number generators implementation file
+
+#include "../../include/RundeeEngine/Math/Random.h"
+#include "../../include/RundeeEngine/Math/FastMath.h"
+#include "../../include/RundeeEngine/Math/SIMD.h"
+#include <algorithm>
+#include <cstring>
+
+namespace RundeeEngine
+{
+	static uint64_t SplitMix64(uint64_t& state)
+	{
+		uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	// Lemire's multiply-and-reject: unbiased, and the rejection branch is rarely taken
+	template<typename Generator>
+	static uint32_t BoundedUInt32(Generator& generator, uint32_t bound)
+	{
+		uint64_t product = static_cast<uint64_t>(generator.NextUInt32()) * bound;
+		uint32_t low = static_cast<uint32_t>(product);
+		if (low < bound)
+		{
+			uint32_t threshold = (0u - bound) % bound;
+			while (low < threshold)
+			{
+				product = static_cast<uint64_t>(generator.NextUInt32()) * bound;
+				low = static_cast<uint32_t>(product);
+			}
+		}
+		return static_cast<uint32_t>(product >> 32);
+	}
+
+	template<typename Generator>
+	static int32_t BoundedInt32(Generator& generator, int32_t min, int32_t max)
+	{
+		uint32_t range = static_cast<uint32_t>(max) - static_cast<uint32_t>(min) + 1;
+		uint32_t offset = range == 0 ? generator.NextUInt32() : BoundedUInt32(generator, range);
+		return static_cast<int32_t>(static_cast<uint32_t>(min) + offset);
+	}
+
+	//----------Pcg32 Implementation----------
+
+	static constexpr uint64_t PcgMultiplier = 6364136223846793005ull;
+
+	Pcg32::Pcg32(uint64_t seed, uint64_t stream)
+		: m_State(0)
+		, m_Increment((stream << 1) | 1)
+	{
+		NextUInt32();
+		m_State += seed;
+		NextUInt32();
+	}
+
+	uint32_t Pcg32::NextUInt32(uint32_t bound)
+	{
+		return BoundedUInt32(*this, bound);
+	}
+
+	int32_t Pcg32::NextInt(int32_t min, int32_t max)
+	{
+		return BoundedInt32(*this, min, max);
+	}
+
+	// Brown, "Random Number Generation with Arbitrary Strides": the LCG step
+	// composed with itself by squaring, so a delta of -1 is 2^64 - 1 steps
+	void Pcg32::Advance(int64_t delta)
+	{
+		uint64_t steps = static_cast<uint64_t>(delta);
+		uint64_t accumulatedMultiplier = 1;
+		uint64_t accumulatedIncrement = 0;
+		uint64_t multiplier = PcgMultiplier;
+		uint64_t increment = m_Increment;
+
+		while (steps > 0)
+		{
+			if (steps & 1)
+			{
+				accumulatedMultiplier *= multiplier;
+				accumulatedIncrement = accumulatedIncrement * multiplier + increment;
+			}
+			increment = (multiplier + 1) * increment;
+			multiplier *= multiplier;
+			steps >>= 1;
+		}
+		m_State = accumulatedMultiplier * m_State + accumulatedIncrement;
+	}
+
+	//----------Xoshiro256 Implementation----------
+
+	Xoshiro256::Xoshiro256(uint64_t seed)
+	{
+		for (uint64_t& word : m_State)
+		{
+			word = SplitMix64(seed);
+		}
+	}
+
+	uint32_t Xoshiro256::NextUInt32(uint32_t bound)
+	{
+		return BoundedUInt32(*this, bound);
+	}
+
+	int32_t Xoshiro256::NextInt(int32_t min, int32_t max)
+	{
+		return BoundedInt32(*this, min, max);
+	}
+
+	void Xoshiro256::Jump()
+	{
+		static constexpr uint64_t JumpPolynomial[4] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+		ApplyJump(JumpPolynomial);
+	}
+
+	void Xoshiro256::LongJump()
+	{
+		static constexpr uint64_t LongJumpPolynomial[4] = { 0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull };
+		ApplyJump(LongJumpPolynomial);
+	}
+
+	void Xoshiro256::ApplyJump(const uint64_t (&polynomial)[4])
+	{
+		uint64_t jumped[4] = { 0, 0, 0, 0 };
+		for (uint64_t word : polynomial)
+		{
+			for (int bit = 0; bit < 64; ++bit)
+			{
+				if (word & (static_cast<uint64_t>(1) << bit))
+				{
+					for (int i = 0; i < 4; ++i)
+					{
+						jumped[i] ^= m_State[i];
+					}
+				}
+				NextUInt64();
+			}
+		}
+		memcpy(m_State, jumped, sizeof(m_State));
+	}
+
+	Xoshiro256 Xoshiro256::ForStream(uint64_t seed, uint32_t stream)
+	{
+		Xoshiro256 generator(seed);
+		for (uint32_t i = 0; i < stream; ++i)
+		{
+			generator.Jump();
+		}
+		return generator;
+	}
+
+	//----------RandomStream Implementation----------
+
+	RandomStream::RandomStream(uint64_t seed, uint64_t stream)
+	{
+		uint64_t state = seed ^ (stream * 0xD1B54A32D192ED03ull);
+		for (size_t word = 0; word < 4; ++word)
+		{
+			for (size_t lane = 0; lane < LaneCount; lane += 2)
+			{
+				uint64_t value = SplitMix64(state);
+				m_State[word][lane] = static_cast<uint32_t>(value);
+				m_State[word][lane + 1] = static_cast<uint32_t>(value >> 32);
+			}
+		}
+	}
+
+	// xoshiro128** per lane. Multiplies by 5 and 9 are shift-adds, so SSE2
+	// needs no 32-bit multiply.
+	void RandomStream::NextBlocks(uint32_t* out, size_t blockCount)
+	{
+#if RUNDEE_SIMD_AVX2
+		__m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_State[0]));
+		__m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_State[1]));
+		__m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_State[2]));
+		__m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_State[3]));
+		for (size_t block = 0; block < blockCount; ++block)
+		{
+			__m256i times5 = _mm256_add_epi32(_mm256_slli_epi32(s1, 2), s1);
+			__m256i rotated = _mm256_or_si256(_mm256_slli_epi32(times5, 7), _mm256_srli_epi32(times5, 25));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + block * LaneCount), _mm256_add_epi32(_mm256_slli_epi32(rotated, 3), rotated));
+
+			__m256i t = _mm256_slli_epi32(s1, 9);
+			s2 = _mm256_xor_si256(s2, s0);
+			s3 = _mm256_xor_si256(s3, s1);
+			s1 = _mm256_xor_si256(s1, s2);
+			s0 = _mm256_xor_si256(s0, s3);
+			s2 = _mm256_xor_si256(s2, t);
+			s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+		}
+		_mm256_store_si256(reinterpret_cast<__m256i*>(m_State[0]), s0);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(m_State[1]), s1);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(m_State[2]), s2);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(m_State[3]), s3);
+#elif RUNDEE_SIMD_SSE2
+		for (size_t half = 0; half < LaneCount; half += 4)
+		{
+			__m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(m_State[0] + half));
+			__m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(m_State[1] + half));
+			__m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(m_State[2] + half));
+			__m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(m_State[3] + half));
+			for (size_t block = 0; block < blockCount; ++block)
+			{
+				__m128i times5 = _mm_add_epi32(_mm_slli_epi32(s1, 2), s1);
+				__m128i rotated = _mm_or_si128(_mm_slli_epi32(times5, 7), _mm_srli_epi32(times5, 25));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + block * LaneCount + half), _mm_add_epi32(_mm_slli_epi32(rotated, 3), rotated));
+
+				__m128i t = _mm_slli_epi32(s1, 9);
+				s2 = _mm_xor_si128(s2, s0);
+				s3 = _mm_xor_si128(s3, s1);
+				s1 = _mm_xor_si128(s1, s2);
+				s0 = _mm_xor_si128(s0, s3);
+				s2 = _mm_xor_si128(s2, t);
+				s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+			}
+			_mm_store_si128(reinterpret_cast<__m128i*>(m_State[0] + half), s0);
+			_mm_store_si128(reinterpret_cast<__m128i*>(m_State[1] + half), s1);
+			_mm_store_si128(reinterpret_cast<__m128i*>(m_State[2] + half), s2);
+			_mm_store_si128(reinterpret_cast<__m128i*>(m_State[3] + half), s3);
+		}
+#else
+		for (size_t block = 0; block < blockCount; ++block)
+		{
+			for (size_t lane = 0; lane < LaneCount; ++lane)
+			{
+				uint32_t s1 = m_State[1][lane];
+				uint32_t times5 = s1 * 5;
+				out[block * LaneCount + lane] = ((times5 << 7) | (times5 >> 25)) * 9;
+
+				uint32_t t = s1 << 9;
+				m_State[2][lane] ^= m_State[0][lane];
+				m_State[3][lane] ^= s1;
+				m_State[1][lane] ^= m_State[2][lane];
+				m_State[0][lane] ^= m_State[3][lane];
+				m_State[2][lane] ^= t;
+				m_State[3][lane] = (m_State[3][lane] << 11) | (m_State[3][lane] >> 21);
+			}
+		}
+#endif
+	}
+
+	void RandomStream::FillUInt32(uint32_t* out, size_t count)
+	{
+		size_t fullBlocks = count / LaneCount;
+		NextBlocks(out, fullBlocks);
+
+		size_t remaining = count - fullBlocks * LaneCount;
+		if (remaining > 0)
+		{
+			uint32_t block[LaneCount];
+			NextBlocks(block, 1);
+			memcpy(out + fullBlocks * LaneCount, block, remaining * sizeof(uint32_t));
+		}
+	}
+
+	// Filled and converted a cache-sized chunk at a time
+	static constexpr size_t FillChunkSize = 1024;
+
+	void RandomStream::FillFloat(float* out, size_t count)
+	{
+		FillFloat(out, count, 0.0f, 1.0f);
+	}
+
+	void RandomStream::FillFloat(float* out, size_t count, float min, float max)
+	{
+		for (size_t begin = 0; begin < count; begin += FillChunkSize)
+		{
+			size_t size = std::min(FillChunkSize, count - begin);
+			float* chunk = out + begin;
+			FillUInt32(reinterpret_cast<uint32_t*>(chunk), size);
+
+			// The top 24 bits convert to float exactly
+			SimdForEach(size, [&](auto lane, size_t i)
+			{
+				using L = decltype(lane);
+				typename L::Type unit = L::Mul(L::IntToFloat(L::template IntShiftRight<8>(L::AsInt(L::Load(chunk + i)))), L::Set(1.0f / 16777216.0f));
+				L::Store(chunk + i, L::MulAdd(unit, L::Set(max - min), L::Set(min)));
+			});
+		}
+	}
+
+	void RandomStream::FillInt(int32_t* out, size_t count, int32_t min, int32_t max)
+	{
+		uint32_t range = static_cast<uint32_t>(max) - static_cast<uint32_t>(min) + 1;
+		uint32_t* values = reinterpret_cast<uint32_t*>(out);
+		FillUInt32(values, count);
+		if (range == 0)
+		{
+			return;
+		}
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			uint32_t offset = static_cast<uint32_t>((static_cast<uint64_t>(values[i]) * range) >> 32);
+			values[i] = static_cast<uint32_t>(min) + offset;
+		}
+	}
+
+	void RandomStream::FillUnitVec2(float* outX, float* outY, size_t count)
+	{
+		FillFloat(outX, count, 0.0f, 6.28318530717958648f);
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			typename L::Type s, c;
+			FastMath::SinCos<L>(L::Load(outX + i), s, c);
+			L::Store(outX + i, c);
+			L::Store(outY + i, s);
+		});
+	}
+
+	// Archimedes: z uniform in [-1, 1] and a uniform angle around it give a
+	// uniform point on the sphere
+	void RandomStream::FillUnitVec3(float* outX, float* outY, float* outZ, size_t count)
+	{
+		FillFloat(outX, count, 0.0f, 6.28318530717958648f);
+		FillFloat(outZ, count, -1.0f, 1.0f);
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			typename L::Type z = L::Load(outZ + i);
+			typename L::Type radius = L::Sqrt(L::Max(L::Sub(L::Set(1.0f), L::Mul(z, z)), L::Set(0.0f)));
+			typename L::Type s, c;
+			FastMath::SinCos<L>(L::Load(outX + i), s, c);
+			L::Store(outX + i, L::Mul(c, radius));
+			L::Store(outY + i, L::Mul(s, radius));
+		});
+	}
+
+	//----------Random Implementation----------
+
+	std::atomic<uint64_t> Random::s_Seed(0x9E3779B97F4A7C15ull);
+	std::atomic<uint32_t> Random::s_Generation(0);
+	std::atomic<uint32_t> Random::s_ThreadCount(0);
+
+	void Random::SetSeed(uint64_t seed)
+	{
+		s_Seed.store(seed, std::memory_order_relaxed);
+		s_Generation.fetch_add(1, std::memory_order_release);
+	}
+
+	Xoshiro256& Random::ThreadLocal()
+	{
+		struct ThreadState
+		{
+			Xoshiro256 Generator;
+			uint32_t Generation = UINT32_MAX;
+			uint32_t Index = s_ThreadCount.fetch_add(1, std::memory_order_relaxed);
+		};
+		static thread_local ThreadState t_State;
+
+		uint32_t generation = s_Generation.load(std::memory_order_acquire);
+		if (t_State.Generation != generation)
+		{
+			t_State.Generator = Xoshiro256::ForStream(s_Seed.load(std::memory_order_relaxed), t_State.Index);
+			t_State.Generation = generation;
+		}
+		return t_State.Generator;
+	}
+}
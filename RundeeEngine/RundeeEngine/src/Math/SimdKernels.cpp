@@ -0,0 +1,71 @@
+//Project Name: RundeeEngine
+//File Name: SimdKernels.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Runtime-dispatched SIMD kernel tables implementation file
+
+#include "../../include/RundeeEngine/Math/SimdKernels.h"
+#include <atomic>
+
+namespace RundeeEngine
+{
+	// One per SimdKernels<Level>.cpp, nullptr when that file was not built for its level
+	const SimdKernelTable* GetSimdKernelsScalar();
+	const SimdKernelTable* GetSimdKernelsSSE2();
+	const SimdKernelTable* GetSimdKernelsAVX2();
+
+	static std::atomic<const SimdKernelTable*> s_BoundTable{ nullptr };
+
+	const SimdKernelTable& SimdKernels::Get()
+	{
+		const SimdKernelTable* table = s_BoundTable.load(std::memory_order_acquire);
+		if (!table)
+		{
+			ResetLevel();
+			table = s_BoundTable.load(std::memory_order_acquire);
+		}
+		return *table;
+	}
+
+	const SimdKernelTable& SimdKernels::GetReference()
+	{
+		return *GetSimdKernelsScalar();
+	}
+
+	const SimdKernelTable* SimdKernels::GetTable(SimdLevel level)
+	{
+		if (level > CPUFeatures::GetDetectedLevel())
+		{
+			return nullptr;
+		}
+
+		switch (level)
+		{
+		case SimdLevel::Scalar: return GetSimdKernelsScalar();
+		case SimdLevel::SSE2:
+		case SimdLevel::SSE42: return GetSimdKernelsSSE2();
+		case SimdLevel::AVX2:
+		case SimdLevel::AVX512: return GetSimdKernelsAVX2();
+		}
+		return nullptr;
+	}
+
+	SimdLevel SimdKernels::SetLevel(SimdLevel level)
+	{
+		static constexpr SimdLevel Levels[] = { SimdLevel::AVX2, SimdLevel::SSE2 };
+
+		const SimdKernelTable* table = GetSimdKernelsScalar();
+		for (SimdLevel candidate : Levels)
+		{
+			const SimdKernelTable* candidateTable = candidate <= level ? GetTable(candidate) : nullptr;
+			if (candidateTable)
+			{
+				table = candidateTable;
+				break;
+			}
+		}
+
+		s_BoundTable.store(table, std::memory_order_release);
+		return table->Level;
+	}
+}
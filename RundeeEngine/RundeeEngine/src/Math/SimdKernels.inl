@@ -0,0 +1,746 @@
+//Project Name: RundeeEngine
+//File Name: SimdKernels.inl
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: SIMD kernel bodies shared by every instruction set file
+
+// Included once by each SimdKernels<Level>.cpp after SIMD.h and
+// SimdKernels.h. SIMD.h has already picked the lane types for the file's
+// instruction set, so the same source compiles to each variant.
+
+#include "../../include/RundeeEngine/Math/FastMath.h"
+#include "../../include/RundeeEngine/Math/Noise.h"
+#include "../../include/RundeeEngine/Math/Packing.h"
+#include "NoiseLanes.inl"
+#include "PackingLanes.inl"
+
+namespace RundeeEngine
+{
+	#if RUNDEE_SIMD_AVX2
+	static constexpr SimdLevel KernelLevel = SimdLevel::AVX2;
+	static constexpr const char* KernelName = "avx2";
+	#elif RUNDEE_SIMD_SSE2
+	static constexpr SimdLevel KernelLevel = SimdLevel::SSE2;
+	static constexpr const char* KernelName = "sse2";
+	#else
+	static constexpr SimdLevel KernelLevel = SimdLevel::Scalar;
+	static constexpr const char* KernelName = "scalar";
+	#endif
+
+	//----------Vec3 kernels----------
+
+	static void Vec3Add(SimdVec3In a, SimdVec3In b, SimdVec3Out out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out.X + i, L::Add(L::Load(a.X + i), L::Load(b.X + i)));
+			L::Store(out.Y + i, L::Add(L::Load(a.Y + i), L::Load(b.Y + i)));
+			L::Store(out.Z + i, L::Add(L::Load(a.Z + i), L::Load(b.Z + i)));
+		});
+	}
+
+	static void Vec3Subtract(SimdVec3In a, SimdVec3In b, SimdVec3Out out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out.X + i, L::Sub(L::Load(a.X + i), L::Load(b.X + i)));
+			L::Store(out.Y + i, L::Sub(L::Load(a.Y + i), L::Load(b.Y + i)));
+			L::Store(out.Z + i, L::Sub(L::Load(a.Z + i), L::Load(b.Z + i)));
+		});
+	}
+
+	static void Vec3Scale(SimdVec3In a, float scalar, SimdVec3Out out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto s = L::Set(scalar);
+			L::Store(out.X + i, L::Mul(L::Load(a.X + i), s));
+			L::Store(out.Y + i, L::Mul(L::Load(a.Y + i), s));
+			L::Store(out.Z + i, L::Mul(L::Load(a.Z + i), s));
+		});
+	}
+
+	static void Vec3MulAdd(SimdVec3In a, SimdVec3In b, float scalar, SimdVec3Out out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto s = L::Set(scalar);
+			L::Store(out.X + i, L::MulAdd(L::Load(b.X + i), s, L::Load(a.X + i)));
+			L::Store(out.Y + i, L::MulAdd(L::Load(b.Y + i), s, L::Load(a.Y + i)));
+			L::Store(out.Z + i, L::MulAdd(L::Load(b.Z + i), s, L::Load(a.Z + i)));
+		});
+	}
+
+	static void Vec3Lerp(SimdVec3In a, SimdVec3In b, float t, SimdVec3Out out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto s = L::Set(t);
+			auto x = L::Load(a.X + i);
+			auto y = L::Load(a.Y + i);
+			auto z = L::Load(a.Z + i);
+			L::Store(out.X + i, L::MulAdd(L::Sub(L::Load(b.X + i), x), s, x));
+			L::Store(out.Y + i, L::MulAdd(L::Sub(L::Load(b.Y + i), y), s, y));
+			L::Store(out.Z + i, L::MulAdd(L::Sub(L::Load(b.Z + i), z), s, z));
+		});
+	}
+
+	static void Vec3Normalize(SimdVec3In a, SimdVec3Out out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto x = L::Load(a.X + i);
+			auto y = L::Load(a.Y + i);
+			auto z = L::Load(a.Z + i);
+			auto lengthSquared = L::MulAdd(z, z, L::MulAdd(y, y, L::Mul(x, x)));
+			// rsqrt(0) is infinity; the mask turns the resulting NaNs back into zero
+			auto inverseLength = L::KeepWherePositive(L::RSqrt(lengthSquared), lengthSquared);
+			L::Store(out.X + i, L::Mul(x, inverseLength));
+			L::Store(out.Y + i, L::Mul(y, inverseLength));
+			L::Store(out.Z + i, L::Mul(z, inverseLength));
+		});
+	}
+
+	static void Vec3Dot(SimdVec3In a, SimdVec3In b, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto result = L::Mul(L::Load(a.X + i), L::Load(b.X + i));
+			result = L::MulAdd(L::Load(a.Y + i), L::Load(b.Y + i), result);
+			result = L::MulAdd(L::Load(a.Z + i), L::Load(b.Z + i), result);
+			L::Store(out + i, result);
+		});
+	}
+
+	static void Vec3Length(SimdVec3In a, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto x = L::Load(a.X + i);
+			auto y = L::Load(a.Y + i);
+			auto z = L::Load(a.Z + i);
+			L::Store(out + i, L::Sqrt(L::MulAdd(z, z, L::MulAdd(y, y, L::Mul(x, x)))));
+		});
+	}
+
+	static void Vec3LengthSquared(SimdVec3In a, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto x = L::Load(a.X + i);
+			auto y = L::Load(a.Y + i);
+			auto z = L::Load(a.Z + i);
+			L::Store(out + i, L::MulAdd(z, z, L::MulAdd(y, y, L::Mul(x, x))));
+		});
+	}
+
+	static void Vec3Distance(SimdVec3In a, SimdVec3In b, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto x = L::Sub(L::Load(a.X + i), L::Load(b.X + i));
+			auto y = L::Sub(L::Load(a.Y + i), L::Load(b.Y + i));
+			auto z = L::Sub(L::Load(a.Z + i), L::Load(b.Z + i));
+			L::Store(out + i, L::Sqrt(L::MulAdd(z, z, L::MulAdd(y, y, L::Mul(x, x)))));
+		});
+	}
+
+	//----------Culling kernels----------
+
+	static void FrustumSpheres(const float* planes, SimdVec3In centers, const float* radius, uint8_t* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto x = L::Load(centers.X + i);
+			auto y = L::Load(centers.Y + i);
+			auto z = L::Load(centers.Z + i);
+			auto r = L::Load(radius + i);
+			auto zero = L::Set(0.0f);
+			auto inside = L::CmpEq(zero, zero);
+
+			for (const float* plane = planes; plane != planes + 24; plane += 4)
+			{
+				auto distance = L::MulAdd(L::Set(plane[0]), x, L::Set(plane[3]));
+				distance = L::MulAdd(L::Set(plane[1]), y, distance);
+				distance = L::MulAdd(L::Set(plane[2]), z, distance);
+				inside = L::And(inside, L::CmpLe(zero, L::Add(distance, r)));
+			}
+			L::StoreMask(out + i, inside);
+		});
+	}
+
+	static void FrustumBoxes(const float* planes, SimdVec3In mins, SimdVec3In maxs, uint8_t* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto half = L::Set(0.5f);
+			auto minX = L::Load(mins.X + i), maxX = L::Load(maxs.X + i);
+			auto minY = L::Load(mins.Y + i), maxY = L::Load(maxs.Y + i);
+			auto minZ = L::Load(mins.Z + i), maxZ = L::Load(maxs.Z + i);
+			auto centerX = L::Mul(L::Add(minX, maxX), half), extentX = L::Mul(L::Sub(maxX, minX), half);
+			auto centerY = L::Mul(L::Add(minY, maxY), half), extentY = L::Mul(L::Sub(maxY, minY), half);
+			auto centerZ = L::Mul(L::Add(minZ, maxZ), half), extentZ = L::Mul(L::Sub(maxZ, minZ), half);
+			auto zero = L::Set(0.0f);
+			auto inside = L::CmpEq(zero, zero);
+
+			for (const float* plane = planes; plane != planes + 24; plane += 4)
+			{
+				auto distance = L::MulAdd(L::Set(plane[0]), centerX, L::Set(plane[3]));
+				distance = L::MulAdd(L::Set(plane[1]), centerY, distance);
+				distance = L::MulAdd(L::Set(plane[2]), centerZ, distance);
+				distance = L::MulAdd(L::Abs(L::Set(plane[0])), extentX, distance);
+				distance = L::MulAdd(L::Abs(L::Set(plane[1])), extentY, distance);
+				distance = L::MulAdd(L::Abs(L::Set(plane[2])), extentZ, distance);
+				inside = L::And(inside, L::CmpLe(zero, distance));
+			}
+			L::StoreMask(out + i, inside);
+		});
+	}
+
+	static void OverlapRects(const float* query, SimdVec2In mins, SimdVec2In maxs, uint8_t* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto hit = L::And(L::CmpLe(L::Load(mins.X + i), L::Set(query[2])), L::CmpLe(L::Set(query[0]), L::Load(maxs.X + i)));
+			hit = L::And(hit, L::CmpLe(L::Load(mins.Y + i), L::Set(query[3])));
+			hit = L::And(hit, L::CmpLe(L::Set(query[1]), L::Load(maxs.Y + i)));
+			L::StoreMask(out + i, hit);
+		});
+	}
+
+	static void OverlapBoxes(const float* query, SimdVec3In mins, SimdVec3In maxs, uint8_t* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto hit = L::And(L::CmpLe(L::Load(mins.X + i), L::Set(query[3])), L::CmpLe(L::Set(query[0]), L::Load(maxs.X + i)));
+			hit = L::And(hit, L::CmpLe(L::Load(mins.Y + i), L::Set(query[4])));
+			hit = L::And(hit, L::CmpLe(L::Set(query[1]), L::Load(maxs.Y + i)));
+			hit = L::And(hit, L::CmpLe(L::Load(mins.Z + i), L::Set(query[5])));
+			hit = L::And(hit, L::CmpLe(L::Set(query[2]), L::Load(maxs.Z + i)));
+			L::StoreMask(out + i, hit);
+		});
+	}
+
+	static void OverlapSpheres(const float* query, SimdVec3In centers, const float* radius, uint8_t* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto dx = L::Sub(L::Load(centers.X + i), L::Set(query[0]));
+			auto dy = L::Sub(L::Load(centers.Y + i), L::Set(query[1]));
+			auto dz = L::Sub(L::Load(centers.Z + i), L::Set(query[2]));
+			auto radii = L::Add(L::Load(radius + i), L::Set(query[3]));
+			auto distanceSquared = L::MulAdd(dz, dz, L::MulAdd(dy, dy, L::Mul(dx, dx)));
+			L::StoreMask(out + i, L::CmpLe(distanceSquared, L::Mul(radii, radii)));
+		});
+	}
+
+	// Min and Max return their second operand when either is NaN (0 * infinity
+	// for an origin on a slab plane), so the running interval goes second to survive it
+	static void RayBoxes(const float* ray, SimdVec3In mins, SimdVec3In maxs, float maxDistance, uint8_t* out, float* outDistances, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			auto tNear = L::Set(0.0f);
+			auto tFar = L::Set(maxDistance);
+
+			auto originX = L::Set(ray[0]), inverseX = L::Set(ray[3]);
+			auto t1 = L::Mul(L::Sub(L::Load(mins.X + i), originX), inverseX);
+			auto t2 = L::Mul(L::Sub(L::Load(maxs.X + i), originX), inverseX);
+			tNear = L::Max(L::Min(t1, t2), tNear);
+			tFar = L::Min(L::Max(t1, t2), tFar);
+
+			auto originY = L::Set(ray[1]), inverseY = L::Set(ray[4]);
+			t1 = L::Mul(L::Sub(L::Load(mins.Y + i), originY), inverseY);
+			t2 = L::Mul(L::Sub(L::Load(maxs.Y + i), originY), inverseY);
+			tNear = L::Max(L::Min(t1, t2), tNear);
+			tFar = L::Min(L::Max(t1, t2), tFar);
+
+			auto originZ = L::Set(ray[2]), inverseZ = L::Set(ray[5]);
+			t1 = L::Mul(L::Sub(L::Load(mins.Z + i), originZ), inverseZ);
+			t2 = L::Mul(L::Sub(L::Load(maxs.Z + i), originZ), inverseZ);
+			tNear = L::Max(L::Min(t1, t2), tNear);
+			tFar = L::Min(L::Max(t1, t2), tFar);
+
+			L::StoreMask(out + i, L::CmpLe(tNear, tFar));
+			if (outDistances)
+			{
+				L::Store(outDistances + i, tNear);
+			}
+		});
+	}
+
+	//----------FastMath kernels----------
+
+	static void FastSin(const float* x, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, FastMath::Sin<L>(L::Load(x + i)));
+		});
+	}
+
+	static void FastCos(const float* x, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, FastMath::Cos<L>(L::Load(x + i)));
+		});
+	}
+
+	static void FastSinCos(const float* x, float* outSin, float* outCos, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			typename L::Type s, c;
+			FastMath::SinCos<L>(L::Load(x + i), s, c);
+			L::Store(outSin + i, s);
+			L::Store(outCos + i, c);
+		});
+	}
+
+	static void FastAtan2(const float* y, const float* x, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, FastMath::Atan2<L>(L::Load(y + i), L::Load(x + i)));
+		});
+	}
+
+	static void FastRSqrt(const float* x, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, L::RSqrt(L::Load(x + i)));
+		});
+	}
+
+	static void FastExp(const float* x, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, FastMath::Exp<L>(L::Load(x + i)));
+		});
+	}
+
+	static void FastLog(const float* x, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, FastMath::Log<L>(L::Load(x + i)));
+		});
+	}
+
+	//----------Noise kernels----------
+
+	static void NoiseRow2D(const NoiseSettings& settings, const float* x, float y, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, Sample2DLanes<L>(settings, L::Load(x + i), L::Set(y)));
+		});
+	}
+
+	static void NoiseRow3D(const NoiseSettings& settings, const float* x, float y, float z, float* out, size_t count)
+	{
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::Store(out + i, Sample3DLanes<L>(settings, L::Load(x + i), L::Set(y), L::Set(z)));
+		});
+	}
+
+	//----------Packing kernels----------
+
+	// The single-value conversions are out of line in Packing.cpp, so the
+	// tails here take whichever conversion the baseline build compiled
+	static void FloatToHalf(const float* in, uint16_t* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_F16C
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = Packing::FloatToHalf(in[i]);
+		}
+	}
+
+	static void HalfToFloat(const uint16_t* in, float* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_F16C
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = Packing::HalfToFloat(in[i]);
+		}
+	}
+
+	// Packing::Quantize restated: an inline function from Packing.h compiled
+	// into the AVX2 file could replace the baseline copy (see SimdKernelsAVX2.cpp)
+	static int32_t QuantizeOne(float value, float min, float max, float scale)
+	{
+		return static_cast<int32_t>(lrintf(fminf(fmaxf(value, min), max) * scale));
+	}
+
+	#if RUNDEE_SIMD_AVX2
+	// Eight clamped, scaled and rounded values
+	static __m256i QuantizeEight(const float* in, float min, float max, float scale)
+	{
+		__m256 clamped = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in), _mm256_set1_ps(min)), _mm256_set1_ps(max));
+		return _mm256_cvtps_epi32(_mm256_mul_ps(clamped, _mm256_set1_ps(scale)));
+	}
+
+	// Eight int32 lanes to floats, with snorm's -max - 1 clamped to -1
+	static void StoreEight(float* out, __m256i values, float scale, float min)
+	{
+		_mm256_storeu_ps(out, _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(values), _mm256_set1_ps(scale)), _mm256_set1_ps(min)));
+	}
+
+	// The 256-bit packs work within each 128-bit half; these put the
+	// results of packing sixteen (words) or thirty-two (bytes) values back in order
+	static __m256i OrderPackedWords(__m256i packed)
+	{
+		return _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+	}
+
+	static __m256i OrderPackedBytes(__m256i packed)
+	{
+		return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+	}
+	#endif
+
+	#if RUNDEE_SIMD_SSE2
+	// Four clamped, scaled and rounded values; packs saturate but never need to
+	static __m128i QuantizeFour(const float* in, float min, float max, float scale)
+	{
+		__m128 clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in), _mm_set1_ps(min)), _mm_set1_ps(max));
+		return _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(scale)));
+	}
+
+	// Four int32 lanes to floats, with snorm's -max - 1 clamped to -1
+	static void StoreFour(float* out, __m128i values, float scale, float min)
+	{
+		_mm_storeu_ps(out, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(values), _mm_set1_ps(scale)), _mm_set1_ps(min)));
+	}
+	#endif
+
+	static void PackSnorm16(const float* in, int16_t* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_AVX2
+		for (; i + 16 <= count; i += 16)
+		{
+			__m256i packed = _mm256_packs_epi32(QuantizeEight(in + i, -1.0f, 1.0f, 32767.0f), QuantizeEight(in + i + 8, -1.0f, 1.0f, 32767.0f));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), OrderPackedWords(packed));
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i packed = _mm_packs_epi32(QuantizeFour(in + i, -1.0f, 1.0f, 32767.0f), QuantizeFour(in + i + 4, -1.0f, 1.0f, 32767.0f));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = static_cast<int16_t>(QuantizeOne(in[i], -1.0f, 1.0f, 32767.0f));
+		}
+	}
+
+	static void UnpackSnorm16(const int16_t* in, float* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_AVX2
+		for (; i + 8 <= count; i += 8)
+		{
+			StoreEight(out + i, _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))), 1.0f / 32767.0f, -1.0f);
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+			StoreFour(out + i, _mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16), 1.0f / 32767.0f, -1.0f);
+			StoreFour(out + i + 4, _mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16), 1.0f / 32767.0f, -1.0f);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = fmaxf(static_cast<float>(in[i]) * (1.0f / 32767.0f), -1.0f);
+		}
+	}
+
+	static void PackSnorm8(const float* in, int8_t* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_AVX2
+		for (; i + 32 <= count; i += 32)
+		{
+			__m256i low = _mm256_packs_epi32(QuantizeEight(in + i, -1.0f, 1.0f, 127.0f), QuantizeEight(in + i + 8, -1.0f, 1.0f, 127.0f));
+			__m256i high = _mm256_packs_epi32(QuantizeEight(in + i + 16, -1.0f, 1.0f, 127.0f), QuantizeEight(in + i + 24, -1.0f, 1.0f, 127.0f));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), OrderPackedBytes(_mm256_packs_epi16(low, high)));
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i low = _mm_packs_epi32(QuantizeFour(in + i, -1.0f, 1.0f, 127.0f), QuantizeFour(in + i + 4, -1.0f, 1.0f, 127.0f));
+			__m128i high = _mm_packs_epi32(QuantizeFour(in + i + 8, -1.0f, 1.0f, 127.0f), QuantizeFour(in + i + 12, -1.0f, 1.0f, 127.0f));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi16(low, high));
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = static_cast<int8_t>(QuantizeOne(in[i], -1.0f, 1.0f, 127.0f));
+		}
+	}
+
+	static void UnpackSnorm8(const int8_t* in, float* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_AVX2
+		for (; i + 8 <= count; i += 8)
+		{
+			StoreEight(out + i, _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i))), 1.0f / 127.0f, -1.0f);
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		for (; i + 16 <= count; i += 16)
+		{
+			// Duplicating bytes twice puts each value in the top byte of a lane
+			__m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+			__m128i low = _mm_unpacklo_epi8(values, values);
+			__m128i high = _mm_unpackhi_epi8(values, values);
+			StoreFour(out + i, _mm_srai_epi32(_mm_unpacklo_epi16(low, low), 24), 1.0f / 127.0f, -1.0f);
+			StoreFour(out + i + 4, _mm_srai_epi32(_mm_unpackhi_epi16(low, low), 24), 1.0f / 127.0f, -1.0f);
+			StoreFour(out + i + 8, _mm_srai_epi32(_mm_unpacklo_epi16(high, high), 24), 1.0f / 127.0f, -1.0f);
+			StoreFour(out + i + 12, _mm_srai_epi32(_mm_unpackhi_epi16(high, high), 24), 1.0f / 127.0f, -1.0f);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = fmaxf(static_cast<float>(in[i]) * (1.0f / 127.0f), -1.0f);
+		}
+	}
+
+	static void PackUnorm16(const float* in, uint16_t* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_AVX2
+		for (; i + 16 <= count; i += 16)
+		{
+			__m256i packed = _mm256_packus_epi32(QuantizeEight(in + i, 0.0f, 1.0f, 65535.0f), QuantizeEight(in + i + 8, 0.0f, 1.0f, 65535.0f));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), OrderPackedWords(packed));
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		__m128i bias = _mm_set1_epi32(32768);
+		for (; i + 8 <= count; i += 8)
+		{
+			// SSE2 has no unsigned 32-to-16 pack: shift into signed range and back
+			__m128i low = _mm_sub_epi32(QuantizeFour(in + i, 0.0f, 1.0f, 65535.0f), bias);
+			__m128i high = _mm_sub_epi32(QuantizeFour(in + i + 4, 0.0f, 1.0f, 65535.0f), bias);
+			__m128i packed = _mm_xor_si128(_mm_packs_epi32(low, high), _mm_set1_epi16(static_cast<short>(0x8000)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = static_cast<uint16_t>(QuantizeOne(in[i], 0.0f, 1.0f, 65535.0f));
+		}
+	}
+
+	static void UnpackUnorm16(const uint16_t* in, float* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_AVX2
+		for (; i + 8 <= count; i += 8)
+		{
+			StoreEight(out + i, _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))), 1.0f / 65535.0f, 0.0f);
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		__m128i zero = _mm_setzero_si128();
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+			StoreFour(out + i, _mm_unpacklo_epi16(values, zero), 1.0f / 65535.0f, 0.0f);
+			StoreFour(out + i + 4, _mm_unpackhi_epi16(values, zero), 1.0f / 65535.0f, 0.0f);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = static_cast<float>(in[i]) * (1.0f / 65535.0f);
+		}
+	}
+
+	static void PackUnorm8(const float* in, uint8_t* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_AVX2
+		for (; i + 32 <= count; i += 32)
+		{
+			__m256i low = _mm256_packs_epi32(QuantizeEight(in + i, 0.0f, 1.0f, 255.0f), QuantizeEight(in + i + 8, 0.0f, 1.0f, 255.0f));
+			__m256i high = _mm256_packs_epi32(QuantizeEight(in + i + 16, 0.0f, 1.0f, 255.0f), QuantizeEight(in + i + 24, 0.0f, 1.0f, 255.0f));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), OrderPackedBytes(_mm256_packus_epi16(low, high)));
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i low = _mm_packs_epi32(QuantizeFour(in + i, 0.0f, 1.0f, 255.0f), QuantizeFour(in + i + 4, 0.0f, 1.0f, 255.0f));
+			__m128i high = _mm_packs_epi32(QuantizeFour(in + i + 8, 0.0f, 1.0f, 255.0f), QuantizeFour(in + i + 12, 0.0f, 1.0f, 255.0f));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(low, high));
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = static_cast<uint8_t>(QuantizeOne(in[i], 0.0f, 1.0f, 255.0f));
+		}
+	}
+
+	static void UnpackUnorm8(const uint8_t* in, float* out, size_t count)
+	{
+		size_t i = 0;
+		#if RUNDEE_SIMD_AVX2
+		for (; i + 8 <= count; i += 8)
+		{
+			StoreEight(out + i, _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i))), 1.0f / 255.0f, 0.0f);
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		__m128i zero = _mm_setzero_si128();
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+			__m128i low = _mm_unpacklo_epi8(values, zero);
+			__m128i high = _mm_unpackhi_epi8(values, zero);
+			StoreFour(out + i, _mm_unpacklo_epi16(low, zero), 1.0f / 255.0f, 0.0f);
+			StoreFour(out + i + 4, _mm_unpackhi_epi16(low, zero), 1.0f / 255.0f, 0.0f);
+			StoreFour(out + i + 8, _mm_unpacklo_epi16(high, zero), 1.0f / 255.0f, 0.0f);
+			StoreFour(out + i + 12, _mm_unpackhi_epi16(high, zero), 1.0f / 255.0f, 0.0f);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = static_cast<float>(in[i]) * (1.0f / 255.0f);
+		}
+	}
+
+	static void PackOctahedral32(SimdVec3In in, uint32_t* out, size_t count)
+	{
+		int32_t* destination = reinterpret_cast<int32_t*>(out);
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			L::IntStore(destination + i, OctahedralPack32<L>(L::Load(in.X + i), L::Load(in.Y + i), L::Load(in.Z + i)));
+		});
+	}
+
+	static void UnpackOctahedral32(const uint32_t* in, SimdVec3Out out, size_t count)
+	{
+		const int32_t* source = reinterpret_cast<const int32_t*>(in);
+		SimdForEach(count, [&](auto lane, size_t i)
+		{
+			using L = decltype(lane);
+			typename L::Type x, y, z;
+			OctahedralUnpack32<L>(L::IntLoad(source + i), x, y, z);
+			L::Store(out.X + i, x);
+			L::Store(out.Y + i, y);
+			L::Store(out.Z + i, z);
+		});
+	}
+
+	static const SimdKernelTable KernelTable =
+	{
+		KernelLevel,
+		KernelName,
+		&Vec3Add,
+		&Vec3Subtract,
+		&Vec3Scale,
+		&Vec3MulAdd,
+		&Vec3Lerp,
+		&Vec3Normalize,
+		&Vec3Dot,
+		&Vec3Length,
+		&Vec3LengthSquared,
+		&Vec3Distance,
+		&FrustumSpheres,
+		&FrustumBoxes,
+		&OverlapRects,
+		&OverlapBoxes,
+		&OverlapSpheres,
+		&RayBoxes,
+		&FastSin,
+		&FastCos,
+		&FastSinCos,
+		&FastAtan2,
+		&FastRSqrt,
+		&FastExp,
+		&FastLog,
+		&NoiseRow2D,
+		&NoiseRow3D,
+		&FloatToHalf,
+		&HalfToFloat,
+		&PackSnorm16,
+		&UnpackSnorm16,
+		&PackSnorm8,
+		&UnpackSnorm8,
+		&PackUnorm16,
+		&UnpackUnorm16,
+		&PackUnorm8,
+		&UnpackUnorm8,
+		&PackOctahedral32,
+		&UnpackOctahedral32
+	};
+}
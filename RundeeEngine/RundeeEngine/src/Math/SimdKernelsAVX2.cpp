@@ -0,0 +1,36 @@
+//Project Name: RundeeEngine
+//File Name: SimdKernelsAVX2.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: AVX2 and FMA SIMD kernels implementation file
+
+// MSVC builds this file alone with /arch:AVX2 (see the project file); GCC
+// is switched here. Only dispatch through SimdKernels reaches this code,
+// so keep it to SIMD.h lanes, templates over them (FastMath's, whose
+// instantiations carry the lane namespace) and static functions: other
+// inline functions would be compiled for AVX2 and could be merged with
+// the baseline copies.
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX2__) && (defined(__x86_64__) || defined(__i386__))
+#pragma GCC target("avx2,fma,f16c")
+#define RUNDEE_SIMD_TARGET_AVX2
+#endif
+
+#include "../../include/RundeeEngine/Math/SIMD.h"
+#include "../../include/RundeeEngine/Math/SimdKernels.h"
+
+#if RUNDEE_SIMD_AVX2
+#include "SimdKernels.inl"
+#endif
+
+namespace RundeeEngine
+{
+	// nullptr when the compiler could not target AVX2 for this file
+	const SimdKernelTable* GetSimdKernelsAVX2()
+	{
+		#if RUNDEE_SIMD_AVX2
+		return &KernelTable;
+		#else
+		return nullptr;
+		#endif
+	}
+}
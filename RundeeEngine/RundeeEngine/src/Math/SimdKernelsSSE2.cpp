@@ -0,0 +1,18 @@
+//Project Name: RundeeEngine
+//File Name: SimdKernelsSSE2.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: SSE2 SIMD kernels implementation file
+
+// Built with the project's baseline instruction set (SSE2 on x64)
+#include "../../include/RundeeEngine/Math/SIMD.h"
+#include "../../include/RundeeEngine/Math/SimdKernels.h"
+#include "SimdKernels.inl"
+
+namespace RundeeEngine
+{
+	const SimdKernelTable* GetSimdKernelsSSE2()
+	{
+		return KernelLevel == SimdLevel::SSE2 ? &KernelTable : nullptr;
+	}
+}
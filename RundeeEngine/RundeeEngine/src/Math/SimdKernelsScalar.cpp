@@ -0,0 +1,22 @@
+//Project Name: RundeeEngine
+//File Name: SimdKernelsScalar.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Scalar reference SIMD kernels implementation file
+
+// Plain C++ lanes regardless of the compiler's instruction set, so every
+// other table can be checked against these
+#ifndef RUNDEE_SIMD_FORCE_SCALAR
+#define RUNDEE_SIMD_FORCE_SCALAR
+#endif
+#include "../../include/RundeeEngine/Math/SIMD.h"
+#include "../../include/RundeeEngine/Math/SimdKernels.h"
+#include "SimdKernels.inl"
+
+namespace RundeeEngine
+{
+	const SimdKernelTable* GetSimdKernelsScalar()
+	{
+		return &KernelTable;
+	}
+}
@@ -0,0 +1,90 @@
+//Project Name: RundeeEngine
+//File Name: Transform.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Translation, rotation and scale transform implementation file
+
+#include "../../include/RundeeEngine/Math/Transform.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <string>
+
+namespace RundeeEngine
+{
+	Transform Transform::operator*(const Transform& child) const
+	{
+		Transform result;
+		result.Translation = TransformPoint(child.Translation);
+		result.Rotation = Rotation * child.Rotation;
+		result.Scale = Scale * child.Scale;
+		return result;
+	}
+
+	Transform Transform::Inverse() const
+	{
+		Transform result;
+		result.Rotation = Rotation.Conjugate();
+		result.Scale = Vec3::One() / Scale;
+		result.Translation = result.Rotation.Rotate(-Translation) * result.Scale;
+		return result;
+	}
+
+	Mat4 Transform::ToMat4() const
+	{
+		Mat3 rotation = Rotation.ToMat3();
+		return Mat4(
+			rotation.Columns[0] * Scale.x,
+			rotation.Columns[1] * Scale.y,
+			rotation.Columns[2] * Scale.z,
+			Vec4(Translation, 1.0f));
+	}
+
+	Transform Transform::Lerp(const Transform& a, const Transform& b, float t)
+	{
+		Transform result;
+		result.Translation = a.Translation.Lerp(b.Translation, t);
+		result.Rotation = Quat::Nlerp(a.Rotation, b.Rotation, t);
+		result.Scale = a.Scale.Lerp(b.Scale, t);
+		return result;
+	}
+
+	void Transform::TransformPoints(const Transform& transform, const Vec3* points, Vec3* out, size_t count)
+	{
+		Mat4::TransformPoints(transform.ToMat4(), points, out, count);
+	}
+
+	static bool CheckParent(int32_t parent, size_t index)
+	{
+		if (parent >= 0 && static_cast<size_t>(parent) >= index)
+		{
+			Logger::Error("Transform hierarchy: node " + std::to_string(index) + " has parent " + std::to_string(parent) + " which does not come before it");
+			return false;
+		}
+		return true;
+	}
+
+	void Transform::ComputeWorld(const Transform* locals, const int32_t* parents, Transform* worlds, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			int32_t parent = parents[i];
+			if (!CheckParent(parent, i))
+			{
+				return;
+			}
+			worlds[i] = parent < 0 ? locals[i] : worlds[parent] * locals[i];
+		}
+	}
+
+	void Transform::ComputeWorldMatrices(const Transform* locals, const int32_t* parents, Mat4* worlds, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			int32_t parent = parents[i];
+			if (!CheckParent(parent, i))
+			{
+				return;
+			}
+			worlds[i] = parent < 0 ? locals[i].ToMat4() : worlds[parent] * locals[i].ToMat4();
+		}
+	}
+}
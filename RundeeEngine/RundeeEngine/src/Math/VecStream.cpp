@@ -0,0 +1,317 @@
+//Project Name: RundeeEngine
+//File Name: VecStream.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Structure-of-arrays Vec3 streams and batch kernels implementation file
+
+#include "../../include/RundeeEngine/Math/VecStream.h"
+#include "../../include/RundeeEngine/Math/SIMD.h"
+#include "../../include/RundeeEngine/Math/SimdKernels.h"
+#include "../../include/RundeeEngine/Memory/MemoryResource.h"
+#include "../../include/RundeeEngine/Memory/MemoryUtils.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace RundeeEngine
+{
+	// Capacity is kept a multiple of one cache line of floats so the y and z
+	// arrays start cache-line aligned as well
+	static constexpr size_t StreamGranularity = CacheLineSize / sizeof(float);
+
+	static bool CheckSizes(const Vec3Stream& a, const Vec3Stream& b, const char* kernelName)
+	{
+		if (a.Size() != b.Size())
+		{
+			Logger::Error(std::string("Vec3Stream::") + kernelName + ": stream sizes differ (" + std::to_string(a.Size()) + " and " + std::to_string(b.Size()) + ")");
+			return false;
+		}
+		return true;
+	}
+
+	Vec3Stream::Vec3Stream(std::pmr::memory_resource* resource)
+		: m_Data(nullptr), m_Size(0), m_Capacity(0), m_Resource(resource ? resource : GetTaggedResource(MemoryTag::Math))
+	{
+	}
+
+	Vec3Stream::Vec3Stream(size_t count, std::pmr::memory_resource* resource)
+		: Vec3Stream(resource)
+	{
+		Resize(count);
+	}
+
+	Vec3Stream::~Vec3Stream()
+	{
+		if (m_Data)
+		{
+			m_Resource->deallocate(m_Data, 3 * m_Capacity * sizeof(float), CacheLineSize);
+		}
+	}
+
+	Vec3Stream::Vec3Stream(const Vec3Stream& other)
+		: Vec3Stream(other.m_Resource)
+	{
+		*this = other;
+	}
+
+	Vec3Stream::Vec3Stream(Vec3Stream&& other) noexcept
+		: m_Data(other.m_Data), m_Size(other.m_Size), m_Capacity(other.m_Capacity), m_Resource(other.m_Resource)
+	{
+		other.m_Data = nullptr;
+		other.m_Size = 0;
+		other.m_Capacity = 0;
+	}
+
+	Vec3Stream& Vec3Stream::operator=(const Vec3Stream& other)
+	{
+		if (this != &other)
+		{
+			m_Size = 0;
+			Resize(other.m_Size);
+			if (m_Size > 0)
+			{
+				memcpy(X(), other.X(), m_Size * sizeof(float));
+				memcpy(Y(), other.Y(), m_Size * sizeof(float));
+				memcpy(Z(), other.Z(), m_Size * sizeof(float));
+			}
+		}
+		return *this;
+	}
+
+	Vec3Stream& Vec3Stream::operator=(Vec3Stream&& other) noexcept
+	{
+		if (this != &other)
+		{
+			std::swap(m_Data, other.m_Data);
+			std::swap(m_Size, other.m_Size);
+			std::swap(m_Capacity, other.m_Capacity);
+			std::swap(m_Resource, other.m_Resource);
+		}
+		return *this;
+	}
+
+	void Vec3Stream::Resize(size_t count)
+	{
+		if (count > m_Capacity)
+		{
+			Reallocate(std::max(count, m_Capacity * 2));
+		}
+
+		if (count > m_Size)
+		{
+			size_t added = (count - m_Size) * sizeof(float);
+			memset(X() + m_Size, 0, added);
+			memset(Y() + m_Size, 0, added);
+			memset(Z() + m_Size, 0, added);
+		}
+		m_Size = count;
+	}
+
+	void Vec3Stream::Reserve(size_t capacity)
+	{
+		if (capacity > m_Capacity)
+		{
+			Reallocate(capacity);
+		}
+	}
+
+	void Vec3Stream::PushBack(const Vec3& value)
+	{
+		if (m_Size == m_Capacity)
+		{
+			Reallocate(std::max(StreamGranularity, m_Capacity * 2));
+		}
+		Set(m_Size++, value);
+	}
+
+	void Vec3Stream::Set(size_t index, const Vec3& value)
+	{
+		X()[index] = value.x;
+		Y()[index] = value.y;
+		Z()[index] = value.z;
+	}
+
+	void Vec3Stream::Reallocate(size_t capacity)
+	{
+		capacity = (capacity + StreamGranularity - 1) / StreamGranularity * StreamGranularity;
+		float* data = static_cast<float*>(m_Resource->allocate(3 * capacity * sizeof(float), CacheLineSize));
+
+		if (m_Data)
+		{
+			memcpy(data, X(), m_Size * sizeof(float));
+			memcpy(data + capacity, Y(), m_Size * sizeof(float));
+			memcpy(data + 2 * capacity, Z(), m_Size * sizeof(float));
+			m_Resource->deallocate(m_Data, 3 * m_Capacity * sizeof(float), CacheLineSize);
+		}
+
+		m_Data = data;
+		m_Capacity = capacity;
+	}
+
+	void Vec3Stream::FromAoS(const Vec3* values, size_t count)
+	{
+		Resize(count);
+		float* x = X();
+		float* y = Y();
+		float* z = Z();
+
+		size_t i = 0;
+		#if RUNDEE_SIMD_SSE2
+		const float* source = reinterpret_cast<const float*>(values);
+		#endif
+
+		#if RUNDEE_SIMD_AVX
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 vx, vy, vz;
+			SimdLoadXYZ8(source + i * 3, vx, vy, vz);
+			_mm256_store_ps(x + i, vx);
+			_mm256_store_ps(y + i, vy);
+			_mm256_store_ps(z + i, vz);
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 vx, vy, vz;
+			SimdLoadXYZ4(source + i * 3, vx, vy, vz);
+			_mm_store_ps(x + i, vx);
+			_mm_store_ps(y + i, vy);
+			_mm_store_ps(z + i, vz);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			x[i] = values[i].x;
+			y[i] = values[i].y;
+			z[i] = values[i].z;
+		}
+	}
+
+	void Vec3Stream::ToAoS(Vec3* out) const
+	{
+		const float* x = X();
+		const float* y = Y();
+		const float* z = Z();
+
+		size_t i = 0;
+		#if RUNDEE_SIMD_SSE2
+		float* destination = reinterpret_cast<float*>(out);
+		#endif
+
+		#if RUNDEE_SIMD_AVX
+		for (; i + 8 <= m_Size; i += 8)
+		{
+			SimdStoreXYZ8(destination + i * 3, _mm256_load_ps(x + i), _mm256_load_ps(y + i), _mm256_load_ps(z + i));
+		}
+		#endif
+
+		#if RUNDEE_SIMD_SSE2
+		for (; i + 4 <= m_Size; i += 4)
+		{
+			SimdStoreXYZ4(destination + i * 3, _mm_load_ps(x + i), _mm_load_ps(y + i), _mm_load_ps(z + i));
+		}
+		#endif
+
+		for (; i < m_Size; ++i)
+		{
+			out[i] = Vec3(x[i], y[i], z[i]);
+		}
+	}
+
+	//----------Batch kernels----------
+
+	static SimdVec3In In(const Vec3Stream& stream)
+	{
+		return { stream.X(), stream.Y(), stream.Z() };
+	}
+
+	static SimdVec3Out Out(Vec3Stream& stream)
+	{
+		return { stream.X(), stream.Y(), stream.Z() };
+	}
+
+	void Vec3Stream::Add(const Vec3Stream& a, const Vec3Stream& b, Vec3Stream& out)
+	{
+		if (!CheckSizes(a, b, "Add"))
+		{
+			return;
+		}
+		out.Resize(a.Size());
+		SimdKernels::Get().Add(In(a), In(b), Out(out), a.Size());
+	}
+
+	void Vec3Stream::Subtract(const Vec3Stream& a, const Vec3Stream& b, Vec3Stream& out)
+	{
+		if (!CheckSizes(a, b, "Subtract"))
+		{
+			return;
+		}
+		out.Resize(a.Size());
+		SimdKernels::Get().Subtract(In(a), In(b), Out(out), a.Size());
+	}
+
+	void Vec3Stream::Scale(const Vec3Stream& a, float scalar, Vec3Stream& out)
+	{
+		out.Resize(a.Size());
+		SimdKernels::Get().Scale(In(a), scalar, Out(out), a.Size());
+	}
+
+	void Vec3Stream::MulAdd(const Vec3Stream& a, const Vec3Stream& b, float scalar, Vec3Stream& out)
+	{
+		if (!CheckSizes(a, b, "MulAdd"))
+		{
+			return;
+		}
+		out.Resize(a.Size());
+		SimdKernels::Get().MulAdd(In(a), In(b), scalar, Out(out), a.Size());
+	}
+
+	void Vec3Stream::Lerp(const Vec3Stream& a, const Vec3Stream& b, float t, Vec3Stream& out)
+	{
+		if (!CheckSizes(a, b, "Lerp"))
+		{
+			return;
+		}
+		out.Resize(a.Size());
+		SimdKernels::Get().Lerp(In(a), In(b), t, Out(out), a.Size());
+	}
+
+	void Vec3Stream::Normalize(const Vec3Stream& a, Vec3Stream& out)
+	{
+		out.Resize(a.Size());
+		SimdKernels::Get().Normalize(In(a), Out(out), a.Size());
+	}
+
+	void Vec3Stream::Dot(const Vec3Stream& a, const Vec3Stream& b, float* out)
+	{
+		if (!CheckSizes(a, b, "Dot"))
+		{
+			return;
+		}
+		SimdKernels::Get().Dot(In(a), In(b), out, a.Size());
+	}
+
+	void Vec3Stream::Length(const Vec3Stream& a, float* out)
+	{
+		SimdKernels::Get().Length(In(a), out, a.Size());
+	}
+
+	void Vec3Stream::LengthSquared(const Vec3Stream& a, float* out)
+	{
+		SimdKernels::Get().LengthSquared(In(a), out, a.Size());
+	}
+
+	void Vec3Stream::Distance(const Vec3Stream& a, const Vec3Stream& b, float* out)
+	{
+		if (!CheckSizes(a, b, "Distance"))
+		{
+			return;
+		}
+		SimdKernels::Get().Distance(In(a), In(b), out, a.Size());
+	}
+}
@@ -0,0 +1,350 @@
+//Project Name: RundeeEngine
+//File Name: AllocationProfiler.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Sampling allocation profiler implementation file
+
+#include "../../include/RundeeEngine/Memory/AllocationProfiler.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <execinfo.h>
+#define RUNDEE_HAS_EXECINFO 1
+#endif
+
+namespace RundeeEngine
+{
+	std::atomic<bool> AllocationProfiler::s_Enabled(false);
+	std::atomic<uint32_t> AllocationProfiler::s_SampleInterval(1024);
+	std::atomic<uint32_t> AllocationProfiler::s_TrackedBlocks(0);
+	static std::atomic<uint64_t> s_DroppedSamples(0);
+	thread_local uint32_t AllocationProfiler::t_Countdown = 0;
+
+	static constexpr int MaxStackDepth = 16;
+	static constexpr int ReportedFrames = 4;
+
+	// Lifetime buckets: <10us, <100us, <1ms, <10ms, <100ms, <1s, <10s, longer
+	static constexpr int LifetimeBucketCount = 8;
+	static const char* const s_LifetimeBucketNames[LifetimeBucketCount] = { "<10us", "<100us", "<1ms", "<10ms", "<100ms", "<1s", "<10s", ">=10s" };
+
+	struct AllocationSite
+	{
+		void* Frames[MaxStackDepth];
+		int Depth;
+		MemoryTag Tag;
+		uint64_t SampledCount;
+		uint64_t SampledBytes;
+		uint64_t LiveCount;
+		uint64_t LiveBytes;
+		uint64_t Lifetimes[LifetimeBucketCount];
+	};
+
+	// Sampled blocks waiting for their free. Probed without a lock so frees of
+	// unsampled blocks stay cheap; a full neighbourhood just drops the lifetime.
+	struct TrackedBlock
+	{
+		std::atomic<void*> Memory;
+		uint32_t Site;
+		uint32_t Generation;
+		uint64_t Size;
+		int64_t StartNanoseconds;
+	};
+
+	static constexpr size_t TrackedTableSize = 1 << 16;
+	static constexpr size_t TrackedProbeCount = 8;
+	static TrackedBlock s_TrackedTable[TrackedTableSize];
+
+	static std::mutex s_SiteMutex;
+	static std::unordered_map<uint64_t, uint32_t> s_SiteLookup;
+	static std::vector<AllocationSite> s_Sites;
+	static uint32_t s_Generation = 0;
+
+	// Set while the profiler itself runs so its own bookkeeping is never sampled
+	static thread_local bool t_InProfiler = false;
+
+	static int64_t NowNanoseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static size_t HashPointer(const void* memory)
+	{
+		uint64_t value = reinterpret_cast<uintptr_t>(memory) >> 4;
+		return static_cast<size_t>((value * 0x9E3779B97F4A7C15ull) >> 48) & (TrackedTableSize - 1);
+	}
+
+	static uint64_t HashFrames(void* const* frames, int depth, MemoryTag tag)
+	{
+		uint64_t hash = 14695981039346656037ull ^ static_cast<uint64_t>(tag);
+		for (int i = 0; i < depth; ++i)
+		{
+			hash ^= reinterpret_cast<uintptr_t>(frames[i]);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	static int CaptureStack(void** frames, int maxFrames)
+	{
+		#if defined(_WIN32)
+		return static_cast<int>(CaptureStackBackTrace(0, static_cast<DWORD>(maxFrames), frames, nullptr));
+		#elif defined(RUNDEE_HAS_EXECINFO)
+		return backtrace(frames, maxFrames);
+		#else
+		(void)frames;
+		(void)maxFrames;
+		return 0;
+		#endif
+	}
+
+	static int LifetimeBucket(int64_t nanoseconds)
+	{
+		int64_t limit = 10000;
+		for (int bucket = 0; bucket < LifetimeBucketCount - 1; ++bucket)
+		{
+			if (nanoseconds < limit)
+			{
+				return bucket;
+			}
+			limit *= 10;
+		}
+		return LifetimeBucketCount - 1;
+	}
+
+	static uint64_t MixBits(uint64_t value)
+	{
+		value += 0x9E3779B97F4A7C15ull;
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+		return value ^ (value >> 31);
+	}
+
+	static std::string FormatBytes(uint64_t bytes)
+	{
+		char text[32];
+		if (bytes >= 1024 * 1024)
+		{
+			std::snprintf(text, sizeof(text), "%.1f MB", static_cast<double>(bytes) / (1024.0 * 1024.0));
+		}
+		else if (bytes >= 1024)
+		{
+			std::snprintf(text, sizeof(text), "%.1f KB", static_cast<double>(bytes) / 1024.0);
+		}
+		else
+		{
+			std::snprintf(text, sizeof(text), "%llu B", static_cast<unsigned long long>(bytes));
+		}
+		return text;
+	}
+
+	void AllocationProfiler::Enable(uint32_t sampleInterval)
+	{
+		s_SampleInterval.store(sampleInterval > 0 ? sampleInterval : 1, std::memory_order_relaxed);
+		s_Enabled.store(true, std::memory_order_relaxed);
+		Logger::Info("AllocationProfiler enabled, sampling 1 in " + std::to_string(sampleInterval) + " allocations.");
+	}
+
+	void AllocationProfiler::Disable()
+	{
+		s_Enabled.store(false, std::memory_order_relaxed);
+	}
+
+	void AllocationProfiler::Reset()
+	{
+		std::lock_guard<std::mutex> lock(s_SiteMutex);
+		s_SiteLookup.clear();
+		s_Sites.clear();
+		s_DroppedSamples.store(0, std::memory_order_relaxed);
+		++s_Generation;
+	}
+
+	uint32_t AllocationProfiler::SeedCountdown()
+	{
+		// Each thread's countdown lives at its own address; the clock separates reruns
+		uint64_t seed = MixBits(reinterpret_cast<uintptr_t>(&t_Countdown) ^ static_cast<uint64_t>(NowNanoseconds()));
+		return 1 + static_cast<uint32_t>(seed % s_SampleInterval.load(std::memory_order_relaxed));
+	}
+
+	void AllocationProfiler::RecordSample(void* memory, size_t size, MemoryTag tag)
+	{
+		if (t_InProfiler)
+		{
+			return;
+		}
+		t_InProfiler = true;
+
+		// Claim a tracking slot first: a sample that cannot be tracked would
+		// never see its free, so it is dropped rather than counted as live forever
+		TrackedBlock* tracked = nullptr;
+		size_t slot = HashPointer(memory);
+		for (size_t probe = 0; probe < TrackedProbeCount; ++probe)
+		{
+			TrackedBlock& block = s_TrackedTable[(slot + probe) & (TrackedTableSize - 1)];
+			void* expected = nullptr;
+			if (block.Memory.compare_exchange_strong(expected, memory, std::memory_order_acq_rel))
+			{
+				tracked = &block;
+				break;
+			}
+		}
+
+		if (!tracked)
+		{
+			s_DroppedSamples.fetch_add(1, std::memory_order_relaxed);
+			t_InProfiler = false;
+			return;
+		}
+
+		void* frames[MaxStackDepth + 2];
+		int depth = CaptureStack(frames, MaxStackDepth + 2);
+
+		// Drop the profiler's own frames
+		int skip = depth > 2 ? 2 : 0;
+		void** siteFrames = frames + skip;
+		depth -= skip;
+
+		uint32_t siteIndex;
+		uint32_t generation;
+		{
+			std::lock_guard<std::mutex> lock(s_SiteMutex);
+			generation = s_Generation;
+
+			uint64_t hash = HashFrames(siteFrames, depth, tag);
+			auto it = s_SiteLookup.find(hash);
+			if (it == s_SiteLookup.end())
+			{
+				AllocationSite site = {};
+				std::copy(siteFrames, siteFrames + depth, site.Frames);
+				site.Depth = depth;
+				site.Tag = tag;
+
+				siteIndex = static_cast<uint32_t>(s_Sites.size());
+				s_Sites.push_back(site);
+				s_SiteLookup.emplace(hash, siteIndex);
+			}
+			else
+			{
+				siteIndex = it->second;
+			}
+
+			AllocationSite& site = s_Sites[siteIndex];
+			++site.SampledCount;
+			site.SampledBytes += size;
+			++site.LiveCount;
+			site.LiveBytes += size;
+		}
+
+		// The block cannot be freed before this returns, so filling the
+		// claimed slot after publishing its pointer races with nothing
+		tracked->Site = siteIndex;
+		tracked->Generation = generation;
+		tracked->Size = size;
+		tracked->StartNanoseconds = NowNanoseconds();
+		s_TrackedBlocks.fetch_add(1, std::memory_order_relaxed);
+
+		t_InProfiler = false;
+	}
+
+	void AllocationProfiler::RecordFree(void* memory)
+	{
+		size_t slot = HashPointer(memory);
+		for (size_t probe = 0; probe < TrackedProbeCount; ++probe)
+		{
+			TrackedBlock& block = s_TrackedTable[(slot + probe) & (TrackedTableSize - 1)];
+			if (block.Memory.load(std::memory_order_acquire) != memory)
+			{
+				continue;
+			}
+
+			int64_t lifetime = NowNanoseconds() - block.StartNanoseconds;
+			uint32_t siteIndex = block.Site;
+			uint32_t generation = block.Generation;
+			uint64_t size = block.Size;
+
+			block.Memory.store(nullptr, std::memory_order_release);
+			s_TrackedBlocks.fetch_sub(1, std::memory_order_relaxed);
+
+			std::lock_guard<std::mutex> lock(s_SiteMutex);
+			if (generation == s_Generation && siteIndex < s_Sites.size())
+			{
+				AllocationSite& site = s_Sites[siteIndex];
+				--site.LiveCount;
+				site.LiveBytes -= size;
+				++site.Lifetimes[LifetimeBucket(lifetime)];
+			}
+			return;
+		}
+	}
+
+	void AllocationProfiler::Report(size_t maxSites)
+	{
+		std::vector<AllocationSite> sites;
+		{
+			std::lock_guard<std::mutex> lock(s_SiteMutex);
+			sites = s_Sites;
+		}
+
+		std::sort(sites.begin(), sites.end(), [](const AllocationSite& a, const AllocationSite& b)
+			{
+				return a.SampledBytes > b.SampledBytes;
+			});
+		if (sites.size() > maxSites)
+		{
+			sites.resize(maxSites);
+		}
+
+		uint64_t interval = s_SampleInterval.load(std::memory_order_relaxed);
+		Logger::Info("Allocation hotspots (" + std::to_string(sites.size()) + " sites, estimates scaled by 1/" + std::to_string(interval) + " sampling):");
+
+		uint64_t dropped = s_DroppedSamples.load(std::memory_order_relaxed);
+		if (dropped > 0)
+		{
+			Logger::Warning("AllocationProfiler: " + std::to_string(dropped) + " samples dropped with the tracking table full; raise the interval.");
+		}
+
+		for (size_t i = 0; i < sites.size(); ++i)
+		{
+			const AllocationSite& site = sites[i];
+
+			std::string line = "#" + std::to_string(i + 1) + " [" + MemoryTracker::GetTagName(site.Tag) + "] ~"
+				+ FormatBytes(site.SampledBytes * interval) + " in ~" + std::to_string(site.SampledCount * interval) + " allocs, ~"
+				+ FormatBytes(site.LiveBytes * interval) + " live, lifetimes";
+			for (int bucket = 0; bucket < LifetimeBucketCount; ++bucket)
+			{
+				if (site.Lifetimes[bucket] > 0)
+				{
+					line += std::string(" ") + s_LifetimeBucketNames[bucket] + ":" + std::to_string(site.Lifetimes[bucket]);
+				}
+			}
+			Logger::Info(line);
+
+			int frameCount = site.Depth < ReportedFrames ? site.Depth : ReportedFrames;
+			#ifdef RUNDEE_HAS_EXECINFO
+			// Names need -rdynamic; otherwise module+offset can go through addr2line
+			char** symbols = backtrace_symbols(site.Frames, frameCount);
+			for (int frame = 0; frame < frameCount; ++frame)
+			{
+				Logger::Info(std::string("    ") + (symbols ? symbols[frame] : "?"));
+			}
+			std::free(symbols);
+			#else
+			for (int frame = 0; frame < frameCount; ++frame)
+			{
+				char address[32];
+				std::snprintf(address, sizeof(address), "    0x%llx", static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(site.Frames[frame])));
+				Logger::Info(address);
+			}
+			#endif
+		}
+	}
+}
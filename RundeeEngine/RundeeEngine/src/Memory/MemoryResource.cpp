@@ -0,0 +1,128 @@
+//Project Name: RundeeEngine
+//File Name: MemoryResource.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: std::pmr adapters for the engine allocators implementation file
+
+#include "../../include/RundeeEngine/Memory/MemoryResource.h"
+#include "../../include/RundeeEngine/Memory/AllocationProfiler.h"
+#include "../../include/RundeeEngine/Memory/PoolAllocator.h"
+#include "../../include/RundeeEngine/Memory/TLSFAllocator.h"
+#include <new>
+
+namespace RundeeEngine
+{
+	//----------TaggedMemoryResource Implementation----------
+
+	TaggedMemoryResource::TaggedMemoryResource(MemoryTag tag, std::pmr::memory_resource* upstream)
+		: m_Tag(tag)
+		, m_Upstream(upstream)
+	{
+	}
+
+	void* TaggedMemoryResource::do_allocate(size_t bytes, size_t alignment)
+	{
+		void* memory = m_Upstream->allocate(bytes, alignment);
+		MemoryTracker::RecordAllocation(m_Tag, bytes);
+		AllocationProfiler::OnAllocate(memory, bytes, m_Tag);
+		return memory;
+	}
+
+	void TaggedMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment)
+	{
+		AllocationProfiler::OnFree(pointer);
+		MemoryTracker::RecordFree(m_Tag, bytes);
+		m_Upstream->deallocate(pointer, bytes, alignment);
+	}
+
+	bool TaggedMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+
+	//----------PoolMemoryResource Implementation----------
+
+	PoolMemoryResource::PoolMemoryResource(PoolAllocator& pool, std::pmr::memory_resource* upstream)
+		: m_Pool(&pool)
+		, m_Upstream(upstream)
+	{
+	}
+
+	bool PoolMemoryResource::Fits(size_t bytes, size_t alignment) const
+	{
+		return bytes <= m_Pool->GetBlockSize() && alignment <= m_Pool->GetBlockAlignment();
+	}
+
+	void* PoolMemoryResource::do_allocate(size_t bytes, size_t alignment)
+	{
+		if (!Fits(bytes, alignment))
+		{
+			return m_Upstream->allocate(bytes, alignment);
+		}
+
+		void* block = m_Pool->Allocate();
+		if (!block)
+		{
+			throw std::bad_alloc();
+		}
+		return block;
+	}
+
+	void PoolMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment)
+	{
+		if (!Fits(bytes, alignment))
+		{
+			m_Upstream->deallocate(pointer, bytes, alignment);
+			return;
+		}
+		m_Pool->Free(pointer);
+	}
+
+	bool PoolMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+
+	//----------TLSFMemoryResource Implementation----------
+
+	TLSFMemoryResource::TLSFMemoryResource(TLSFAllocator& heap)
+		: m_Heap(&heap)
+	{
+	}
+
+	void* TLSFMemoryResource::do_allocate(size_t bytes, size_t alignment)
+	{
+		void* memory = m_Heap->Allocate(bytes, alignment > TLSFAllocator::MinAlignment ? alignment : TLSFAllocator::MinAlignment);
+		if (!memory)
+		{
+			throw std::bad_alloc();
+		}
+		return memory;
+	}
+
+	void TLSFMemoryResource::do_deallocate(void* pointer, size_t, size_t)
+	{
+		m_Heap->Free(pointer);
+	}
+
+	bool TLSFMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+
+	std::pmr::memory_resource* GetTaggedResource(MemoryTag tag)
+	{
+		static TaggedMemoryResource s_Resources[] =
+		{
+			TaggedMemoryResource(MemoryTag::General),
+			TaggedMemoryResource(MemoryTag::Renderer),
+			TaggedMemoryResource(MemoryTag::Jobs),
+			TaggedMemoryResource(MemoryTag::Logging),
+			TaggedMemoryResource(MemoryTag::Math),
+			TaggedMemoryResource(MemoryTag::Game),
+		};
+		static_assert(sizeof(s_Resources) / sizeof(s_Resources[0]) == static_cast<size_t>(MemoryTag::Count), "Missing tagged resource");
+
+		return &s_Resources[static_cast<size_t>(tag)];
+	}
+}
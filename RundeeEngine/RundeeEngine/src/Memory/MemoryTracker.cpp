@@ -0,0 +1,158 @@
+//Project Name: RundeeEngine
+//File Name: MemoryTracker.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Per-subsystem memory tracking implementation file
+
+#include "../../include/RundeeEngine/Memory/MemoryTracker.h"
+#include "../../include/RundeeEngine/Memory/AllocationProfiler.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <chrono>
+#include <mutex>
+#include <string>
+
+namespace RundeeEngine
+{
+	MemoryTracker::TagCounters MemoryTracker::s_Counters[static_cast<size_t>(MemoryTag::Count)];
+
+	static constexpr size_t TagCount = static_cast<size_t>(MemoryTag::Count);
+
+	// Rate sampling state, only touched by Update/GetStats
+	static std::mutex s_RateMutex;
+	static std::chrono::steady_clock::time_point s_LastSampleTime = std::chrono::steady_clock::now();
+	static uint64_t s_LastAllocations[TagCount];
+	static uint64_t s_LastBytes[TagCount];
+	static double s_AllocationsPerSecond[TagCount];
+	static double s_BytesPerSecond[TagCount];
+
+	static std::string FormatBytes(int64_t bytes)
+	{
+		if (bytes >= 1024 * 1024)
+		{
+			return std::to_string(bytes / (1024 * 1024)) + " MB";
+		}
+		if (bytes >= 1024)
+		{
+			return std::to_string(bytes / 1024) + " KB";
+		}
+		return std::to_string(bytes) + " B";
+	}
+
+	void* MemoryTracker::Allocate(size_t size, MemoryTag tag, size_t alignment)
+	{
+		void* memory = AlignedAlloc(size, alignment);
+		if (memory)
+		{
+			RecordAllocation(tag, size);
+			AllocationProfiler::OnAllocate(memory, size, tag);
+		}
+		return memory;
+	}
+
+	void MemoryTracker::Free(void* memory, size_t size, MemoryTag tag)
+	{
+		if (!memory)
+		{
+			return;
+		}
+
+		AllocationProfiler::OnFree(memory);
+		RecordFree(tag, size);
+		AlignedFree(memory);
+	}
+
+	void MemoryTracker::SetBudget(MemoryTag tag, size_t bytes)
+	{
+		TagCounters& counters = s_Counters[static_cast<size_t>(tag)];
+		counters.Budget.store(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+		counters.OverBudget.store(false, std::memory_order_relaxed);
+	}
+
+	MemoryTagStats MemoryTracker::GetStats(MemoryTag tag)
+	{
+		size_t index = static_cast<size_t>(tag);
+		const TagCounters& counters = s_Counters[index];
+
+		MemoryTagStats stats;
+		int64_t live = counters.LiveBytes.load(std::memory_order_relaxed);
+		stats.LiveBytes = live > 0 ? static_cast<size_t>(live) : 0;
+		stats.PeakBytes = static_cast<size_t>(counters.PeakBytes.load(std::memory_order_relaxed));
+		stats.Budget = static_cast<size_t>(counters.Budget.load(std::memory_order_relaxed));
+		stats.TotalAllocations = counters.TotalAllocations.load(std::memory_order_relaxed);
+		stats.TotalBytes = counters.TotalBytes.load(std::memory_order_relaxed);
+
+		std::lock_guard<std::mutex> lock(s_RateMutex);
+		stats.AllocationsPerSecond = s_AllocationsPerSecond[index];
+		stats.BytesPerSecond = s_BytesPerSecond[index];
+		return stats;
+	}
+
+	const char* MemoryTracker::GetTagName(MemoryTag tag)
+	{
+		switch (tag)
+		{
+		case MemoryTag::General: return "General";
+		case MemoryTag::Renderer: return "Renderer";
+		case MemoryTag::Jobs: return "Jobs";
+		case MemoryTag::Logging: return "Logging";
+		case MemoryTag::Math: return "Math";
+		case MemoryTag::Game: return "Game";
+		default: return "Unknown";
+		}
+	}
+
+	void MemoryTracker::Update()
+	{
+		std::lock_guard<std::mutex> lock(s_RateMutex);
+
+		auto now = std::chrono::steady_clock::now();
+		double seconds = std::chrono::duration<double>(now - s_LastSampleTime).count();
+		if (seconds <= 0.0)
+		{
+			return;
+		}
+		s_LastSampleTime = now;
+
+		for (size_t i = 0; i < TagCount; ++i)
+		{
+			uint64_t allocations = s_Counters[i].TotalAllocations.load(std::memory_order_relaxed);
+			uint64_t bytes = s_Counters[i].TotalBytes.load(std::memory_order_relaxed);
+			s_AllocationsPerSecond[i] = static_cast<double>(allocations - s_LastAllocations[i]) / seconds;
+			s_BytesPerSecond[i] = static_cast<double>(bytes - s_LastBytes[i]) / seconds;
+			s_LastAllocations[i] = allocations;
+			s_LastBytes[i] = bytes;
+		}
+	}
+
+	void MemoryTracker::Report()
+	{
+		for (size_t i = 0; i < TagCount; ++i)
+		{
+			MemoryTag tag = static_cast<MemoryTag>(i);
+			MemoryTagStats stats = GetStats(tag);
+
+			std::string line = std::string("Memory [") + GetTagName(tag) + "] live " + FormatBytes(static_cast<int64_t>(stats.LiveBytes))
+				+ ", peak " + FormatBytes(static_cast<int64_t>(stats.PeakBytes))
+				+ ", " + std::to_string(static_cast<uint64_t>(stats.AllocationsPerSecond)) + " allocs/s";
+			if (stats.Budget > 0)
+			{
+				line += ", budget " + FormatBytes(static_cast<int64_t>(stats.Budget));
+			}
+			Logger::Info(line);
+		}
+	}
+
+	void MemoryTracker::OnBudgetExceeded(MemoryTag tag, int64_t liveBytes)
+	{
+		TagCounters& counters = s_Counters[static_cast<size_t>(tag)];
+
+		// Warn once per crossing; RecordFree re-arms when usage drops back under budget
+		if (counters.OverBudget.exchange(true, std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		Logger::Warning(std::string("Memory budget exceeded for [") + GetTagName(tag) + "]: "
+			+ FormatBytes(liveBytes) + " / " + FormatBytes(counters.Budget.load(std::memory_order_relaxed)));
+	}
+}
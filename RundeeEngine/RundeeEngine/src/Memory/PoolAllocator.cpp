@@ -0,0 +1,307 @@
+//Project Name: RundeeEngine
+//File Name: PoolAllocator.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Fixed-size block pool allocator implementation file
+
+#include "../../include/RundeeEngine/Memory/PoolAllocator.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <atomic>
+#include <exception>
+#include <string>
+#include <unordered_map>
+
+namespace RundeeEngine
+{
+	// Live pools by serial. Thread caches outlive neither their thread nor
+	// their pool, so a cache is only handed back while its pool is registered.
+	struct PoolRegistry
+	{
+		std::mutex Mutex;
+		std::unordered_map<uint64_t, PoolAllocator*> Pools;
+	};
+
+	static PoolRegistry& GetPoolRegistry()
+	{
+		static PoolRegistry registry;
+		return registry;
+	}
+
+	static std::atomic<uint64_t> s_NextPoolSerial(1);
+
+	// Serials are sequential; a Fibonacci hash spreads them over the cache
+	// sets instead of letting pools a fixed stride apart share one.
+	static uint32_t GetCacheSet(uint64_t serial, uint32_t setBits)
+	{
+		return static_cast<uint32_t>((serial * 0x9E3779B97F4A7C15ull) >> (64 - setBits));
+	}
+
+	static size_t GetSlabAlignment(size_t blockAlignment)
+	{
+		return blockAlignment > CacheLineSize ? blockAlignment : CacheLineSize;
+	}
+
+	thread_local PoolAllocator::ThreadCacheTable PoolAllocator::t_CacheTable;
+
+	struct ThreadCacheReleaser
+	{
+		~ThreadCacheReleaser();
+	};
+
+	static thread_local ThreadCacheReleaser t_CacheReleaser;
+
+	ThreadCacheReleaser::~ThreadCacheReleaser()
+	{
+		PoolAllocator::ReleaseThreadCaches();
+	}
+
+	PoolAllocator::PoolAllocator(size_t blockSize, size_t blockAlignment, size_t blocksPerSlab, MemoryTag tag, std::pmr::memory_resource* upstream)
+		: m_BlockSize(blockSize)
+		, m_BlockAlignment(blockAlignment)
+		, m_BlocksPerSlab(blocksPerSlab > 0 ? blocksPerSlab : 1)
+		, m_Tag(tag)
+		, m_Upstream(upstream)
+		, m_Serial(s_NextPoolSerial.fetch_add(1))
+		, m_CacheSet(GetCacheSet(m_Serial, ThreadCacheSetBits))
+		, m_FreeList(nullptr)
+		, m_Caches(nullptr)
+	{
+		if (!IsPowerOfTwo(m_BlockAlignment))
+		{
+			Logger::Warning("PoolAllocator: block alignment " + std::to_string(blockAlignment) + " is not a power of two, using default.");
+			m_BlockAlignment = alignof(std::max_align_t);
+		}
+
+		if (m_BlockAlignment < alignof(FreeBlock))
+		{
+			m_BlockAlignment = alignof(FreeBlock);
+		}
+
+		size_t minimumSize = m_BlockSize > sizeof(FreeBlock) ? m_BlockSize : sizeof(FreeBlock);
+		m_BlockStride = AlignUp(minimumSize, m_BlockAlignment);
+
+		PoolRegistry& registry = GetPoolRegistry();
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		registry.Pools[m_Serial] = this;
+	}
+
+	PoolAllocator::~PoolAllocator()
+	{
+		{
+			PoolRegistry& registry = GetPoolRegistry();
+			std::lock_guard<std::mutex> lock(registry.Mutex);
+			registry.Pools.erase(m_Serial);
+		}
+
+		ThreadCache* cache = m_Caches;
+		while (cache)
+		{
+			ThreadCache* next = cache->NextCache;
+			cache->~ThreadCache();
+			FreeBacking(cache, sizeof(ThreadCache), alignof(ThreadCache));
+			cache = next;
+		}
+
+		for (void* slab : m_Slabs)
+		{
+			FreeBacking(slab, m_BlockStride * m_BlocksPerSlab, GetSlabAlignment(m_BlockAlignment));
+		}
+	}
+
+	size_t PoolAllocator::GetSlabCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Slabs.size();
+	}
+
+	size_t PoolAllocator::GetCapacity() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Slabs.size() * m_BlocksPerSlab;
+	}
+
+	PoolAllocator::ThreadCache* PoolAllocator::FindThreadCache(ThreadCacheSlot* set)
+	{
+		for (uint32_t way = 1; way < ThreadCacheWays; ++way)
+		{
+			if (set[way].Serial == m_Serial)
+			{
+				ThreadCacheSlot hit = set[way];
+				for (uint32_t i = way; i > 0; --i)
+				{
+					set[i] = set[i - 1];
+				}
+				set[0] = hit;
+				return hit.Cache;
+			}
+		}
+
+		// The set is shared with other pools that hash to it; hand the least
+		// recently used cache back to its owner before taking its way over.
+		ThreadCacheSlot& slot = set[ThreadCacheWays - 1];
+		ReleaseSlot(slot);
+		(void)&t_CacheReleaser;
+		for (uint32_t i = ThreadCacheWays - 1; i > 0; --i)
+		{
+			set[i] = set[i - 1];
+		}
+		set[0].Serial = 0;
+		set[0].Cache = nullptr;
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		ThreadCache* cache = m_Caches;
+		while (cache && cache->Attached)
+		{
+			cache = cache->NextCache;
+		}
+
+		if (!cache)
+		{
+			void* memory = AllocateBacking(sizeof(ThreadCache), alignof(ThreadCache));
+			if (!memory)
+			{
+				Logger::Error("PoolAllocator: failed to allocate thread cache.");
+				std::terminate();
+			}
+			cache = new (memory) ThreadCache();
+			cache->NextCache = m_Caches;
+			m_Caches = cache;
+		}
+
+		cache->Attached = true;
+		set[0].Serial = m_Serial;
+		set[0].Cache = cache;
+		return cache;
+	}
+
+	void PoolAllocator::DetachThreadCache(ThreadCache* cache)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		while (cache->Head)
+		{
+			FreeBlock* block = cache->Head;
+			cache->Head = block->Next;
+			block->Next = m_FreeList;
+			m_FreeList = block;
+		}
+
+		cache->Count = 0;
+		cache->Attached = false;
+	}
+
+	void PoolAllocator::ReleaseSlot(ThreadCacheSlot& slot)
+	{
+		if (slot.Serial == 0)
+		{
+			return;
+		}
+
+		{
+			PoolRegistry& registry = GetPoolRegistry();
+			std::lock_guard<std::mutex> lock(registry.Mutex);
+			auto it = registry.Pools.find(slot.Serial);
+			if (it != registry.Pools.end())
+			{
+				it->second->DetachThreadCache(slot.Cache);
+			}
+		}
+
+		slot.Serial = 0;
+		slot.Cache = nullptr;
+	}
+
+	void PoolAllocator::ReleaseThreadCaches()
+	{
+		for (ThreadCacheSlot* set : t_CacheTable.Slots)
+		{
+			for (uint32_t way = 0; way < ThreadCacheWays; ++way)
+			{
+				ReleaseSlot(set[way]);
+			}
+		}
+	}
+
+	void PoolAllocator::Refill(ThreadCache& cache)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		if (!m_FreeList && !AllocateSlab())
+		{
+			return;
+		}
+
+		while (m_FreeList && cache.Count < ThreadCacheBatch)
+		{
+			FreeBlock* block = m_FreeList;
+			m_FreeList = block->Next;
+			block->Next = cache.Head;
+			cache.Head = block;
+			++cache.Count;
+		}
+	}
+
+	void PoolAllocator::Drain(ThreadCache& cache, uint32_t keep)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		while (cache.Count > keep)
+		{
+			FreeBlock* block = cache.Head;
+			cache.Head = block->Next;
+			block->Next = m_FreeList;
+			m_FreeList = block;
+			--cache.Count;
+		}
+	}
+
+	bool PoolAllocator::AllocateSlab()
+	{
+		char* slab = static_cast<char*>(AllocateBacking(m_BlockStride * m_BlocksPerSlab, GetSlabAlignment(m_BlockAlignment)));
+		if (!slab)
+		{
+			Logger::Error("PoolAllocator: failed to allocate slab of " + std::to_string(m_BlockStride * m_BlocksPerSlab) + " bytes.");
+			return false;
+		}
+
+		m_Slabs.push_back(slab);
+
+		// Thread the free list back to front so blocks are handed out in address order
+		for (size_t i = m_BlocksPerSlab; i > 0; --i)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * m_BlockStride);
+			block->Next = m_FreeList;
+			m_FreeList = block;
+		}
+
+		return true;
+	}
+
+	void* PoolAllocator::AllocateBacking(size_t size, size_t alignment)
+	{
+		if (!m_Upstream)
+		{
+			return MemoryTracker::Allocate(size, m_Tag, alignment);
+		}
+
+		try
+		{
+			return m_Upstream->allocate(size, alignment);
+		}
+		catch (const std::bad_alloc&)
+		{
+			return nullptr;
+		}
+	}
+
+	void PoolAllocator::FreeBacking(void* memory, size_t size, size_t alignment)
+	{
+		if (!m_Upstream)
+		{
+			MemoryTracker::Free(memory, size, m_Tag);
+			return;
+		}
+		m_Upstream->deallocate(memory, size, alignment);
+	}
+}
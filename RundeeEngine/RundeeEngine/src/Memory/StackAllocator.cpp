@@ -0,0 +1,224 @@
+//Project Name: RundeeEngine
+//File Name: StackAllocator.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Double-ended stack allocator with markers implementation file
+
+#include "../../include/RundeeEngine/Memory/StackAllocator.h"
+#include "../../include/RundeeEngine/Memory/MemoryUtils.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <cstring>
+#include <string>
+
+namespace RundeeEngine
+{
+	StackAllocator::StackAllocator(size_t capacity, MemoryTag tag, bool useHugePages)
+		: m_Memory(nullptr)
+		, m_Capacity(0)
+		, m_Tag(tag)
+		, m_BottomOffset(0)
+		, m_TopOffset(0)
+		, m_PeakBytes(0)
+		, m_UsesHugePages(useHugePages)
+		, m_PageBacking(PageBacking::Standard)
+		#if RUNDEE_STACK_GUARDS
+		, m_LastBottomHeader(NoHeader)
+		, m_LastTopHeader(NoHeader)
+		#endif
+	{
+		if (m_UsesHugePages)
+		{
+			capacity = AlignUp(capacity, VirtualMemory::GetHugePageSize());
+			m_Memory = static_cast<char*>(VirtualMemory::AllocateHugePages(capacity, m_PageBacking));
+			if (m_Memory)
+			{
+				MemoryTracker::RecordAllocation(m_Tag, capacity);
+			}
+		}
+		else
+		{
+			m_Memory = static_cast<char*>(MemoryTracker::Allocate(capacity, m_Tag, CacheLineSize));
+		}
+
+		if (!m_Memory)
+		{
+			Logger::Error("StackAllocator: failed to allocate " + std::to_string(capacity) + " bytes.");
+			return;
+		}
+		m_Capacity = capacity;
+		m_TopOffset = capacity;
+	}
+
+	StackAllocator::~StackAllocator()
+	{
+		if (!m_UsesHugePages)
+		{
+			MemoryTracker::Free(m_Memory, m_Capacity, m_Tag);
+		}
+		else if (m_Memory)
+		{
+			MemoryTracker::RecordFree(m_Tag, m_Capacity);
+			VirtualMemory::Release(m_Memory, m_Capacity);
+		}
+	}
+
+	void* StackAllocator::Allocate(size_t size, size_t alignment, StackSide side)
+	{
+		if (!IsPowerOfTwo(alignment))
+		{
+			Logger::Error("StackAllocator: alignment " + std::to_string(alignment) + " is not a power of two.");
+			return nullptr;
+		}
+
+		#if RUNDEE_STACK_GUARDS
+		const size_t headerBytes = sizeof(GuardHeader);
+		const size_t guardBytes = GuardSize;
+		if (alignment < alignof(GuardHeader))
+		{
+			alignment = alignof(GuardHeader);
+		}
+		#else
+		const size_t headerBytes = 0;
+		const size_t guardBytes = 0;
+		#endif
+
+		uintptr_t base = reinterpret_cast<uintptr_t>(m_Memory);
+		uintptr_t lower = base + m_BottomOffset;
+		uintptr_t upper = base + m_TopOffset;
+		size_t freeBytes = m_TopOffset - m_BottomOffset;
+
+		uintptr_t user = 0;
+		bool fits = size <= freeBytes && freeBytes - size >= headerBytes + guardBytes;
+		if (fits)
+		{
+			if (side == StackSide::Bottom)
+			{
+				user = AlignUp(lower + headerBytes, alignment);
+				fits = user + size + guardBytes <= upper;
+			}
+			else
+			{
+				user = (upper - guardBytes - size) & ~static_cast<uintptr_t>(alignment - 1);
+				fits = user - headerBytes >= lower;
+			}
+		}
+
+		if (!fits)
+		{
+			Logger::Error("StackAllocator: out of memory allocating " + std::to_string(size) + " bytes ("
+				+ std::to_string(freeBytes) + " of " + std::to_string(m_Capacity) + " free).");
+			return nullptr;
+		}
+
+		size_t userOffset = static_cast<size_t>(user - base);
+		if (side == StackSide::Bottom)
+		{
+			m_BottomOffset = userOffset + size + guardBytes;
+		}
+		else
+		{
+			m_TopOffset = userOffset - headerBytes;
+		}
+
+		#if RUNDEE_STACK_GUARDS
+		size_t& lastHeader = side == StackSide::Bottom ? m_LastBottomHeader : m_LastTopHeader;
+		GuardHeader* header = reinterpret_cast<GuardHeader*>(m_Memory + userOffset - headerBytes);
+		header->PreviousHeader = lastHeader;
+		header->Size = size;
+		lastHeader = userOffset - headerBytes;
+		std::memset(m_Memory + userOffset + size, GuardPattern, GuardSize);
+		#endif
+
+		size_t usedBytes = m_BottomOffset + (m_Capacity - m_TopOffset);
+		if (usedBytes > m_PeakBytes)
+		{
+			m_PeakBytes = usedBytes;
+		}
+		return m_Memory + userOffset;
+	}
+
+	StackMarker StackAllocator::GetMarker(StackSide side) const
+	{
+		return StackMarker{ side == StackSide::Bottom ? m_BottomOffset : m_TopOffset, side };
+	}
+
+	void StackAllocator::FreeToMarker(const StackMarker& marker)
+	{
+		if (marker.Side == StackSide::Bottom)
+		{
+			if (marker.Offset > m_BottomOffset)
+			{
+				Logger::Error("StackAllocator: bottom marker " + std::to_string(marker.Offset) + " is past the current bottom " + std::to_string(m_BottomOffset) + ".");
+				return;
+			}
+
+			#if RUNDEE_STACK_GUARDS
+			CheckGuards(StackSide::Bottom, marker.Offset);
+			std::memset(m_Memory + marker.Offset, FreedPattern, m_BottomOffset - marker.Offset);
+			#endif
+			m_BottomOffset = marker.Offset;
+		}
+		else
+		{
+			if (marker.Offset < m_TopOffset || marker.Offset > m_Capacity)
+			{
+				Logger::Error("StackAllocator: top marker " + std::to_string(marker.Offset) + " is past the current top " + std::to_string(m_TopOffset) + ".");
+				return;
+			}
+
+			#if RUNDEE_STACK_GUARDS
+			CheckGuards(StackSide::Top, marker.Offset);
+			std::memset(m_Memory + m_TopOffset, FreedPattern, marker.Offset - m_TopOffset);
+			#endif
+			m_TopOffset = marker.Offset;
+		}
+	}
+
+	void StackAllocator::Clear(StackSide side)
+	{
+		FreeToMarker(StackMarker{ side == StackSide::Bottom ? 0 : m_Capacity, side });
+	}
+
+	void StackAllocator::Clear()
+	{
+		Clear(StackSide::Bottom);
+		Clear(StackSide::Top);
+	}
+
+	#if RUNDEE_STACK_GUARDS
+	// Walks the allocations being rolled back, newest first, and verifies their guards
+	void StackAllocator::CheckGuards(StackSide side, size_t offset)
+	{
+		bool bottom = side == StackSide::Bottom;
+		size_t& lastHeader = bottom ? m_LastBottomHeader : m_LastTopHeader;
+
+		size_t headerOffset = lastHeader;
+		while (headerOffset != NoHeader && (bottom ? headerOffset >= offset : headerOffset < offset))
+		{
+			const GuardHeader* header = reinterpret_cast<const GuardHeader*>(m_Memory + headerOffset);
+			const uint8_t* guard = reinterpret_cast<const uint8_t*>(m_Memory + headerOffset + sizeof(GuardHeader) + header->Size);
+
+			for (size_t i = 0; i < GuardSize; ++i)
+			{
+				if (guard[i] != GuardPattern)
+				{
+					Logger::Error("StackAllocator: overrun detected past the " + std::to_string(header->Size)
+						+ " byte allocation at offset " + std::to_string(headerOffset + sizeof(GuardHeader)) + ".");
+					break;
+				}
+			}
+
+			// A trashed header would send the walk off into the weeds
+			size_t previous = header->PreviousHeader;
+			if (previous != NoHeader && (bottom ? previous >= headerOffset : previous <= headerOffset))
+			{
+				Logger::Error("StackAllocator: allocation header at offset " + std::to_string(headerOffset) + " is corrupted.");
+				headerOffset = NoHeader;
+				break;
+			}
+			headerOffset = previous;
+		}
+		lastHeader = headerOffset;
+	}
+	#endif
+}
@@ -0,0 +1,437 @@
+//Project Name: RundeeEngine
+//File Name: TLSFAllocator.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Two-level segregated fit allocator implementation file
+
+#include "../../include/RundeeEngine/Memory/TLSFAllocator.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <cstring>
+#include <string>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace RundeeEngine
+{
+	// Low bits of BlockHeader::Size; sizes are always multiples of MinAlignment
+	static constexpr size_t BlockFreeBit = 1;
+	static constexpr size_t PrevFreeBit = 2;
+	static constexpr size_t BlockFlagMask = BlockFreeBit | PrevFreeBit;
+
+	// The payload starts right after PrevPhysical and Size; the free list
+	// links only exist while the block is free and live inside the payload
+	static constexpr size_t BlockOverhead = 2 * sizeof(void*);
+	static constexpr size_t MinBlockSize = 2 * sizeof(void*);
+
+	static int FindFirstSet(uint64_t value)
+	{
+		#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward64(&index, value);
+		return static_cast<int>(index);
+		#else
+		return __builtin_ctzll(value);
+		#endif
+	}
+
+	static int FindLastSet(uint64_t value)
+	{
+		#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+		return static_cast<int>(index);
+		#else
+		return 63 - __builtin_clzll(value);
+		#endif
+	}
+
+	template<typename T>
+	static T* OffsetPointer(const void* pointer, ptrdiff_t offset)
+	{
+		return reinterpret_cast<T*>(const_cast<char*>(static_cast<const char*>(pointer)) + offset);
+	}
+
+	static size_t BlockSize(size_t header)
+	{
+		return header & ~BlockFlagMask;
+	}
+
+	TLSFAllocator::TLSFAllocator(size_t capacity, MemoryTag tag, bool useHugePages)
+		: m_Memory(nullptr)
+		, m_Capacity(0)
+		, m_Tag(tag)
+		, m_UsedBytes(0)
+		, m_UsesHugePages(useHugePages)
+		, m_PageBacking(PageBacking::Standard)
+		, m_FirstLevelBitmap(0)
+	{
+		std::memset(m_SecondLevelBitmaps, 0, sizeof(m_SecondLevelBitmaps));
+		std::memset(m_FreeLists, 0, sizeof(m_FreeLists));
+
+		if (static_cast<uint64_t>(capacity) > MaxCapacity)
+		{
+			Logger::Error("TLSFAllocator: capacity " + std::to_string(capacity) + " exceeds the " + std::to_string(MaxCapacity) + " byte maximum.");
+			return;
+		}
+
+		// One header for the initial block and one for the zero-sized sentinel at the end
+		size_t minimumCapacity = 2 * BlockOverhead + MinBlockSize;
+		capacity = AlignUp(capacity < minimumCapacity ? minimumCapacity : capacity, MinAlignment);
+
+		if (m_UsesHugePages)
+		{
+			capacity = AlignUp(capacity, VirtualMemory::GetHugePageSize());
+			m_Memory = VirtualMemory::AllocateHugePages(capacity, m_PageBacking);
+			if (m_Memory)
+			{
+				MemoryTracker::RecordAllocation(m_Tag, capacity);
+			}
+		}
+		else
+		{
+			m_Memory = MemoryTracker::Allocate(capacity, m_Tag, MinAlignment);
+		}
+
+		if (!m_Memory)
+		{
+			Logger::Error("TLSFAllocator: failed to reserve " + std::to_string(capacity) + " bytes.");
+			return;
+		}
+		m_Capacity = capacity;
+
+		BlockHeader* block = static_cast<BlockHeader*>(m_Memory);
+		size_t blockSize = capacity - 2 * BlockOverhead;
+		block->PrevPhysical = nullptr;
+		block->Size = blockSize | BlockFreeBit;
+
+		BlockHeader* sentinel = OffsetPointer<BlockHeader>(block, static_cast<ptrdiff_t>(BlockOverhead + blockSize));
+		sentinel->PrevPhysical = block;
+		sentinel->Size = PrevFreeBit;
+
+		InsertFreeBlock(block);
+	}
+
+	TLSFAllocator::~TLSFAllocator()
+	{
+		if (m_UsedBytes > 0)
+		{
+			Logger::Warning("TLSFAllocator destroyed with " + std::to_string(m_UsedBytes) + " bytes still allocated.");
+		}
+
+		if (!m_UsesHugePages)
+		{
+			MemoryTracker::Free(m_Memory, m_Capacity, m_Tag);
+		}
+		else if (m_Memory)
+		{
+			MemoryTracker::RecordFree(m_Tag, m_Capacity);
+			VirtualMemory::Release(m_Memory, m_Capacity);
+		}
+	}
+
+	void TLSFAllocator::MappingInsert(size_t size, size_t& firstLevel, size_t& secondLevel)
+	{
+		if (size < SmallBlockSize)
+		{
+			firstLevel = 0;
+			secondLevel = size / (SmallBlockSize / SecondLevelCount);
+			return;
+		}
+
+		size_t lastBit = static_cast<size_t>(FindLastSet(size));
+		secondLevel = (size >> (lastBit - SecondLevelLog2)) ^ SecondLevelCount;
+		firstLevel = lastBit - (FirstLevelShift - 1);
+	}
+
+	void TLSFAllocator::MappingSearch(size_t size, size_t& firstLevel, size_t& secondLevel)
+	{
+		// Round up to the next list so any block found there is large enough
+		if (size >= SmallBlockSize)
+		{
+			size += (size_t(1) << (FindLastSet(size) - SecondLevelLog2)) - 1;
+		}
+		MappingInsert(size, firstLevel, secondLevel);
+	}
+
+	TLSFAllocator::BlockHeader* TLSFAllocator::FindFreeBlock(size_t& firstLevel, size_t& secondLevel) const
+	{
+		if (firstLevel >= FirstLevelCount)
+		{
+			return nullptr;
+		}
+
+		uint32_t secondLevelMap = m_SecondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+		if (!secondLevelMap)
+		{
+			uint64_t firstLevelMap = firstLevel + 1 < 64 ? m_FirstLevelBitmap & (~uint64_t(0) << (firstLevel + 1)) : 0;
+			if (!firstLevelMap)
+			{
+				return nullptr;
+			}
+			firstLevel = static_cast<size_t>(FindFirstSet(firstLevelMap));
+			secondLevelMap = m_SecondLevelBitmaps[firstLevel];
+		}
+
+		secondLevel = static_cast<size_t>(FindFirstSet(secondLevelMap));
+		return m_FreeLists[firstLevel][secondLevel];
+	}
+
+	void TLSFAllocator::InsertFreeBlock(BlockHeader* block)
+	{
+		size_t firstLevel, secondLevel;
+		MappingInsert(BlockSize(block->Size), firstLevel, secondLevel);
+
+		BlockHeader* head = m_FreeLists[firstLevel][secondLevel];
+		block->NextFree = head;
+		block->PrevFree = nullptr;
+		if (head)
+		{
+			head->PrevFree = block;
+		}
+
+		m_FreeLists[firstLevel][secondLevel] = block;
+		m_FirstLevelBitmap |= uint64_t(1) << firstLevel;
+		m_SecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+	}
+
+	void TLSFAllocator::RemoveFreeBlock(BlockHeader* block)
+	{
+		size_t firstLevel, secondLevel;
+		MappingInsert(BlockSize(block->Size), firstLevel, secondLevel);
+
+		if (block->PrevFree)
+		{
+			block->PrevFree->NextFree = block->NextFree;
+		}
+		else
+		{
+			m_FreeLists[firstLevel][secondLevel] = block->NextFree;
+		}
+
+		if (block->NextFree)
+		{
+			block->NextFree->PrevFree = block->PrevFree;
+		}
+
+		if (!m_FreeLists[firstLevel][secondLevel])
+		{
+			m_SecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+			if (!m_SecondLevelBitmaps[firstLevel])
+			{
+				m_FirstLevelBitmap &= ~(uint64_t(1) << firstLevel);
+			}
+		}
+	}
+
+	TLSFAllocator::BlockHeader* TLSFAllocator::SplitBlock(BlockHeader* block, size_t size)
+	{
+		// Carves the tail past `size` into a new free block; returns it, or
+		// nullptr if the remainder is too small to hold a block of its own
+		size_t blockSize = BlockSize(block->Size);
+		if (blockSize < size + BlockOverhead + MinBlockSize)
+		{
+			return nullptr;
+		}
+
+		BlockHeader* remainder = OffsetPointer<BlockHeader>(block, static_cast<ptrdiff_t>(BlockOverhead + size));
+		remainder->PrevPhysical = block;
+		remainder->Size = (blockSize - size - BlockOverhead) | BlockFreeBit;
+		block->Size = size | (block->Size & BlockFlagMask);
+
+		BlockHeader* next = OffsetPointer<BlockHeader>(remainder, static_cast<ptrdiff_t>(BlockOverhead + BlockSize(remainder->Size)));
+		next->PrevPhysical = remainder;
+		next->Size |= PrevFreeBit;
+		return remainder;
+	}
+
+	TLSFAllocator::BlockHeader* TLSFAllocator::MergeWithPrevious(BlockHeader* block)
+	{
+		if (!(block->Size & PrevFreeBit))
+		{
+			return block;
+		}
+
+		BlockHeader* previous = block->PrevPhysical;
+		RemoveFreeBlock(previous);
+		previous->Size += BlockOverhead + BlockSize(block->Size);
+
+		BlockHeader* next = OffsetPointer<BlockHeader>(previous, static_cast<ptrdiff_t>(BlockOverhead + BlockSize(previous->Size)));
+		next->PrevPhysical = previous;
+		return previous;
+	}
+
+	TLSFAllocator::BlockHeader* TLSFAllocator::MergeWithNext(BlockHeader* block)
+	{
+		BlockHeader* next = OffsetPointer<BlockHeader>(block, static_cast<ptrdiff_t>(BlockOverhead + BlockSize(block->Size)));
+		if (!(next->Size & BlockFreeBit))
+		{
+			return block;
+		}
+
+		RemoveFreeBlock(next);
+		block->Size += BlockOverhead + BlockSize(next->Size);
+
+		BlockHeader* after = OffsetPointer<BlockHeader>(block, static_cast<ptrdiff_t>(BlockOverhead + BlockSize(block->Size)));
+		after->PrevPhysical = block;
+		return block;
+	}
+
+	void* TLSFAllocator::Allocate(size_t size, size_t alignment)
+	{
+		if (!m_Memory || size == 0 || size > m_Capacity)
+		{
+			return nullptr;
+		}
+
+		if (!IsPowerOfTwo(alignment))
+		{
+			Logger::Error("TLSFAllocator: alignment " + std::to_string(alignment) + " is not a power of two.");
+			return nullptr;
+		}
+
+		size_t adjustedSize = AlignUp(size < MinBlockSize ? MinBlockSize : size, MinAlignment);
+
+		// Over-aligned requests search for enough slack to split off a leading free block
+		size_t searchSize = adjustedSize;
+		if (alignment > MinAlignment)
+		{
+			searchSize += alignment + BlockOverhead + MinBlockSize;
+		}
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		size_t firstLevel, secondLevel;
+		MappingSearch(searchSize, firstLevel, secondLevel);
+		BlockHeader* block = FindFreeBlock(firstLevel, secondLevel);
+		if (!block)
+		{
+			return nullptr;
+		}
+		RemoveFreeBlock(block);
+
+		if (alignment > MinAlignment)
+		{
+			char* payload = OffsetPointer<char>(block, static_cast<ptrdiff_t>(BlockOverhead));
+			char* aligned = static_cast<char*>(AlignUp(payload, alignment));
+			size_t gap = static_cast<size_t>(aligned - payload);
+			if (gap > 0 && gap < BlockOverhead + MinBlockSize)
+			{
+				aligned = static_cast<char*>(AlignUp(payload + BlockOverhead + MinBlockSize, alignment));
+				gap = static_cast<size_t>(aligned - payload);
+			}
+
+			if (gap > 0)
+			{
+				// Leading slack becomes its own free block in front of the aligned one
+				size_t blockSize = BlockSize(block->Size);
+				BlockHeader* alignedBlock = OffsetPointer<BlockHeader>(aligned, -static_cast<ptrdiff_t>(BlockOverhead));
+				alignedBlock->PrevPhysical = block;
+				alignedBlock->Size = (blockSize - gap) | BlockFreeBit | PrevFreeBit;
+				block->Size = (gap - BlockOverhead) | BlockFreeBit | (block->Size & PrevFreeBit);
+
+				BlockHeader* next = OffsetPointer<BlockHeader>(alignedBlock, static_cast<ptrdiff_t>(BlockOverhead + BlockSize(alignedBlock->Size)));
+				next->PrevPhysical = alignedBlock;
+
+				InsertFreeBlock(block);
+				block = alignedBlock;
+			}
+		}
+
+		BlockHeader* remainder = SplitBlock(block, adjustedSize);
+		if (remainder)
+		{
+			InsertFreeBlock(remainder);
+		}
+
+		block->Size &= ~BlockFreeBit;
+		BlockHeader* next = OffsetPointer<BlockHeader>(block, static_cast<ptrdiff_t>(BlockOverhead + BlockSize(block->Size)));
+		next->Size &= ~PrevFreeBit;
+
+		m_UsedBytes += BlockSize(block->Size);
+		return OffsetPointer<void>(block, static_cast<ptrdiff_t>(BlockOverhead));
+	}
+
+	void TLSFAllocator::Free(void* memory)
+	{
+		if (!memory)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		BlockHeader* block = OffsetPointer<BlockHeader>(memory, -static_cast<ptrdiff_t>(BlockOverhead));
+		m_UsedBytes -= BlockSize(block->Size);
+
+		block->Size |= BlockFreeBit;
+		block = MergeWithPrevious(block);
+		block = MergeWithNext(block);
+
+		BlockHeader* next = OffsetPointer<BlockHeader>(block, static_cast<ptrdiff_t>(BlockOverhead + BlockSize(block->Size)));
+		next->PrevPhysical = block;
+		next->Size |= PrevFreeBit;
+
+		InsertFreeBlock(block);
+	}
+
+	size_t TLSFAllocator::GetAllocationSize(const void* memory) const
+	{
+		if (!memory)
+		{
+			return 0;
+		}
+
+		const BlockHeader* block = OffsetPointer<const BlockHeader>(memory, -static_cast<ptrdiff_t>(BlockOverhead));
+		return BlockSize(block->Size);
+	}
+
+	bool TLSFAllocator::Owns(const void* memory) const
+	{
+		const char* begin = static_cast<const char*>(m_Memory);
+		const char* pointer = static_cast<const char*>(memory);
+		return m_Memory && pointer >= begin && pointer < begin + m_Capacity;
+	}
+
+	TLSFStats TLSFAllocator::GetStats() const
+	{
+		TLSFStats stats;
+		stats.Capacity = m_Capacity;
+		if (!m_Memory)
+		{
+			return stats;
+		}
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		const BlockHeader* block = static_cast<const BlockHeader*>(m_Memory);
+		size_t size = BlockSize(block->Size);
+		while (size > 0)
+		{
+			if (block->Size & BlockFreeBit)
+			{
+				stats.FreeBytes += size;
+				++stats.FreeBlockCount;
+				if (size > stats.LargestFreeBlock)
+				{
+					stats.LargestFreeBlock = size;
+				}
+			}
+			else
+			{
+				stats.UsedBytes += size;
+				++stats.UsedBlockCount;
+			}
+
+			block = OffsetPointer<const BlockHeader>(block, static_cast<ptrdiff_t>(BlockOverhead + size));
+			size = BlockSize(block->Size);
+		}
+
+		if (stats.FreeBytes > 0)
+		{
+			stats.Fragmentation = 1.0f - static_cast<float>(stats.LargestFreeBlock) / static_cast<float>(stats.FreeBytes);
+		}
+		return stats;
+	}
+}
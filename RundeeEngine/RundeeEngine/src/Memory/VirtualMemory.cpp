@@ -0,0 +1,251 @@
+//Project Name: RundeeEngine
+//File Name: VirtualMemory.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Virtual address space reservation implementation file
+
+#include "../../include/RundeeEngine/Memory/VirtualMemory.h"
+#include "../../include/RundeeEngine/Memory/MemoryUtils.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <string>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace RundeeEngine
+{
+	size_t VirtualMemory::GetPageSize()
+	{
+		static const size_t pageSize = []()
+		{
+			#ifdef _WIN32
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			return static_cast<size_t>(info.dwPageSize);
+			#else
+			return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+			#endif
+		}();
+		return pageSize;
+	}
+
+	void* VirtualMemory::Reserve(size_t size)
+	{
+		#ifdef _WIN32
+		void* address = VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+		if (!address)
+		{
+			Logger::Error("VirtualMemory: failed to reserve " + std::to_string(size) + " bytes (error " + std::to_string(GetLastError()) + ").");
+		}
+		return address;
+		#else
+		void* address = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (address == MAP_FAILED)
+		{
+			Logger::Error("VirtualMemory: failed to reserve " + std::to_string(size) + " bytes (" + std::strerror(errno) + ").");
+			return nullptr;
+		}
+		return address;
+		#endif
+	}
+
+	bool VirtualMemory::Commit(void* address, size_t size)
+	{
+		#ifdef _WIN32
+		if (!VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE))
+		{
+			Logger::Error("VirtualMemory: failed to commit " + std::to_string(size) + " bytes (error " + std::to_string(GetLastError()) + ").");
+			return false;
+		}
+		return true;
+		#else
+		if (mprotect(address, size, PROT_READ | PROT_WRITE) != 0)
+		{
+			Logger::Error("VirtualMemory: failed to commit " + std::to_string(size) + " bytes (" + std::strerror(errno) + ").");
+			return false;
+		}
+		return true;
+		#endif
+	}
+
+	void VirtualMemory::Decommit(void* address, size_t size)
+	{
+		#ifdef _WIN32
+		VirtualFree(address, size, MEM_DECOMMIT);
+		#else
+		// Drop the pages first so the kernel reclaims them, then fence the range off again
+		madvise(address, size, MADV_DONTNEED);
+		mprotect(address, size, PROT_NONE);
+		#endif
+	}
+
+	void VirtualMemory::Release(void* address, size_t size)
+	{
+		if (!address)
+		{
+			return;
+		}
+
+		#ifdef _WIN32
+		(void)size;
+		VirtualFree(address, 0, MEM_RELEASE);
+		#else
+		munmap(address, size);
+		#endif
+	}
+
+	#ifdef _WIN32
+	// Large pages need SeLockMemoryPrivilege granted to the user and enabled on the token
+	static bool EnableLockMemoryPrivilege()
+	{
+		HANDLE token;
+		if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+		{
+			return false;
+		}
+
+		TOKEN_PRIVILEGES privileges = {};
+		privileges.PrivilegeCount = 1;
+		privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+		bool enabled = false;
+		if (LookupPrivilegeValueW(nullptr, L"SeLockMemoryPrivilege", &privileges.Privileges[0].Luid))
+		{
+			// AdjustTokenPrivileges succeeds with ERROR_NOT_ALL_ASSIGNED when the user lacks the right
+			enabled = AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) && GetLastError() == ERROR_SUCCESS;
+		}
+		CloseHandle(token);
+		return enabled;
+	}
+	#else
+	static bool IsTransparentHugePageEnabled()
+	{
+		FILE* file = std::fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+		if (!file)
+		{
+			return false;
+		}
+
+		char mode[128] = {};
+		size_t length = std::fread(mode, 1, sizeof(mode) - 1, file);
+		std::fclose(file);
+		mode[length] = '\0';
+		return std::strstr(mode, "[never]") == nullptr;
+	}
+	#endif
+
+	size_t VirtualMemory::GetHugePageSize()
+	{
+		static const size_t hugePageSize = []()
+		{
+			size_t size = 0;
+			#ifdef _WIN32
+			size = static_cast<size_t>(GetLargePageMinimum());
+			#else
+			FILE* file = std::fopen("/proc/meminfo", "r");
+			if (file)
+			{
+				char line[256];
+				unsigned long long kilobytes = 0;
+				while (std::fgets(line, sizeof(line), file))
+				{
+					if (std::sscanf(line, "Hugepagesize: %llu kB", &kilobytes) == 1)
+					{
+						size = static_cast<size_t>(kilobytes) * 1024;
+						break;
+					}
+				}
+				std::fclose(file);
+			}
+			#endif
+			return size > 0 ? size : static_cast<size_t>(2 * 1024 * 1024);
+		}();
+		return hugePageSize;
+	}
+
+	void* VirtualMemory::AllocateHugePages(size_t size, PageBacking& backing)
+	{
+		size_t hugePageSize = GetHugePageSize();
+		size = AlignUp(size, hugePageSize);
+
+		#ifdef _WIN32
+		static const bool s_HasLockMemoryPrivilege = EnableLockMemoryPrivilege();
+		void* address = nullptr;
+		if (s_HasLockMemoryPrivilege)
+		{
+			address = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+		}
+
+		if (address)
+		{
+			backing = PageBacking::Huge;
+		}
+		else
+		{
+			// Windows has no transparent huge pages, so this is plain 4KB pages
+			address = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+			backing = PageBacking::Standard;
+		}
+
+		if (!address)
+		{
+			Logger::Error("VirtualMemory: failed to allocate " + std::to_string(size) + " bytes (error " + std::to_string(GetLastError()) + ").");
+			return nullptr;
+		}
+		#else
+		// Explicit huge pages only exist if the admin reserved a hugetlb pool
+		void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (address != MAP_FAILED)
+		{
+			backing = PageBacking::Huge;
+		}
+		else
+		{
+			// Over-map so the range can be trimmed to a huge page boundary, otherwise
+			// the kernel can only use huge pages for the aligned middle of it
+			size_t mappedSize = size + hugePageSize;
+			char* mapped = static_cast<char*>(mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+			if (mapped == MAP_FAILED)
+			{
+				Logger::Error("VirtualMemory: failed to allocate " + std::to_string(size) + " bytes (" + std::strerror(errno) + ").");
+				return nullptr;
+			}
+
+			char* aligned = static_cast<char*>(AlignUp(mapped, hugePageSize));
+			if (aligned > mapped)
+			{
+				munmap(mapped, static_cast<size_t>(aligned - mapped));
+			}
+			size_t tail = static_cast<size_t>(mapped + mappedSize - (aligned + size));
+			if (tail > 0)
+			{
+				munmap(aligned + size, tail);
+			}
+
+			address = aligned;
+			backing = IsTransparentHugePageEnabled() && madvise(address, size, MADV_HUGEPAGE) == 0 ? PageBacking::TransparentHuge : PageBacking::Standard;
+		}
+		#endif
+
+		Logger::Info("VirtualMemory: " + std::to_string(size / (1024 * 1024)) + " MB arena backed by " + GetPageBackingName(backing) + ".");
+		return address;
+	}
+
+	const char* VirtualMemory::GetPageBackingName(PageBacking backing)
+	{
+		switch (backing)
+		{
+		case PageBacking::Standard: return "standard pages";
+		case PageBacking::TransparentHuge: return "transparent huge pages";
+		case PageBacking::Huge: return "huge pages";
+		default: return "unknown pages";
+		}
+	}
+}
@@ -0,0 +1,435 @@
+//Project Name: RundeeEngine
+//File Name: Camera.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: 2D and 3D cameras with cached view and projection matrices implementation file
+
+#include "../../include/RundeeEngine/Renderer/Camera.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include <cmath>
+#include <string>
+
+namespace RundeeEngine
+{
+	static bool CheckViewport(const Viewport& viewport, const char* camera)
+	{
+		if (!(viewport.Width > 0.0f) || !(viewport.Height > 0.0f))
+		{
+			Logger::Error(std::string(camera) + "::SetViewport: size must be positive, got " + std::to_string(viewport.Width) + "x" + std::to_string(viewport.Height));
+			return false;
+		}
+		return true;
+	}
+
+	// NDC to pixels, y flipped, depth from [-1, 1] to [0, 1]
+	static Mat4 ViewportMatrix(const Viewport& viewport)
+	{
+		float halfWidth = viewport.Width * 0.5f;
+		float halfHeight = viewport.Height * 0.5f;
+		return Mat4(
+			Vec4(halfWidth, 0.0f, 0.0f, 0.0f),
+			Vec4(0.0f, -halfHeight, 0.0f, 0.0f),
+			Vec4(0.0f, 0.0f, 0.5f, 0.0f),
+			Vec4(viewport.X + halfWidth, viewport.Y + halfHeight, 0.5f, 1.0f));
+	}
+
+	//----------Camera2D Implementation----------
+
+	Camera2D::Camera2D()
+		: Camera2D(Viewport())
+	{
+	}
+
+	Camera2D::Camera2D(const Viewport& viewport)
+		: m_Position(), m_Rotation(0.0f), m_Zoom(1.0f), m_Viewport(viewport), m_Dirty(true)
+	{
+	}
+
+	void Camera2D::SetPosition(const Vec2& position)
+	{
+		m_Position = position;
+		m_Dirty = true;
+	}
+
+	void Camera2D::SetRotation(float radians)
+	{
+		m_Rotation = radians;
+		m_Dirty = true;
+	}
+
+	void Camera2D::SetZoom(float zoom)
+	{
+		if (!(zoom > 0.0f))
+		{
+			Logger::Error("Camera2D::SetZoom: zoom must be positive, got " + std::to_string(zoom));
+			return;
+		}
+		m_Zoom = zoom;
+		m_Dirty = true;
+	}
+
+	void Camera2D::SetViewport(const Viewport& viewport)
+	{
+		if (!CheckViewport(viewport, "Camera2D"))
+		{
+			return;
+		}
+		m_Viewport = viewport;
+		m_Dirty = true;
+	}
+
+	// Everything is cheap enough in 2D to rebuild together
+	void Camera2D::Update() const
+	{
+		if (!m_Dirty)
+		{
+			return;
+		}
+
+		float cosine = cosf(m_Rotation);
+		float sine = sinf(m_Rotation);
+		float px = m_Position.x, py = m_Position.y;
+		m_View = Mat4(
+			Vec4(cosine, -sine, 0.0f, 0.0f),
+			Vec4(sine, cosine, 0.0f, 0.0f),
+			Vec4(0.0f, 0.0f, 1.0f, 0.0f),
+			Vec4(-(cosine * px + sine * py), sine * px - cosine * py, 0.0f, 1.0f));
+
+		float halfWidth = m_Viewport.Width * 0.5f / m_Zoom;
+		float halfHeight = m_Viewport.Height * 0.5f / m_Zoom;
+		m_Projection = Mat4::Orthographic(-halfWidth, halfWidth, -halfHeight, halfHeight, -1.0f, 1.0f);
+		m_ViewProjection = m_Projection * m_View;
+
+		// Screen = centre + rotate(-rotation, world - position) * zoom, y flipped; and back
+		float zoom = m_Zoom;
+		float centerX = m_Viewport.X + m_Viewport.Width * 0.5f;
+		float centerY = m_Viewport.Y + m_Viewport.Height * 0.5f;
+		m_WorldToScreen = { {
+			cosine * zoom, sine * zoom, centerX - zoom * (cosine * px + sine * py),
+			sine * zoom, -cosine * zoom, centerY + zoom * (cosine * py - sine * px) } };
+		float inverseZoom = 1.0f / zoom;
+		m_ScreenToWorld = { {
+			cosine * inverseZoom, sine * inverseZoom, px - (cosine * centerX + sine * centerY) * inverseZoom,
+			sine * inverseZoom, -cosine * inverseZoom, py - (sine * centerX - cosine * centerY) * inverseZoom } };
+
+		m_VisibleBounds = AABB2();
+		float left = m_Viewport.X, top = m_Viewport.Y;
+		float right = left + m_Viewport.Width, bottom = top + m_Viewport.Height;
+		for (const Vec2& corner : { Vec2(left, top), Vec2(right, top), Vec2(right, bottom), Vec2(left, bottom) })
+		{
+			m_VisibleBounds.Expand(m_ScreenToWorld.Apply(corner));
+		}
+
+		m_Dirty = false;
+	}
+
+	const Mat4& Camera2D::GetView() const
+	{
+		Update();
+		return m_View;
+	}
+
+	const Mat4& Camera2D::GetProjection() const
+	{
+		Update();
+		return m_Projection;
+	}
+
+	const Mat4& Camera2D::GetViewProjection() const
+	{
+		Update();
+		return m_ViewProjection;
+	}
+
+	const AABB2& Camera2D::GetVisibleBounds() const
+	{
+		Update();
+		return m_VisibleBounds;
+	}
+
+	Vec2 Camera2D::WorldToScreen(const Vec2& world) const
+	{
+		Update();
+		return m_WorldToScreen.Apply(world);
+	}
+
+	Vec2 Camera2D::ScreenToWorld(const Vec2& screen) const
+	{
+		Update();
+		return m_ScreenToWorld.Apply(screen);
+	}
+
+	void Camera2D::Apply(const Affine2D& affine, const Vec2* points, Vec2* out, size_t count)
+	{
+		// Copied out of the member so the compiler need not reload it after each store through out
+		const float m0 = affine.M[0], m1 = affine.M[1], m2 = affine.M[2];
+		const float m3 = affine.M[3], m4 = affine.M[4], m5 = affine.M[5];
+		for (size_t i = 0; i < count; ++i)
+		{
+			float x = points[i].x, y = points[i].y;
+			out[i] = Vec2(m0 * x + m1 * y + m2, m3 * x + m4 * y + m5);
+		}
+	}
+
+	void Camera2D::WorldToScreen(const Vec2* world, Vec2* outScreen, size_t count) const
+	{
+		Update();
+		Apply(m_WorldToScreen, world, outScreen, count);
+	}
+
+	void Camera2D::ScreenToWorld(const Vec2* screen, Vec2* outWorld, size_t count) const
+	{
+		Update();
+		Apply(m_ScreenToWorld, screen, outWorld, count);
+	}
+
+	//----------Camera3D Implementation----------
+
+	Camera3D::Camera3D()
+		: Camera3D(Viewport())
+	{
+	}
+
+	Camera3D::Camera3D(const Viewport& viewport)
+		: m_Position(), m_Rotation(), m_ProjectionType(ProjectionType::Perspective), m_FovY(1.04719755f), m_OrthographicHeight(10.0f),
+		m_NearPlane(0.1f), m_FarPlane(1000.0f), m_Viewport(viewport), m_Dirty(DirtyAll)
+	{
+	}
+
+	void Camera3D::SetPosition(const Vec3& position)
+	{
+		m_Position = position;
+		m_Dirty |= DirtyAll & ~DirtyProjection;
+	}
+
+	void Camera3D::SetRotation(const Quat& rotation)
+	{
+		m_Rotation = rotation.Normalize();
+		m_Dirty |= DirtyAll & ~DirtyProjection;
+	}
+
+	void Camera3D::LookAt(const Vec3& target, const Vec3& up)
+	{
+		Vec3 forward = (target - m_Position).Normalize();
+		Vec3 side = forward.Cross(up);
+		if (side.LengthSquared() < 1e-12f)
+		{
+			Logger::Error("Camera3D::LookAt: target is at the camera or straight along up");
+			return;
+		}
+		side = side.Normalize();
+		SetRotation(Quat::FromMat3(Mat3(side, side.Cross(forward), -forward)));
+	}
+
+	void Camera3D::SetPerspective(float fovY, float nearPlane, float farPlane)
+	{
+		if (!(fovY > 0.0f && fovY < 3.14159265f) || !(nearPlane > 0.0f) || !(farPlane > nearPlane))
+		{
+			Logger::Error("Camera3D::SetPerspective: needs 0 < fovY < pi and 0 < near < far");
+			return;
+		}
+		m_ProjectionType = ProjectionType::Perspective;
+		m_FovY = fovY;
+		m_NearPlane = nearPlane;
+		m_FarPlane = farPlane;
+		m_Dirty |= DirtyAll & ~DirtyView;
+	}
+
+	void Camera3D::SetOrthographic(float height, float nearPlane, float farPlane)
+	{
+		if (!(height > 0.0f) || !(farPlane > nearPlane))
+		{
+			Logger::Error("Camera3D::SetOrthographic: needs a positive height and near < far");
+			return;
+		}
+		m_ProjectionType = ProjectionType::Orthographic;
+		m_OrthographicHeight = height;
+		m_NearPlane = nearPlane;
+		m_FarPlane = farPlane;
+		m_Dirty |= DirtyAll & ~DirtyView;
+	}
+
+	void Camera3D::SetViewport(const Viewport& viewport)
+	{
+		if (!CheckViewport(viewport, "Camera3D"))
+		{
+			return;
+		}
+		m_Viewport = viewport;
+		m_Dirty |= DirtyAll & ~DirtyView;
+	}
+
+	void Camera3D::Update() const
+	{
+		if (!(m_Dirty & (DirtyView | DirtyProjection | DirtyCombined)))
+		{
+			return;
+		}
+
+		if (m_Dirty & DirtyView)
+		{
+			// Inverse of the rigid camera transform
+			Mat3 inverseRotation = m_Rotation.Conjugate().ToMat3();
+			m_View = Mat4(inverseRotation, -(inverseRotation * m_Position));
+		}
+
+		if (m_Dirty & DirtyProjection)
+		{
+			float aspect = m_Viewport.GetAspect();
+			if (m_ProjectionType == ProjectionType::Perspective)
+			{
+				m_Projection = Mat4::Perspective(m_FovY, aspect, m_NearPlane, m_FarPlane);
+			}
+			else
+			{
+				float halfHeight = m_OrthographicHeight * 0.5f;
+				float halfWidth = halfHeight * aspect;
+				m_Projection = Mat4::Orthographic(-halfWidth, halfWidth, -halfHeight, halfHeight, m_NearPlane, m_FarPlane);
+			}
+		}
+
+		m_ViewProjection = m_Projection * m_View;
+		m_WorldToScreen = ViewportMatrix(m_Viewport) * m_ViewProjection;
+		m_Dirty &= ~(DirtyView | DirtyProjection | DirtyCombined);
+	}
+
+	void Camera3D::UpdateInverse() const
+	{
+		Update();
+		if (m_Dirty & DirtyInverse)
+		{
+			m_InverseViewProjection = m_ViewProjection.Inverse();
+			m_ScreenToWorld = m_WorldToScreen.Inverse();
+			m_Dirty &= ~DirtyInverse;
+		}
+	}
+
+	const Mat4& Camera3D::GetView() const
+	{
+		Update();
+		return m_View;
+	}
+
+	const Mat4& Camera3D::GetProjection() const
+	{
+		Update();
+		return m_Projection;
+	}
+
+	const Mat4& Camera3D::GetViewProjection() const
+	{
+		Update();
+		return m_ViewProjection;
+	}
+
+	const Mat4& Camera3D::GetInverseViewProjection() const
+	{
+		UpdateInverse();
+		return m_InverseViewProjection;
+	}
+
+	const Frustum& Camera3D::GetFrustum() const
+	{
+		Update();
+		if (m_Dirty & DirtyFrustum)
+		{
+			m_Frustum = Frustum::FromMatrix(m_ViewProjection);
+			m_Dirty &= ~DirtyFrustum;
+		}
+		return m_Frustum;
+	}
+
+	Vec3 Camera3D::WorldToScreen(const Vec3& world) const
+	{
+		Update();
+		Vec4 clip = m_WorldToScreen * Vec4(world, 1.0f);
+		if (!(clip.w > 0.0f))
+		{
+			return Vec3(0.0f, 0.0f, -1.0f);
+		}
+		return clip.ToVec3() / clip.w;
+	}
+
+	Vec3 Camera3D::ScreenToWorld(const Vec3& screen) const
+	{
+		UpdateInverse();
+		Vec4 world = m_ScreenToWorld * Vec4(screen, 1.0f);
+		return world.w != 0.0f ? world.ToVec3() / world.w : Vec3();
+	}
+
+	Ray Camera3D::ScreenPointToRay(const Vec2& screen) const
+	{
+		Vec3 nearPoint = ScreenToWorld(Vec3(screen.x, screen.y, 0.0f));
+		Vec3 farPoint = ScreenToWorld(Vec3(screen.x, screen.y, 1.0f));
+		return Ray(nearPoint, (farPoint - nearPoint).Normalize());
+	}
+
+	// Projects with the perspective divide; where w fails the test the
+	// point becomes fallback. Four points per iteration as x, y, z registers.
+	template<typename KeepTest>
+	static void ProjectPoints(const Mat4& matrix, const Vec3* points, Vec3* out, size_t count, const Vec3& fallback, const KeepTest& keep)
+	{
+		size_t i = 0;
+
+		#if RUNDEE_SIMD_SSE2
+		const float* source = &points[0].x;
+		float* destination = &out[0].x;
+		__m128 m00 = _mm_set1_ps(matrix.Columns[0].x), m10 = _mm_set1_ps(matrix.Columns[0].y), m20 = _mm_set1_ps(matrix.Columns[0].z), m30 = _mm_set1_ps(matrix.Columns[0].w);
+		__m128 m01 = _mm_set1_ps(matrix.Columns[1].x), m11 = _mm_set1_ps(matrix.Columns[1].y), m21 = _mm_set1_ps(matrix.Columns[1].z), m31 = _mm_set1_ps(matrix.Columns[1].w);
+		__m128 m02 = _mm_set1_ps(matrix.Columns[2].x), m12 = _mm_set1_ps(matrix.Columns[2].y), m22 = _mm_set1_ps(matrix.Columns[2].z), m32 = _mm_set1_ps(matrix.Columns[2].w);
+		__m128 m03 = _mm_set1_ps(matrix.Columns[3].x), m13 = _mm_set1_ps(matrix.Columns[3].y), m23 = _mm_set1_ps(matrix.Columns[3].z), m33 = _mm_set1_ps(matrix.Columns[3].w);
+		__m128 fallbackX = _mm_set1_ps(fallback.x), fallbackY = _mm_set1_ps(fallback.y), fallbackZ = _mm_set1_ps(fallback.z);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x, y, z;
+			SimdLoadXYZ4(source + i * 3, x, y, z);
+			__m128 rx = SimdMulAdd(m02, z, SimdMulAdd(m01, y, SimdMulAdd(m00, x, m03)));
+			__m128 ry = SimdMulAdd(m12, z, SimdMulAdd(m11, y, SimdMulAdd(m10, x, m13)));
+			__m128 rz = SimdMulAdd(m22, z, SimdMulAdd(m21, y, SimdMulAdd(m20, x, m23)));
+			__m128 rw = SimdMulAdd(m32, z, SimdMulAdd(m31, y, SimdMulAdd(m30, x, m33)));
+
+			__m128 mask = keep(rw);
+			__m128 inverseW = _mm_div_ps(_mm_set1_ps(1.0f), rw);
+			rx = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(rx, inverseW)), _mm_andnot_ps(mask, fallbackX));
+			ry = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(ry, inverseW)), _mm_andnot_ps(mask, fallbackY));
+			rz = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(rz, inverseW)), _mm_andnot_ps(mask, fallbackZ));
+			SimdStoreXYZ4(destination + i * 3, rx, ry, rz);
+		}
+		#endif
+
+		for (; i < count; ++i)
+		{
+			Vec4 result = matrix * Vec4(points[i], 1.0f);
+			out[i] = keep(result.w) ? result.ToVec3() * (1.0f / result.w) : fallback;
+		}
+	}
+
+	struct PositiveW
+	{
+		bool operator()(float w) const { return w > 0.0f; }
+		#if RUNDEE_SIMD_SSE2
+		__m128 operator()(__m128 w) const { return _mm_cmpgt_ps(w, _mm_setzero_ps()); }
+		#endif
+	};
+
+	struct NonZeroW
+	{
+		bool operator()(float w) const { return w != 0.0f; }
+		#if RUNDEE_SIMD_SSE2
+		__m128 operator()(__m128 w) const { return _mm_cmpneq_ps(w, _mm_setzero_ps()); }
+		#endif
+	};
+
+	void Camera3D::WorldToScreen(const Vec3* world, Vec3* outScreen, size_t count) const
+	{
+		Update();
+		ProjectPoints(m_WorldToScreen, world, outScreen, count, Vec3(0.0f, 0.0f, -1.0f), PositiveW());
+	}
+
+	void Camera3D::ScreenToWorld(const Vec3* screen, Vec3* outWorld, size_t count) const
+	{
+		UpdateInverse();
+		ProjectPoints(m_ScreenToWorld, screen, outWorld, count, Vec3(), NonZeroW());
+	}
+}
@@ -0,0 +1,107 @@
+//Project Name: RundeeEngine
+//File Name: Culling.cpp
+//Author: Haneul Lee (a.k.a Rundee)
+//Date: 2026.10.19
+//Description: Batched visibility culling implementation file
+
+#include "../../include/RundeeEngine/Renderer/Culling.h"
+#include "../../include/RundeeEngine/JobSystem.h"
+#include "../../include/RundeeEngine/Logger.h"
+#include "../../include/RundeeEngine/Memory/MemoryResource.h"
+#include <algorithm>
+#include <cstring>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace RundeeEngine
+{
+	// A block's flags stay in L1 between the test and the compaction
+	static constexpr size_t CullBlockSize = 2048;
+	static constexpr size_t CullBlocksPerJob = 16;
+
+	template<typename BlockTest>
+	size_t Culling::CullBlocks(size_t count, uint32_t* outVisible, const BlockTest& test)
+	{
+		if (count > UINT32_MAX)
+		{
+			Logger::Error("Culling: " + std::to_string(count) + " objects exceed 32-bit indices");
+			return 0;
+		}
+
+		size_t blockCount = (count + CullBlockSize - 1) / CullBlockSize;
+		std::pmr::vector<size_t> visibleCounts(blockCount, GetTaggedResource(MemoryTag::Renderer));
+
+		JobSystem::ParallelFor(blockCount, CullBlocksPerJob, [&](size_t firstBlock, size_t lastBlock)
+		{
+			uint8_t flags[CullBlockSize];
+			for (size_t block = firstBlock; block < lastBlock; ++block)
+			{
+				size_t begin = block * CullBlockSize;
+				size_t size = std::min(CullBlockSize, count - begin);
+				test(begin, size, flags);
+
+				// Compaction into the block's own slice of outVisible. Culled scenes are
+				// mostly invisible, so runs of eight culled objects are skipped whole.
+				uint32_t* out = outVisible + begin;
+				size_t visible = 0;
+				size_t i = 0;
+				for (; i + 8 <= size; i += 8)
+				{
+					uint64_t group;
+					memcpy(&group, flags + i, sizeof(group));
+					if (group == 0)
+					{
+						continue;
+					}
+					for (size_t j = i; j < i + 8; ++j)
+					{
+						out[visible] = static_cast<uint32_t>(begin + j);
+						visible += flags[j];
+					}
+				}
+				for (; i < size; ++i)
+				{
+					out[visible] = static_cast<uint32_t>(begin + i);
+					visible += flags[i];
+				}
+				visibleCounts[block] = visible;
+			}
+		});
+
+		size_t total = visibleCounts.empty() ? 0 : visibleCounts[0];
+		for (size_t block = 1; block < blockCount; ++block)
+		{
+			memmove(outVisible + total, outVisible + block * CullBlockSize, visibleCounts[block] * sizeof(uint32_t));
+			total += visibleCounts[block];
+		}
+		return total;
+	}
+
+	size_t Culling::Cull(const Frustum& frustum, const SphereArrays& spheres, uint32_t* outVisible)
+	{
+		return CullBlocks(spheres.Count, outVisible, [&](size_t begin, size_t size, uint8_t* flags)
+		{
+			SphereArrays block(spheres.CenterX + begin, spheres.CenterY + begin, spheres.CenterZ + begin, spheres.Radius + begin, size);
+			Frustum::OverlapBatch(frustum, block, flags);
+		});
+	}
+
+	size_t Culling::Cull(const Frustum& frustum, const AABB3Arrays& boxes, uint32_t* outVisible)
+	{
+		return CullBlocks(boxes.Count, outVisible, [&](size_t begin, size_t size, uint8_t* flags)
+		{
+			AABB3Arrays block(boxes.MinX + begin, boxes.MinY + begin, boxes.MinZ + begin, boxes.MaxX + begin, boxes.MaxY + begin, boxes.MaxZ + begin, size);
+			Frustum::OverlapBatch(frustum, block, flags);
+		});
+	}
+
+	size_t Culling::Cull(const AABB2& view, const AABB2Arrays& rects, uint32_t* outVisible)
+	{
+		return CullBlocks(rects.Count, outVisible, [&](size_t begin, size_t size, uint8_t* flags)
+		{
+			AABB2Arrays block(rects.MinX + begin, rects.MinY + begin, rects.MaxX + begin, rects.MaxY + begin, size);
+			AABB2::OverlapBatch(view, block, flags);
+		});
+	}
+}
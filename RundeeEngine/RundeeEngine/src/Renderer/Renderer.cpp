@@ -9,6 +9,10 @@
 #include <SDL.h>
 
 #include "../../include/RundeeEngine/Common/CommonType.h"
+#include "../../include/RundeeEngine/Math/FastMath.h"
+#include "../../include/RundeeEngine/Math/Geometry2D.h"
+#include "../../include/RundeeEngine/Memory/MemoryResource.h"
+#include "../../include/RundeeEngine/Renderer/Camera.h"
 #include "../../include/RundeeEngine/Renderer/Renderer.h"
 #include "../../include/RundeeEngine/Logger.h"
 
@@ -107,14 +111,61 @@ namespace RundeeEngine
 
 	void Renderer::DrawCircle(Vec2 center, float radius, int segments, float r, float g, float b, float a)
 	{
+		float step = 2.0f * 3.14159265358979323846f / segments;
 		glBegin(GL_LINE_LOOP);
 		glColor4f(r, g, b, a);
 		for (int i = 0; i < segments; ++i)
 		{
-			float angle = 2.0f * 3.1415926f * i / segments;
-			float x = center.x + cos(angle) * radius;
-			float y = center.y + sin(angle) * radius;
-			glVertex2f(x, y);
+			float sinA, cosA;
+			FastMath::SinCos(step * i, sinA, cosA);
+			glVertex2f(center.x + cosA * radius, center.y + sinA * radius);
+		}
+		glEnd();
+	}
+
+	// Triangulation buffers reused across DrawPolygon calls; they only grow,
+	// so steady drawing stops allocating after the largest polygon
+	struct PolygonScratch
+	{
+		std::pmr::vector<uint32_t> Indices{ GetTaggedResource(MemoryTag::Renderer) };
+		std::pmr::vector<uint64_t> Work{ GetTaggedResource(MemoryTag::Renderer) };
+	};
+
+	static PolygonScratch& GetPolygonScratch()
+	{
+		static PolygonScratch scratch;
+		return scratch;
+	}
+
+	void Renderer::DrawPolygon(const Vec2* points, size_t count, float r, float g, float b, float a)
+	{
+		if (count < 3)
+		{
+			return;
+		}
+
+		PolygonScratch& scratch = GetPolygonScratch();
+		size_t workSize = (Geometry2D::GetTriangulateScratchSize(count) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+		if (scratch.Work.size() < workSize)
+		{
+			scratch.Work.resize(workSize);
+		}
+		if (scratch.Indices.size() < 3 * (count - 2))
+		{
+			scratch.Indices.resize(3 * (count - 2));
+		}
+
+		size_t triangleCount = Geometry2D::Triangulate(points, count, scratch.Indices.data(), scratch.Work.data());
+		DrawPolygon(points, scratch.Indices.data(), 3 * triangleCount, r, g, b, a);
+	}
+
+	void Renderer::DrawPolygon(const Vec2* points, const uint32_t* indices, size_t indexCount, float r, float g, float b, float a)
+	{
+		glBegin(GL_TRIANGLES);
+		glColor4f(r, g, b, a);
+		for (size_t i = 0; i < indexCount; ++i)
+		{
+			glVertex2f(points[indices[i]].x, points[indices[i]].y);
 		}
 		glEnd();
 	}
@@ -132,6 +183,30 @@ namespace RundeeEngine
 		glViewport(x, y, width, height);
 	}
 
+	// Viewport y runs down from the top; GL counts from the bottom
+	static void ApplyCamera(const Viewport& viewport, const Mat4& viewProjection)
+	{
+		int windowWidth = 0, windowHeight = 0;
+		SDL_GL_GetDrawableSize(g_Window, &windowWidth, &windowHeight);
+		glViewport(static_cast<int>(viewport.X), windowHeight - static_cast<int>(viewport.Y + viewport.Height),
+			static_cast<int>(viewport.Width), static_cast<int>(viewport.Height));
+
+		glMatrixMode(GL_PROJECTION);
+		glLoadMatrixf(viewProjection.Data());
+		glMatrixMode(GL_MODELVIEW);
+		glLoadIdentity();
+	}
+
+	void Renderer::SetCamera(const Camera2D& camera)
+	{
+		ApplyCamera(camera.GetViewport(), camera.GetViewProjection());
+	}
+
+	void Renderer::SetCamera(const Camera3D& camera)
+	{
+		ApplyCamera(camera.GetViewport(), camera.GetViewProjection());
+	}
+
 	void Renderer::SetClearColor(float r, float g, float b, float a)
 	{
 		glClearColor(r, g, b, a);
@@ -6,17 +6,16 @@
 
 #include "../include/RundeeEngine/Logger.h"
 #include "../include/RundeeEngine/ThreadPool.h"
-#include <sstream>
-
-#ifdef _WIN32
-#include <Windows.h>
-#else
-#include <thread>
-#endif
+#include "../include/RundeeEngine/Memory/MemoryResource.h"
 
 namespace RundeeEngine {
 
-    ThreadPool::ThreadPool(size_t numThreads) : m_ShouldStop(false)
+    ThreadPool::ThreadPool(size_t numThreads, std::pmr::memory_resource* resource)
+        : m_Threads(resource ? resource : GetTaggedResource(MemoryTag::Jobs))
+        , m_JobPool(256, MemoryTag::Jobs, m_Threads.get_allocator().resource())
+        , m_JobHead(nullptr)
+        , m_JobTail(nullptr)
+        , m_ShouldStop(false)
     {
         try 
         {
@@ -45,55 +44,106 @@ namespace RundeeEngine {
             }
         }
 
+        // Drop jobs still queued when the workers stopped
+        while (m_JobHead)
+        {
+            Job* job = m_JobHead;
+            m_JobHead = job->Next;
+            m_JobPool.Destroy(job);
+        }
+
         Logger::Info("ThreadPool destroyed and all threads joined.");
     }
 
     void ThreadPool::Enqueue(const std::function<void()>& job)
     {
+        Job* node = m_JobPool.Create();
+        if (!node)
+        {
+            Logger::Error("ThreadPool: failed to allocate job.");
+            return;
+        }
+        node->Function = job;
+
         {
             std::unique_lock<std::mutex> lock(m_QueueMutex);
-            m_Jobs.push(job);
+            if (m_JobTail)
+            {
+                m_JobTail->Next = node;
+            }
+            else
+            {
+                m_JobHead = node;
+            }
+            m_JobTail = node;
         }
         m_Condition.notify_one();
     }
 
+    bool ThreadPool::RunPendingJob()
+    {
+        Job* node = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_QueueMutex);
+            if (!m_JobHead)
+            {
+                return false;
+            }
+            node = PopJob();
+        }
+
+        RunJob(node);
+        return true;
+    }
+
+    ThreadPool::Job* ThreadPool::PopJob()
+    {
+        Job* node = m_JobHead;
+        m_JobHead = node->Next;
+        if (!m_JobHead)
+        {
+            m_JobTail = nullptr;
+        }
+        return node;
+    }
+
+    void ThreadPool::RunJob(Job* node)
+    {
+        std::function<void()> job = std::move(node->Function);
+        m_JobPool.Destroy(node);
+
+        try 
+        {
+            job();
+        }
+        catch (const std::exception& e) 
+        {
+            Logger::Error(std::string("Exception during job execution: ") + e.what());
+        }
+    }
+
     void ThreadPool::WorkerThread()
     {
         while (!m_ShouldStop) 
         {
-            std::function<void()> job;
+            Job* node = nullptr;
 
             {
                 std::unique_lock<std::mutex> lock(m_QueueMutex);
                 m_Condition.wait(lock, [&]() {
-                    return !m_Jobs.empty() || m_ShouldStop;
+                    return m_JobHead != nullptr || m_ShouldStop;
                     });
 
-                if (m_ShouldStop && m_Jobs.empty()) 
+                if (m_ShouldStop && !m_JobHead) 
                 {
                     Logger::Info("Worker thread terminating.");
                     return;
                 }
 
-                job = std::move(m_Jobs.front());
-                m_Jobs.pop();
+                node = PopJob();
             }
 
-            try 
-            {
-                std::ostringstream oss;
-                #ifdef _WIN32
-                oss << GetCurrentThreadId();
-                #else
-                oss << std::this_thread::get_id();
-                #endif
-                
-                job();
-            }
-            catch (const std::exception& e) 
-            {
-                Logger::Error(std::string("Exception during job execution: ") + e.what());
-            }
+            RunJob(node);
         }
     }
 }
\ No newline at end of file